@@ -0,0 +1,391 @@
+/*****************************************************************************
+ * @file      kernel_suite.c
+ * @author    Jet Station
+ * @brief     Macro, inline and out-of-line variants of representative kernels
+ * @date      [2026-10-17]
+ *
+ * Contact:
+ *   @website   https://jet-station.github.io/
+ *   @github    https://github.com/jet-station
+ *   @linkedin  https://www.linkedin.com/in/thien-ai-ho/
+ *   @email     thienaiho95@gmail.com
+ *
+ * @copyright  Copyright (c) 2026 Jet Station. All rights reserved.
+ *****************************************************************************/
+
+#include <stdint.h> /* Standard integer data types */
+#include "micro_bench.h"
+#include "kernel_suite.h"
+
+/* Out-of-line variant: never inlined, and on GCC never cloned into a
+ * specialized copy either, so the call stays a real call at every level */
+#if defined(__GNUC__) && !defined(__clang__)
+#define KERNEL_NOINLINE __attribute__((noinline, noclone))
+#else
+#define KERNEL_NOINLINE __attribute__((noinline))
+#endif
+
+/* Force inline even if compiler doesn't want to */
+#define KERNEL_INLINE __attribute__((always_inline)) static inline
+
+/* Kernel data of this level */
+#define KERNEL_DATA KERNEL_SUITE_SYM(g_kernelData_)
+
+KernelSuite_Data_st KERNEL_DATA;
+
+/* CRC-32 (IEEE 802.3, reflected) a nibble at a time: 64 bytes of table
+ * instead of 1 KB, two lookups per byte */
+static const uint32_t s_crcNibble_u32[16] = {
+	0x00000000U, 0x1DB71064U, 0x3B6E20C8U, 0x26D930ACU,
+	0x76DC4190U, 0x6B6B51F4U, 0x4DB26158U, 0x5005713CU,
+	0xEDB88320U, 0xF00F9344U, 0xD6D6A3E8U, 0xCB61B38CU,
+	0x9B64C2B0U, 0x86D3D2D4U, 0xA00AE278U, 0xBDBDF21CU,
+};
+
+/* Kernels as function-like macros section start -----------------------------------------*/
+
+#define KERNEL_COPY_MACRO(dst, src, n) \
+	do \
+	{ \
+		uint32_t l_i_u32; \
+		for (l_i_u32 = 0U; l_i_u32 < (n); l_i_u32++) \
+		{ \
+			(dst)[l_i_u32] = (src)[l_i_u32]; \
+		} \
+	} while (0)
+
+#define KERNEL_FILL_MACRO(dst, value, n) \
+	do \
+	{ \
+		uint32_t l_i_u32; \
+		for (l_i_u32 = 0U; l_i_u32 < (n); l_i_u32++) \
+		{ \
+			(dst)[l_i_u32] = (value); \
+		} \
+	} while (0)
+
+#define KERNEL_CRC32_MACRO(crc, data, len) \
+	do \
+	{ \
+		const uint8_t *l_byte_pu8 = (const uint8_t *)(data); \
+		uint32_t l_crc_u32 = ~0U; \
+		uint32_t l_i_u32; \
+		for (l_i_u32 = 0U; l_i_u32 < (len); l_i_u32++) \
+		{ \
+			l_crc_u32 ^= l_byte_pu8[l_i_u32]; \
+			l_crc_u32 = (l_crc_u32 >> 4) ^ s_crcNibble_u32[l_crc_u32 & 0xFU]; \
+			l_crc_u32 = (l_crc_u32 >> 4) ^ s_crcNibble_u32[l_crc_u32 & 0xFU]; \
+		} \
+		(crc) = ~l_crc_u32; \
+	} while (0)
+
+#define KERNEL_FIR_MACRO(out, in, coef, taps, n) \
+	do \
+	{ \
+		uint32_t l_i_u32; \
+		uint32_t l_t_u32; \
+		int32_t l_acc_s32; \
+		for (l_i_u32 = 0U; l_i_u32 < (n); l_i_u32++) \
+		{ \
+			l_acc_s32 = 0; \
+			for (l_t_u32 = 0U; l_t_u32 < (taps); l_t_u32++) \
+			{ \
+				l_acc_s32 += (int32_t)(in)[l_i_u32 + l_t_u32] * (coef)[l_t_u32]; \
+			} \
+			(out)[l_i_u32] = (int16_t)(l_acc_s32 >> 15); \
+		} \
+	} while (0)
+
+#define KERNEL_BITS_MACRO(result, reg, value) \
+	do \
+	{ \
+		(reg).bits_st.bit0 = (value) & 1U; \
+		(reg).bits_st.bit2 = ((value) >> 1) & 1U; \
+		(reg).register_u32 = ((reg).register_u32 & ~0xF0U) | (((value) << 4) & 0xF0U); \
+		(result) = (uint32_t)(reg).registerHalfWords_u16[0] ^ (reg).registerBytes_u8[3]; \
+	} while (0)
+
+#define KERNEL_SORT_MACRO(a, n) \
+	do \
+	{ \
+		uint32_t l_i_u32; \
+		uint32_t l_j_u32; \
+		uint32_t l_key_u32; \
+		for (l_i_u32 = 1U; l_i_u32 < (n); l_i_u32++) \
+		{ \
+			l_key_u32 = (a)[l_i_u32]; \
+			for (l_j_u32 = l_i_u32; (l_j_u32 > 0U) && ((a)[l_j_u32 - 1U] > l_key_u32); l_j_u32--) \
+			{ \
+				(a)[l_j_u32] = (a)[l_j_u32 - 1U]; \
+			} \
+			(a)[l_j_u32] = l_key_u32; \
+		} \
+	} while (0)
+
+/* Kernels as function-like macros section end -------------------------------------------*/
+
+/* Kernels as inline functions section start ---------------------------------------------*/
+
+KERNEL_INLINE void KernelSuite_copyInline(uint32_t *dst, const uint32_t *src, uint32_t n)
+{
+	KERNEL_COPY_MACRO(dst, src, n);
+}
+
+KERNEL_INLINE void KernelSuite_fillInline(uint32_t *dst, uint32_t value, uint32_t n)
+{
+	KERNEL_FILL_MACRO(dst, value, n);
+}
+
+KERNEL_INLINE uint32_t KernelSuite_crc32Inline(const void *data, uint32_t len)
+{
+	uint32_t l_result_u32 = 0U;
+
+	KERNEL_CRC32_MACRO(l_result_u32, data, len);
+
+	return l_result_u32;
+}
+
+KERNEL_INLINE void KernelSuite_firInline(int16_t *out, const int16_t *in, const int16_t *coef,
+	uint32_t taps, uint32_t n)
+{
+	KERNEL_FIR_MACRO(out, in, coef, taps, n);
+}
+
+KERNEL_INLINE uint32_t KernelSuite_bitsInline(RegisterType_un *reg, uint32_t value)
+{
+	uint32_t l_result_u32 = 0U;
+
+	KERNEL_BITS_MACRO(l_result_u32, *reg, value);
+
+	return l_result_u32;
+}
+
+KERNEL_INLINE void KernelSuite_sortInline(uint32_t *a, uint32_t n)
+{
+	KERNEL_SORT_MACRO(a, n);
+}
+
+/* Kernels as inline functions section end -----------------------------------------------*/
+
+/* Kernels as out-of-line functions section start ----------------------------------------*/
+
+KERNEL_NOINLINE void KERNEL_SUITE_SYM(KernelSuite_copy_)(uint32_t *dst, const uint32_t *src, uint32_t n)
+{
+	KERNEL_COPY_MACRO(dst, src, n);
+}
+
+KERNEL_NOINLINE void KERNEL_SUITE_SYM(KernelSuite_fill_)(uint32_t *dst, uint32_t value, uint32_t n)
+{
+	KERNEL_FILL_MACRO(dst, value, n);
+}
+
+KERNEL_NOINLINE uint32_t KERNEL_SUITE_SYM(KernelSuite_crc32_)(const void *data, uint32_t len)
+{
+	uint32_t l_result_u32 = 0U;
+
+	KERNEL_CRC32_MACRO(l_result_u32, data, len);
+
+	return l_result_u32;
+}
+
+KERNEL_NOINLINE void KERNEL_SUITE_SYM(KernelSuite_fir_)(int16_t *out, const int16_t *in, const int16_t *coef,
+	uint32_t taps, uint32_t n)
+{
+	KERNEL_FIR_MACRO(out, in, coef, taps, n);
+}
+
+KERNEL_NOINLINE uint32_t KERNEL_SUITE_SYM(KernelSuite_bits_)(RegisterType_un *reg, uint32_t value)
+{
+	uint32_t l_result_u32 = 0U;
+
+	KERNEL_BITS_MACRO(l_result_u32, *reg, value);
+
+	return l_result_u32;
+}
+
+KERNEL_NOINLINE void KERNEL_SUITE_SYM(KernelSuite_sort_)(uint32_t *a, uint32_t n)
+{
+	KERNEL_SORT_MACRO(a, n);
+}
+
+/* Kernels as out-of-line functions section end ------------------------------------------*/
+
+/* Benchmark cases section start ---------------------------------------------------------*/
+
+/* One case per kernel and variant. Its code size in the map is the cost of
+ * one call site, the out-of-line kernel body above is paid once */
+
+void KERNEL_SUITE_SYM(KernelSuite_memcpyMacro_)(void)
+{
+	KERNEL_COPY_MACRO(KERNEL_DATA.dst, KERNEL_DATA.src, KERNEL_SUITE_WORDS);
+}
+
+void KERNEL_SUITE_SYM(KernelSuite_memcpyInline_)(void)
+{
+	KernelSuite_copyInline(KERNEL_DATA.dst, KERNEL_DATA.src, KERNEL_SUITE_WORDS);
+}
+
+void KERNEL_SUITE_SYM(KernelSuite_memcpyCall_)(void)
+{
+	KERNEL_SUITE_SYM(KernelSuite_copy_)(KERNEL_DATA.dst, KERNEL_DATA.src, KERNEL_SUITE_WORDS);
+}
+
+void KERNEL_SUITE_SYM(KernelSuite_memsetMacro_)(void)
+{
+	KERNEL_FILL_MACRO(KERNEL_DATA.dst, KERNEL_DATA.fill, KERNEL_SUITE_WORDS);
+}
+
+void KERNEL_SUITE_SYM(KernelSuite_memsetInline_)(void)
+{
+	KernelSuite_fillInline(KERNEL_DATA.dst, KERNEL_DATA.fill, KERNEL_SUITE_WORDS);
+}
+
+void KERNEL_SUITE_SYM(KernelSuite_memsetCall_)(void)
+{
+	KERNEL_SUITE_SYM(KernelSuite_fill_)(KERNEL_DATA.dst, KERNEL_DATA.fill, KERNEL_SUITE_WORDS);
+}
+
+void KERNEL_SUITE_SYM(KernelSuite_crc32Macro_)(void)
+{
+	KERNEL_CRC32_MACRO(KERNEL_DATA.crc, KERNEL_DATA.src, sizeof(KERNEL_DATA.src));
+}
+
+void KERNEL_SUITE_SYM(KernelSuite_crc32Inline_)(void)
+{
+	KERNEL_DATA.crc = KernelSuite_crc32Inline(KERNEL_DATA.src, sizeof(KERNEL_DATA.src));
+}
+
+void KERNEL_SUITE_SYM(KernelSuite_crc32Call_)(void)
+{
+	KERNEL_DATA.crc = KERNEL_SUITE_SYM(KernelSuite_crc32_)(KERNEL_DATA.src, sizeof(KERNEL_DATA.src));
+}
+
+void KERNEL_SUITE_SYM(KernelSuite_firMacro_)(void)
+{
+	KERNEL_FIR_MACRO(KERNEL_DATA.firOut, KERNEL_DATA.firIn, KERNEL_DATA.firCoef,
+		KERNEL_SUITE_TAPS, KERNEL_SUITE_SAMPLES);
+}
+
+void KERNEL_SUITE_SYM(KernelSuite_firInline_)(void)
+{
+	KernelSuite_firInline(KERNEL_DATA.firOut, KERNEL_DATA.firIn, KERNEL_DATA.firCoef,
+		KERNEL_SUITE_TAPS, KERNEL_SUITE_SAMPLES);
+}
+
+void KERNEL_SUITE_SYM(KernelSuite_firCall_)(void)
+{
+	KERNEL_SUITE_SYM(KernelSuite_fir_)(KERNEL_DATA.firOut, KERNEL_DATA.firIn, KERNEL_DATA.firCoef,
+		KERNEL_SUITE_TAPS, KERNEL_SUITE_SAMPLES);
+}
+
+/* Eight register updates per case, the size of a typical driver helper */
+void KERNEL_SUITE_SYM(KernelSuite_bitsMacro_)(void)
+{
+	uint32_t l_value_u32 = 0U;
+	uint32_t l_result_u32 = 0U;
+
+	for (l_value_u32 = 0U; l_value_u32 < 8U; l_value_u32++)
+	{
+		KERNEL_BITS_MACRO(l_result_u32, KERNEL_DATA.reg_un, l_value_u32);
+		KERNEL_DATA.bits ^= l_result_u32;
+	}
+}
+
+void KERNEL_SUITE_SYM(KernelSuite_bitsInline_)(void)
+{
+	uint32_t l_value_u32 = 0U;
+
+	for (l_value_u32 = 0U; l_value_u32 < 8U; l_value_u32++)
+	{
+		KERNEL_DATA.bits ^= KernelSuite_bitsInline(&KERNEL_DATA.reg_un, l_value_u32);
+	}
+}
+
+void KERNEL_SUITE_SYM(KernelSuite_bitsCall_)(void)
+{
+	uint32_t l_value_u32 = 0U;
+
+	for (l_value_u32 = 0U; l_value_u32 < 8U; l_value_u32++)
+	{
+		KERNEL_DATA.bits ^= KERNEL_SUITE_SYM(KernelSuite_bits_)(&KERNEL_DATA.reg_un, l_value_u32);
+	}
+}
+
+/* Every sample sorts the same unsorted input again */
+void KERNEL_SUITE_SYM(KernelSuite_sortMacro_)(void)
+{
+	KERNEL_COPY_MACRO(KERNEL_DATA.sortOut, KERNEL_DATA.sortIn, KERNEL_SUITE_SORT_LEN);
+	KERNEL_SORT_MACRO(KERNEL_DATA.sortOut, KERNEL_SUITE_SORT_LEN);
+}
+
+void KERNEL_SUITE_SYM(KernelSuite_sortInline_)(void)
+{
+	KERNEL_COPY_MACRO(KERNEL_DATA.sortOut, KERNEL_DATA.sortIn, KERNEL_SUITE_SORT_LEN);
+	KernelSuite_sortInline(KERNEL_DATA.sortOut, KERNEL_SUITE_SORT_LEN);
+}
+
+void KERNEL_SUITE_SYM(KernelSuite_sortCall_)(void)
+{
+	KERNEL_COPY_MACRO(KERNEL_DATA.sortOut, KERNEL_DATA.sortIn, KERNEL_SUITE_SORT_LEN);
+	KERNEL_SUITE_SYM(KernelSuite_sort_)(KERNEL_DATA.sortOut, KERNEL_SUITE_SORT_LEN);
+}
+
+/* Benchmark cases section end -----------------------------------------------------------*/
+
+#define KERNEL_SUITE_CASE(kernel, variant) kernel "." variant "." KERNEL_SUITE_STR(KERNEL_SUITE_OPT)
+
+/**
+  * @brief  Fill the inputs of this level, run by Bench_runAll() before the
+  *         cases, same pseudo-random inputs on every level and platform
+  * @param  None
+  * @retval None
+  */
+static void KernelSuite_setup(void)
+{
+	uint32_t l_seed_u32 = 0x12345678U;
+	uint32_t l_i_u32 = 0U;
+
+	for (l_i_u32 = 0U; l_i_u32 < KERNEL_SUITE_WORDS; l_i_u32++)
+	{
+		l_seed_u32 = (l_seed_u32 * 1664525U) + 1013904223U;
+		KERNEL_DATA.src[l_i_u32] = l_seed_u32;
+	}
+	for (l_i_u32 = 0U; l_i_u32 < (KERNEL_SUITE_SAMPLES + KERNEL_SUITE_TAPS - 1U); l_i_u32++)
+	{
+		l_seed_u32 = (l_seed_u32 * 1664525U) + 1013904223U;
+		KERNEL_DATA.firIn[l_i_u32] = (int16_t)(l_seed_u32 >> 16);
+	}
+	for (l_i_u32 = 0U; l_i_u32 < KERNEL_SUITE_TAPS; l_i_u32++)
+	{
+		/* Moving average in Q15 */
+		KERNEL_DATA.firCoef[l_i_u32] = (int16_t)(32768U / KERNEL_SUITE_TAPS);
+	}
+	for (l_i_u32 = 0U; l_i_u32 < KERNEL_SUITE_SORT_LEN; l_i_u32++)
+	{
+		l_seed_u32 = (l_seed_u32 * 1664525U) + 1013904223U;
+		KERNEL_DATA.sortIn[l_i_u32] = l_seed_u32 >> 8;
+	}
+	KERNEL_DATA.fill = 0xA5A5A5A5U;
+}
+
+/* Benchmark cases, shared by the target and the host runner. The names are
+ * string literals, each level linked in adds its own 18 entries */
+BENCH_SETUP(s_kernelSetup, KernelSuite_setup);
+BENCH_CASE(s_memcpyMacroCase, KERNEL_SUITE_CASE("memcpy", "mac"), KERNEL_SUITE_SYM(KernelSuite_memcpyMacro_));
+BENCH_CASE(s_memcpyInlineCase, KERNEL_SUITE_CASE("memcpy", "inl"), KERNEL_SUITE_SYM(KernelSuite_memcpyInline_));
+BENCH_CASE(s_memcpyCallCase, KERNEL_SUITE_CASE("memcpy", "call"), KERNEL_SUITE_SYM(KernelSuite_memcpyCall_));
+BENCH_CASE(s_memsetMacroCase, KERNEL_SUITE_CASE("memset", "mac"), KERNEL_SUITE_SYM(KernelSuite_memsetMacro_));
+BENCH_CASE(s_memsetInlineCase, KERNEL_SUITE_CASE("memset", "inl"), KERNEL_SUITE_SYM(KernelSuite_memsetInline_));
+BENCH_CASE(s_memsetCallCase, KERNEL_SUITE_CASE("memset", "call"), KERNEL_SUITE_SYM(KernelSuite_memsetCall_));
+BENCH_CASE(s_crc32MacroCase, KERNEL_SUITE_CASE("crc32", "mac"), KERNEL_SUITE_SYM(KernelSuite_crc32Macro_));
+BENCH_CASE(s_crc32InlineCase, KERNEL_SUITE_CASE("crc32", "inl"), KERNEL_SUITE_SYM(KernelSuite_crc32Inline_));
+BENCH_CASE(s_crc32CallCase, KERNEL_SUITE_CASE("crc32", "call"), KERNEL_SUITE_SYM(KernelSuite_crc32Call_));
+BENCH_CASE(s_firMacroCase, KERNEL_SUITE_CASE("fir", "mac"), KERNEL_SUITE_SYM(KernelSuite_firMacro_));
+BENCH_CASE(s_firInlineCase, KERNEL_SUITE_CASE("fir", "inl"), KERNEL_SUITE_SYM(KernelSuite_firInline_));
+BENCH_CASE(s_firCallCase, KERNEL_SUITE_CASE("fir", "call"), KERNEL_SUITE_SYM(KernelSuite_firCall_));
+BENCH_CASE(s_bitsMacroCase, KERNEL_SUITE_CASE("bits", "mac"), KERNEL_SUITE_SYM(KernelSuite_bitsMacro_));
+BENCH_CASE(s_bitsInlineCase, KERNEL_SUITE_CASE("bits", "inl"), KERNEL_SUITE_SYM(KernelSuite_bitsInline_));
+BENCH_CASE(s_bitsCallCase, KERNEL_SUITE_CASE("bits", "call"), KERNEL_SUITE_SYM(KernelSuite_bitsCall_));
+BENCH_CASE(s_sortMacroCase, KERNEL_SUITE_CASE("sort", "mac"), KERNEL_SUITE_SYM(KernelSuite_sortMacro_));
+BENCH_CASE(s_sortInlineCase, KERNEL_SUITE_CASE("sort", "inl"), KERNEL_SUITE_SYM(KernelSuite_sortInline_));
+BENCH_CASE(s_sortCallCase, KERNEL_SUITE_CASE("sort", "call"), KERNEL_SUITE_SYM(KernelSuite_sortCall_));
@@ -0,0 +1,83 @@
+/*****************************************************************************
+ * @file      kernel_suite.h
+ * @author    Jet Station
+ * @brief     Macro, inline and out-of-line variants of representative kernels
+ * @date      [2026-10-17]
+ *
+ * Contact:
+ *   @website   https://jet-station.github.io/
+ *   @github    https://github.com/jet-station
+ *   @linkedin  https://www.linkedin.com/in/thien-ai-ho/
+ *   @email     thienaiho95@gmail.com
+ *
+ * @copyright  Copyright (c) 2026 Jet Station. All rights reserved.
+ *****************************************************************************/
+
+#ifndef __KERNEL_SUITE_H__
+#define __KERNEL_SUITE_H__
+
+#include <stdint.h>
+
+/* No device header here: the same file is built for the Blue Pill and by
+ * the host benchmark runner in embedded-c-services/Host */
+
+/* Tag of the optimization level kernel_suite.c is built with. It names the
+ * symbols and the benchmark cases, so the host runner can link the file
+ * once per level. The Keil project builds it at -O0 */
+#ifndef KERNEL_SUITE_OPT
+#define KERNEL_SUITE_OPT O0
+#endif
+
+#define KERNEL_SUITE_CAT2(a, b) a##b
+#define KERNEL_SUITE_CAT(a, b) KERNEL_SUITE_CAT2(a, b)
+#define KERNEL_SUITE_STR2(a) #a
+#define KERNEL_SUITE_STR(a) KERNEL_SUITE_STR2(a)
+
+/* Symbol of the current level, e.g. KernelSuite_crc32_O3 */
+#define KERNEL_SUITE_SYM(name) KERNEL_SUITE_CAT(name, KERNEL_SUITE_OPT)
+
+/* Working set of the kernels, small enough for the 10 KB of the STM32F103C6 */
+#define KERNEL_SUITE_WORDS (16U) /* memcpy, memset, CRC32 over 64 bytes */
+#define KERNEL_SUITE_TAPS (8U) /* FIR taps */
+#define KERNEL_SUITE_SAMPLES (16U) /* FIR output samples */
+#define KERNEL_SUITE_SORT_LEN (8U) /* Sorted elements */
+
+/* Benchmark cases per level: 6 kernels in 3 variants, registered with
+ * BENCH_CASE() in kernel_suite.c, BENCH_MAX_CASES must leave room for them */
+#define KERNEL_SUITE_CASES (18U)
+
+/* Register view as in the struct-union-data-types demo */
+typedef struct {
+	uint32_t bit0 : 1;
+	uint32_t bit1 : 1;
+	uint32_t bit2 : 1;
+	uint32_t bit3 : 1;
+	uint32_t reserved : 28;
+} RegisterBits_st;
+
+typedef union {
+	uint32_t register_u32; /* Access the entire register */
+	RegisterBits_st bits_st; /* Access individual bits */
+	uint8_t registerBytes_u8[4]; /* Access as bytes */
+	uint16_t registerHalfWords_u16[2]; /* Access as half-words */
+} RegisterType_un;
+
+/* Inputs and outputs of the kernels. Exported so that no level can prove a
+ * result unused and drop the work */
+typedef struct {
+	uint32_t src[KERNEL_SUITE_WORDS];
+	uint32_t dst[KERNEL_SUITE_WORDS];
+	int16_t firIn[KERNEL_SUITE_SAMPLES + KERNEL_SUITE_TAPS - 1U];
+	int16_t firCoef[KERNEL_SUITE_TAPS];
+	int16_t firOut[KERNEL_SUITE_SAMPLES];
+	uint32_t sortIn[KERNEL_SUITE_SORT_LEN];
+	uint32_t sortOut[KERNEL_SUITE_SORT_LEN];
+	RegisterType_un reg_un;
+	uint32_t fill;
+	uint32_t crc;
+	uint32_t bits;
+} KernelSuite_Data_st;
+
+extern KernelSuite_Data_st KERNEL_SUITE_SYM(g_kernelData_);
+
+#endif
@@ -16,84 +16,18 @@
 #include <stdbool.h> /* Standard bool data types */
 #include <stdint.h> /* Standard integer data types */
 #include "stm32f103x6.h"
-
-typedef struct {
-	uint32_t macroFunc;
-	uint32_t inlineFunc;
-	uint32_t regFunc;
-} FuncExecCycles;
-
-uint32_t testVarA = 100U;
-uint32_t testVarB = 250U;
-uint32_t testResult = 0U;
-
-FuncExecCycles exeCycles = {.macroFunc = 0U, 
-						   .inlineFunc = 0U, 
-						   .regFunc = 0U};
-		
-/* Function-like macro */						   
-#define MACRO_MAXFUNC(a, b) ((a) > (b) ? (a) : (b))
-						   						  
-/* Regular function */
-uint32_t Reg_MaxFunc(uint32_t a, uint32_t b) {
-    return (a > b) ? a : b;
-}
-
-/* Force inline even if compiler doesn't want to */
-__attribute__((always_inline)) 
-static inline uint32_t Inline_MaxFunc(uint32_t a, uint32_t b) {
-    return (a > b) ? a : b;
-}
-
-/* Wrapper function to test function-like macro */
-void Test_callMacroFunc(void)
-{
-	testResult = MACRO_MAXFUNC(testVarA, testVarB);
-}
-
-/* Wrapper function to test regular function */
-void Test_callRegFunc(void) {
-    testResult = Reg_MaxFunc(testVarA, testVarB);
-}
-
-/* Wrapper function to test inline function */
-void Test_callInlineFunc(void) {
-    testResult = Inline_MaxFunc(testVarA, testVarB);
-}
+#include "dwt_time.h"
+#include "micro_bench.h"
+#include "max_func.h"
 
 /* Function to measure the execution time of functions */
 void Test_execTiming(void) {
-    volatile uint32_t start, end;
-	
-	/* Mearsure function-like macro execution timing */
-    start = DWT->CYCCNT;
-    Test_callMacroFunc();
-    end = DWT->CYCCNT;
-    exeCycles.macroFunc = end - start;
-    
-    /* Mearsure inline function execution timing */
-    start = DWT->CYCCNT;
-    Test_callInlineFunc();
-    end = DWT->CYCCNT;
-    exeCycles.inlineFunc = end - start;
-    
-	/* Mearsure regular function execution timing */
-    start = DWT->CYCCNT;
-    Test_callRegFunc();
-    end = DWT->CYCCNT;
-    exeCycles.regFunc = end - start;
-}
+	/* The max_func.c and kernel_suite.c cases come from the bench registry,
+	 * the kernel suite fills its inputs from its BENCH_SETUP() hook */
+	Bench_init();
 
-/* Data Watchpoint and Trace intialization */
-void DWT_init(void) {
-    /* Enable trace and debug */
-    CoreDebug->DEMCR |= (1U << 24);  // TRCENA bit
-    
-    /* Reset cycle counter */
-    DWT->CYCCNT = 0U;
-    
-    /* Enable cycle counter */
-    DWT->CTRL |= (1U << 0);  // CYCCNTENA bit
+	/* Warm-up, then 64 samples per case, results in g_benchResults */
+	(void)Bench_runAll(8U, 64U);
 }
 
 /**
@@ -103,7 +37,7 @@ void DWT_init(void) {
 int main(void)
 {
 	/* Initialize DWT first */
-	DWT_init();
+	DwtTime_init();
 
 	Test_callMacroFunc();
 	Test_callRegFunc();
@@ -0,0 +1,55 @@
+/*****************************************************************************
+ * @file      max_func.c
+ * @author    Jet Station
+ * @brief     Macro, inline and regular MaxFunc variants and their benchmark
+ * @date      [2026-10-17]
+ *
+ * Contact:
+ *   @website   https://jet-station.github.io/
+ *   @github    https://github.com/jet-station
+ *   @linkedin  https://www.linkedin.com/in/thien-ai-ho/
+ *   @email     thienaiho95@gmail.com
+ *
+ * @copyright  Copyright (c) 2026 Jet Station. All rights reserved.
+ *****************************************************************************/
+
+#include <stdint.h> /* Standard integer data types */
+#include "micro_bench.h"
+#include "max_func.h"
+
+uint32_t testVarA = 100U;
+uint32_t testVarB = 250U;
+uint32_t testResult = 0U;
+
+/* Regular function */
+uint32_t Reg_MaxFunc(uint32_t a, uint32_t b) {
+    return (a > b) ? a : b;
+}
+
+/* Force inline even if compiler doesn't want to */
+__attribute__((always_inline)) 
+static inline uint32_t Inline_MaxFunc(uint32_t a, uint32_t b) {
+    return (a > b) ? a : b;
+}
+
+/* Wrapper function to test function-like macro */
+void Test_callMacroFunc(void)
+{
+	testResult = MACRO_MAXFUNC(testVarA, testVarB);
+}
+
+/* Wrapper function to test regular function */
+void Test_callRegFunc(void) {
+    testResult = Reg_MaxFunc(testVarA, testVarB);
+}
+
+/* Wrapper function to test inline function */
+void Test_callInlineFunc(void) {
+    testResult = Inline_MaxFunc(testVarA, testVarB);
+}
+
+/* Benchmark cases, shared by the target and the host runner. The linker
+ * collects them, Bench_runAll() finds them without a registration call */
+BENCH_CASE(s_macroCase, "macro", Test_callMacroFunc);
+BENCH_CASE(s_inlineCase, "inline", Test_callInlineFunc);
+BENCH_CASE(s_regularCase, "regular", Test_callRegFunc);
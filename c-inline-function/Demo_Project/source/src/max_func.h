@@ -0,0 +1,43 @@
+/*****************************************************************************
+ * @file      max_func.h
+ * @author    Jet Station
+ * @brief     Macro, inline and regular MaxFunc variants and their benchmark
+ * @date      [2026-10-17]
+ *
+ * Contact:
+ *   @website   https://jet-station.github.io/
+ *   @github    https://github.com/jet-station
+ *   @linkedin  https://www.linkedin.com/in/thien-ai-ho/
+ *   @email     thienaiho95@gmail.com
+ *
+ * @copyright  Copyright (c) 2026 Jet Station. All rights reserved.
+ *****************************************************************************/
+
+#ifndef __MAX_FUNC_H__
+#define __MAX_FUNC_H__
+
+#include <stdint.h>
+
+/* No device header here: the same file is built for the Blue Pill and by
+ * the host benchmark runner in embedded-c-services/Host */
+
+extern uint32_t testVarA;
+extern uint32_t testVarB;
+extern uint32_t testResult;
+
+/* Function-like macro */
+#define MACRO_MAXFUNC(a, b) ((a) > (b) ? (a) : (b))
+
+/* Regular function */
+uint32_t Reg_MaxFunc(uint32_t a, uint32_t b);
+
+/* Wrapper function to test function-like macro */
+void Test_callMacroFunc(void);
+
+/* Wrapper function to test regular function */
+void Test_callRegFunc(void);
+
+/* Wrapper function to test inline function */
+void Test_callInlineFunc(void);
+
+#endif
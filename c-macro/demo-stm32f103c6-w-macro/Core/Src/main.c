@@ -18,6 +18,7 @@
 #include "macro_demo.h"
 #include "bsp_stm32f103_bluepill.h"
 #include "bsp_ektm4c123gxl.h"
+#include "mono_clock.h"
 
 #define MACRO_USED
 
@@ -80,7 +81,8 @@ bool Ticks_elapsed(uint32_t tickCount, uint32_t lastEventTick, uint32_t interval
 {
 	bool isElapsed = false;
 	
-	if ((tickCount - lastEventTick) >= interval)
+	/* modulo 2^32 difference, valid across a counter rollover */
+	if (MonoClock_elapsed32(tickCount, lastEventTick) >= interval)
 	{
 		isElapsed = true;
 	}
@@ -93,16 +95,6 @@ bool Ticks_elapsed(uint32_t tickCount, uint32_t lastEventTick, uint32_t interval
 
 void Demo_tickCountUpWoMacro(void) {
 	
-	/* roll over handling, keep the diff-time */
-	if (g_tickCount == 4294967295U)
-	{
-		g_tickCount = g_tickCount - g_lastEventTick;
-		g_lastEventTick = 0U;
-	}
-	else
-	{
-	}
-	
 	/* Simulate tick increment */
 	g_tickCount++;
 	
@@ -16,6 +16,7 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include "macro_demo.h"
+#include "mono_clock.h"
 
 #define BOARD_STM32F103C6_BLUEPILL
 #define DEBUG_ENABLED
@@ -28,20 +29,14 @@
 	#error "Development Board is not specified"
 #endif
 
-/* Macro for maximum value of ticks */
-#define TICKS_MAX_VALUE (4294967295U)
-
-/* Macro for reset value of ticks */
-#define TICKS_RESET_VALUE (0U)
-
 /* Macro for ticks per second */
 #define TICKS_PER_SECOND (1000U)
 
 /* Macro to convert milliseconds to ticks */
 #define MS_TO_TICKS(ms) ((ms) * TICKS_PER_SECOND / 1000U)
 
-/* Macro to check if ticks have elapsed */
-#define TICKS_ELAPSED(current, start, interval) (((current) - (start)) >= (interval))
+/* Macro to check if ticks have elapsed, valid across a counter rollover */
+#define TICKS_ELAPSED(current, start, interval) (MonoClock_elapsed32((current), (start)) >= (interval))
 
 /* Macro to convert and concat string */
 #define TO_STRING(x) #x
@@ -76,18 +71,8 @@ static void MacroDemo_sendNotificationToUser(void)
 }
 
 void MacroDemo_tickCountUp(void) {
-		
-	/* roll over handling, keep the diff-time */
-	if (g_tickCount == TICKS_MAX_VALUE)
-	{
-		g_tickCount = g_tickCount - g_lastEventTick;
-		g_lastEventTick = TICKS_RESET_VALUE;
-	}
-	else
-	{
-	}
 	
-	/* Simulate tick increment */
+	/* Simulate tick increment, the elapsed check is rollover-free */
 	g_tickCount++;
 
 	/* Check if 500ms have passed since last event */
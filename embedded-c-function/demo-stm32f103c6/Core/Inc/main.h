@@ -53,6 +53,12 @@ extern "C" {
 void Error_Handler(void);
 
 /* USER CODE BEGIN EFP */
+/**
+  * @brief  Pass one SysTick to the counter task, called from SysTick_Handler()
+  * @param  None
+  * @retval None
+  */
+void Counter_tickFromIsr(void);
 
 /* USER CODE END EFP */
 
@@ -1,12 +1,56 @@
 
 #include <stdbool.h> /* Standard bool data types */
 #include <stdint.h> /* Standard integer data types */
+#include "main.h"
+#include "task_scheduler.h"
+#include "event_queue.h"
+#include "stack_watch.h"
+#if defined(FUNC_TRACE)
+#include "func_trace.h"
+#endif
+#if defined(PC_PROFILER)
+#include "pc_profiler.h"
+#endif
+#if defined(IRQ_LATENCY)
+#include "irq_latency.h"
+#endif
+#if defined(HEAP_MONITOR)
+#include "heap_monitor.h"
+#endif
+#if defined(RT_KERNEL)
+#include "rt_kernel.h"
+#endif
 
 /* Global variable declaration section start ----------------------------------------------*/
 
 uint32_t g_counter_u32 = 0U;
 uint32_t g_counterThres_u32 = 0U;
 
+/* SysTick events for the counter task, the task drains them in one batch so
+ * that a late run still counts every tick */
+#define COUNTER_TICK_EVENT (1U)
+#define COUNTER_TICK_EVENTS (8U)
+
+static EventQueue_Event_st s_tickEventBuf_st[COUNTER_TICK_EVENTS];
+static EventQueue_Spsc_st s_tickEvents_st;
+
+/* Stack high-water marks in bytes for the debugger watch window, refreshed
+ * from the idle path every REPORT_PERIOD_MS together with the largest free
+ * heap block of g_heapMon */
+#define REPORT_PERIOD_MS (1000U)
+
+uint32_t g_mspSize_u32 = 0U;
+uint32_t g_mspUsed_u32 = 0U;
+static uint32_t s_reportTick_u32 = 0U;
+
+#if defined(RT_KERNEL)
+/* Stack of the counter thread, on the process stack pointer */
+#define COUNT_STACK_WORDS (128U)
+
+static uint32_t s_countStack_u32[COUNT_STACK_WORDS];
+uint32_t g_countStackUsed_u32 = 0U;
+#endif
+
 /* Global variable declaration section end ------------------------------------------------*/
 
 
@@ -19,6 +63,13 @@ uint32_t g_counterThres_u32 = 0U;
   */
 static void Counter_countUp(void);
 
+/**
+  * @brief  Pass one SysTick to the counter task, called from SysTick_Handler()
+  * @param  None
+  * @retval None
+  */
+void Counter_tickFromIsr(void);
+
 /**
   * @brief  Get counter value
   * @param  None
@@ -68,6 +119,52 @@ void BSP_setOnBoardLedOn(void);
   */
 void BSP_setOnBoardLedOff(void);
 
+/**
+  * @brief  Periodic counter task, runs every 1 ms
+  * @param  None
+  * @retval None
+  */
+static void Task_countUp(void);
+
+#if defined(RT_KERNEL)
+/**
+  * @brief  Counter thread of the preemptive kernel, runs every 1 ms
+  * @param  arg: unused
+  * @retval None
+  */
+static void Thread_countUp(void *arg);
+#endif
+
+/**
+  * @brief  Check if the report is due, restarts its period
+  * @param  None
+  * @retval bool
+  */
+static bool Report_isDue(void);
+
+/**
+  * @brief  Refresh the stack high-water marks and the heap monitor
+  * @param  None
+  * @retval None
+  */
+static void Report_update(void);
+
+/**
+  * @brief  Idle hook of the scheduler, refreshes the report and sleeps
+  * @param  ticksToNextRelease: time until the next periodic release
+  * @retval None
+  */
+void TaskSched_idle(uint32_t ticksToNextRelease);
+
+#if defined(RT_KERNEL)
+/**
+  * @brief  Idle hook of the kernel, refreshes the report and sleeps
+  * @param  None
+  * @retval None
+  */
+void RtKernel_idle(void);
+#endif
+
 /* Function declaration section end -------------------------------------------------------*/
 
 /* Function definition section start ------------------------------------------------------*/
@@ -82,6 +179,17 @@ static void Counter_countUp(void)
 	g_counter_u32++;
 }
 
+/**
+  * @brief  Pass one SysTick to the counter task, called from SysTick_Handler()
+  * @param  None
+  * @retval None
+  */
+void Counter_tickFromIsr(void)
+{
+	/* lock-free, a full queue counts the tick as dropped */
+	(void)EventQueue_spscPush(&s_tickEvents_st, COUNTER_TICK_EVENT, HAL_GetTick());
+}
+
 /**
   * @brief  Get counter value
   * @param  None
@@ -168,40 +276,28 @@ void BSP_setOnBoardLedOff(void)
 	/* Todo: Implement actual code to turn on-board LED off */
 }
 
-/* Function definition section end -------------------------------------------------------*/
-
-/* main function definition start --------------------------------------------------------*/
-
 /**
-  * @brief  The application entry point.
-  * @retval int
+  * @brief  Periodic counter task, runs every 1 ms
+  * @param  None
+  * @retval None
   */
-int main(void)
+static void Task_countUp(void)
 {
-	/* local variable */
-	bool l_isCounterOvered_b = false;
-	uint32_t l_counterThres_u32 = 0U;
+	EventQueue_Event_st l_events_st[COUNTER_TICK_EVENTS];
+	uint32_t l_count_u32 = 0U;
+	uint32_t l_index_u32 = 0U;
 	
-	/* initialization */
-	Counter_resetCounter();
-	Counter_setCounterThres(1000U);
-	BSP_setOnBoardLedOff();
+	/* all ticks since the last run in one pass */
+	l_count_u32 = EventQueue_spscPopBatch(&s_tickEvents_st, l_events_st, COUNTER_TICK_EVENTS);
 	
-	/* infinite loop */
-	while (1)
+	for (l_index_u32 = 0U; l_index_u32 < l_count_u32; l_index_u32++)
 	{
-		/* count up every loop iteration */
+		/* count up every tick */
 		Counter_countUp();
 		
-		/* get current counter threshold */
-		l_counterThres_u32 = Counter_getCounterThres();
-		
-		l_isCounterOvered_b = Counter_isOvered(l_counterThres_u32);
-		
 		/* check if counter expired */
-		if (true == l_isCounterOvered_b)
+		if (true == Counter_isOvered(Counter_getCounterThres()))
 		{
-			
 			/* reset counter when detecting it expired */
 			Counter_resetCounter();
 			
@@ -214,8 +310,199 @@ int main(void)
 			BSP_setOnBoardLedOff();
 		}
 	}
+}
+
+#if defined(RT_KERNEL)
+/**
+  * @brief  Counter thread of the preemptive kernel, runs every 1 ms
+  * @param  arg: unused
+  * @retval None
+  */
+static void Thread_countUp(void *arg)
+{
+	(void)arg;
+	
+	while (1)
+	{
+		/* same work as the scheduler task, then block until the next tick */
+		Task_countUp();
+		RtKernel_sleep(1U);
+	}
+}
+#endif
+
+/**
+  * @brief  Check if the report is due, restarts its period
+  * @param  None
+  * @retval bool
+  */
+static bool Report_isDue(void)
+{
+	uint32_t l_now_u32 = HAL_GetTick();
+	
+	if ((l_now_u32 - s_reportTick_u32) < REPORT_PERIOD_MS)
+	{
+		return false;
+	}
+	s_reportTick_u32 = l_now_u32;
+	
+	return true;
+}
+
+/**
+  * @brief  Refresh the stack high-water marks and the heap monitor
+  * @param  None
+  * @retval None
+  */
+static void Report_update(void)
+{
+	/* walks the untouched part of each stack */
+	g_mspUsed_u32 = StackWatch_getMspUsed();
+#if defined(RT_KERNEL)
+	g_countStackUsed_u32 = StackWatch_getUsed(s_countStack_u32, COUNT_STACK_WORDS);
+#endif
+	
+#if defined(HEAP_MONITOR)
+	/* largest free block, about 10 malloc calls */
+	(void)HeapMon_update();
+#endif
+}
+
+/**
+  * @brief  Idle hook of the scheduler, refreshes the report and sleeps
+  * @param  ticksToNextRelease: time until the next periodic release
+  * @retval None
+  */
+void TaskSched_idle(uint32_t ticksToNextRelease)
+{
+	(void)ticksToNextRelease;
+	
+	if (true == Report_isDue())
+	{
+		/* the scheduler masked interrupts, the report runs without the mask and
+		 * returns without sleeping, the scheduler checks the tasks again */
+		__enable_irq();
+		Report_update();
+		__disable_irq();
+		return;
+	}
+	
+	__WFI();
+}
+
+#if defined(RT_KERNEL)
+/**
+  * @brief  Idle hook of the kernel, refreshes the report and sleeps
+  * @param  None
+  * @retval None
+  */
+void RtKernel_idle(void)
+{
+	if (true == Report_isDue())
+	{
+		Report_update();
+	}
+	
+	__WFI();
+}
+#endif
+
+/* Function definition section end -------------------------------------------------------*/
+
+/* Task table section start --------------------------------------------------------------*/
+
+/* Tasks only run when released, the core sleeps in between */
+static TaskSched_Task_st s_tasks_st[] = {
+	TASK_SCHED_TASK(Task_countUp, 1U, 0U, 1U),
+};
+
+/* Task table section end ----------------------------------------------------------------*/
+
+/* main function definition start --------------------------------------------------------*/
+
+/**
+  * @brief  The application entry point.
+  * @retval int
+  */
+int main(void)
+{
+#if defined(HEAP_MONITOR)
+	/* heap accounting from the first allocation on, read g_heapMon with Tools/heap_dump.py */
+	HeapMon_init();
+#endif
+	
+	/* SysTick_Handler() pushes to the queue from the first tick on */
+	(void)EventQueue_spscInit(&s_tickEvents_st, s_tickEventBuf_st, COUNTER_TICK_EVENTS);
+	
+	/* 1 ms HAL tick as the scheduler time base */
+	HAL_Init();
+	
+#if defined(FUNC_TRACE)
+	/* record the calls of the files built with -finstrument-functions */
+	FuncTrace_start();
+#endif
+	
+#if defined(PC_PROFILER)
+	/* whole-program hot spots, read g_pcProf with Tools/prof_dump.py */
+	if (false == PcProf_start())
+	{
+		Error_Handler();
+	}
+#endif
+	
+#if defined(IRQ_LATENCY)
+	/* worst-case interrupt response, read g_irqLat with Tools/irqlat_dump.py */
+	if (false == IrqLat_init())
+	{
+		Error_Handler();
+	}
+	IrqLat_run(IRQ_LAT_LOAD_NONE, 256U, 1U);
+	IrqLat_run(IRQ_LAT_LOAD_DMA, 256U, 2U);
+	IrqLat_run(IRQ_LAT_LOAD_FLASH, 256U, 32U);
+#endif
+	
+	/* the Keil startup painted the MSP in Reset_Handler, Report_update() reads it */
+	g_mspSize_u32 = StackWatch_getMspSize();
+	s_reportTick_u32 = HAL_GetTick();
+	
+	/* initialization */
+	Counter_resetCounter();
+	Counter_setCounterThres(1000U);
+	BSP_setOnBoardLedOff();
+	
+#if defined(RT_KERNEL)
+	/* same task as a kernel thread, the idle thread sleeps in between */
+	RtKernel_init();
+	StackWatch_paint(s_countStack_u32, COUNT_STACK_WORDS);
+	if (RT_KERNEL_INVALID_THREAD == RtKernel_createThread(Thread_countUp, NULL, s_countStack_u32,
+	                                                      COUNT_STACK_WORDS, 1U))
+	{
+		Error_Handler();
+	}
+	RtKernel_start();
+#else
+	if (false == TaskSched_init(s_tasks_st, sizeof(s_tasks_st) / sizeof(s_tasks_st[0])))
+	{
+		Error_Handler();
+	}
+	
+	/* run released tasks, sleep when none is ready */
+	TaskSched_run();
+#endif
 
 	return 0;
 }
 
+/**
+  * @brief  This function is executed in case of error occurrence.
+  * @retval None
+  */
+void Error_Handler(void)
+{
+	__disable_irq();
+	while (1)
+	{
+	}
+}
+
 /* main function definition end ----------------------------------------------------------*/
\ No newline at end of file
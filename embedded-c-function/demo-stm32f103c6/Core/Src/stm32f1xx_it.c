@@ -22,6 +22,9 @@
 #include "stm32f1xx_it.h"
 /* Private includes ----------------------------------------------------------*/
 /* USER CODE BEGIN Includes */
+#if defined(RT_KERNEL)
+#include "rt_kernel.h"
+#endif
 /* USER CODE END Includes */
 
 /* Private typedef -----------------------------------------------------------*/
@@ -138,6 +141,8 @@ void UsageFault_Handler(void)
   }
 }
 
+#if !defined(RT_KERNEL)
+/* SVC and PendSV belong to Kernel/rt_kernel.c when RT_KERNEL is defined */
 /**
   * @brief This function handles System service call via SWI instruction.
   */
@@ -150,6 +155,7 @@ void SVC_Handler(void)
 
   /* USER CODE END SVCall_IRQn 1 */
 }
+#endif
 
 /**
   * @brief This function handles Debug monitor.
@@ -164,6 +170,7 @@ void DebugMon_Handler(void)
   /* USER CODE END DebugMonitor_IRQn 1 */
 }
 
+#if !defined(RT_KERNEL)
 /**
   * @brief This function handles Pendable request for system service.
   */
@@ -176,6 +183,7 @@ void PendSV_Handler(void)
 
   /* USER CODE END PendSV_IRQn 1 */
 }
+#endif
 
 /**
   * @brief This function handles System tick timer.
@@ -187,6 +195,10 @@ void SysTick_Handler(void)
   /* USER CODE END SysTick_IRQn 0 */
   HAL_IncTick();
   /* USER CODE BEGIN SysTick_IRQn 1 */
+  Counter_tickFromIsr();
+#if defined(RT_KERNEL)
+  RtKernel_tick();
+#endif
 
   /* USER CODE END SysTick_IRQn 1 */
 }
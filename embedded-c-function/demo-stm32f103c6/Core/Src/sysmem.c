@@ -23,6 +23,9 @@
 /* Includes */
 #include <errno.h>
 #include <stdint.h>
+#if defined(HEAP_MONITOR)
+#include "heap_monitor.h"
+#endif
 
 /**
  * Pointer to the current high watermark of the heap usage
@@ -65,6 +68,15 @@ void *_sbrk(ptrdiff_t incr)
     __sbrk_heap_end = &_end;
   }
 
+#if defined(HEAP_MONITOR)
+  /* Account the heap end, the monitor also refuses growth while it probes */
+  if (false == HeapMon_onSbrk(__sbrk_heap_end, incr, max_heap))
+  {
+    errno = ENOMEM;
+    return (void *)-1;
+  }
+#endif
+
   /* Protect heap from growing into the reserved MSP stack */
   if (__sbrk_heap_end + incr > max_heap)
   {
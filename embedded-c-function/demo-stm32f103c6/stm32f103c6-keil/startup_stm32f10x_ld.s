@@ -35,6 +35,7 @@
 Stack_Size      EQU     0x00000400
 
                 AREA    STACK, NOINIT, READWRITE, ALIGN=3
+                EXPORT  Stack_Mem                  ; Stack bottom for stack_watch.c
 Stack_Mem       SPACE   Stack_Size
 __initial_sp
 
@@ -50,6 +51,19 @@ __heap_base
 Heap_Mem        SPACE   Heap_Size
 __heap_limit
 
+
+; <h> Arena Configuration
+;   <o>  Arena Size (in Bytes) <0x0-0xFFFFFFFF:8>
+; </h>
+
+Arena_Size      EQU     0x00000400
+
+                AREA    ARENA, NOINIT, READWRITE, ALIGN=3
+                EXPORT  Arena_Mem                  ; Scratch region of arena.c, removed
+                EXPORT  Arena_Limit                ; by the linker when nothing uses it
+Arena_Mem       SPACE   Arena_Size
+Arena_Limit
+
                 PRESERVE8
                 THUMB
 
@@ -132,6 +146,17 @@ Reset_Handler    PROC
                  EXPORT  Reset_Handler             [WEAK]
      IMPORT  __main
      IMPORT  SystemInit
+                 ; Paint the whole stack with STACK_WATCH_PATTERN for the
+                 ; high-water mark, nothing has been pushed yet
+                 LDR     R0, =Stack_Mem
+                 LDR     R1, =__initial_sp
+                 LDR     R2, =0xCDCDCDCD
+StackPaint
+                 CMP     R0, R1
+                 BHS     StackPainted
+                 STR     R2, [R0], #4
+                 B       StackPaint
+StackPainted
                  LDR     R0, =SystemInit
                  BLX     R0
                  LDR     R0, =__main
@@ -0,0 +1,230 @@
+/*****************************************************************************
+ * @file      stm32f1xx.h
+ * @author    Jet Station
+ * @brief     Host stand-in for the CMSIS device header, virtual core registers
+ * @date      [2026-10-17]
+ *
+ * Contact:
+ *   @website   https://jet-station.github.io/
+ *   @github    https://github.com/jet-station
+ *   @linkedin  https://www.linkedin.com/in/thien-ai-ho/
+ *   @email     thienaiho95@gmail.com
+ *
+ * @copyright  Copyright (c) 2026 Jet Station. All rights reserved.
+ *****************************************************************************/
+
+#ifndef __STM32F1XX_H__
+#define __STM32F1XX_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/* Only the registers and intrinsics used by the portable services. They are
+ * plain memory driven by the virtual clock of sim_time.c, which can trap
+ * the SysTick accesses to model the registers. Intrinsics are host
+ * equivalents: the simulation runs in one thread, so the barriers only have
+ * to stop the compiler */
+
+#define __IO volatile
+#define __ASM __asm__
+#define __INLINE inline
+#define __STATIC_INLINE static inline
+#define __weak __attribute__((weak))
+#define __WEAK __attribute__((weak))
+#define __USED __attribute__((used))
+
+#define __NVIC_PRIO_BITS (4U)
+
+typedef enum {
+	SVCall_IRQn = -5,
+	PendSV_IRQn = -2,
+	SysTick_IRQn = -1
+} IRQn_Type;
+
+typedef struct {
+	__IO uint32_t CTRL;
+	__IO uint32_t LOAD;
+	__IO uint32_t VAL;
+	__IO uint32_t CALIB;
+} SysTick_Type;
+
+typedef struct {
+	__IO uint32_t CPUID;
+	__IO uint32_t ICSR;
+	__IO uint32_t VTOR;
+	__IO uint32_t AIRCR;
+	__IO uint32_t SCR;
+	__IO uint32_t CCR;
+} SCB_Type;
+
+typedef struct {
+	__IO uint32_t CTRL;
+	__IO uint32_t CYCCNT;
+} DWT_Type;
+
+typedef struct {
+	__IO uint32_t DHCSR;
+	__IO uint32_t DCRSR;
+	__IO uint32_t DCRDR;
+	__IO uint32_t DEMCR;
+} CoreDebug_Type;
+
+extern SysTick_Type *g_simSysTick;
+extern SCB_Type g_simScb;
+extern DWT_Type g_simDwt;
+extern CoreDebug_Type g_simCoreDebug;
+
+#define SysTick (g_simSysTick)
+#define SCB (&g_simScb)
+#define DWT (&g_simDwt)
+#define CoreDebug (&g_simCoreDebug)
+
+#define SysTick_CTRL_COUNTFLAG_Msk (1UL << 16)
+#define SysTick_CTRL_CLKSOURCE_Msk (1UL << 2)
+#define SysTick_CTRL_TICKINT_Msk (1UL << 1)
+#define SysTick_CTRL_ENABLE_Msk (1UL << 0)
+#define SysTick_LOAD_RELOAD_Msk (0xFFFFFFUL)
+#define SCB_ICSR_PENDSVSET_Msk (1UL << 28)
+#define SCB_ICSR_PENDSVCLR_Msk (1UL << 27)
+#define SCB_ICSR_PENDSTSET_Msk (1UL << 26)
+#define DWT_CTRL_CYCCNTENA_Msk (1UL << 0)
+#define CoreDebug_DEMCR_TRCENA_Msk (1UL << 24)
+
+extern uint32_t SystemCoreClock;
+
+/* Virtual interrupt masks, see sim_time.c */
+extern uint32_t g_simPrimask;
+extern uint32_t g_simBasepri;
+
+/* Exclusive monitor: LDREX opens it, STREX and CLREX close it. An optional
+ * hook runs in front of every STREX and returns true when it played a
+ * nested interrupt, whose exception return clears the monitor */
+extern uint32_t g_simExclusive;
+extern bool (*g_simStrexHook)(void);
+
+/**
+  * @brief  Sleep until the next interrupt: advances the virtual clock by one tick
+  * @param  None
+  * @retval None
+  */
+void SimTime_waitForInterrupt(void);
+
+/**
+  * @brief  Take a pending SysTick exception once PRIMASK allows it
+  * @param  None
+  * @retval None
+  */
+void SimTime_servePending(void);
+
+static inline void __disable_irq(void)
+{
+	g_simPrimask = 1U;
+}
+
+static inline void __enable_irq(void)
+{
+	g_simPrimask = 0U;
+	SimTime_servePending();
+}
+
+static inline uint32_t __get_PRIMASK(void)
+{
+	return g_simPrimask;
+}
+
+static inline void __set_PRIMASK(uint32_t priMask)
+{
+	g_simPrimask = priMask;
+	SimTime_servePending();
+}
+
+static inline uint32_t __get_BASEPRI(void)
+{
+	return g_simBasepri;
+}
+
+static inline void __set_BASEPRI(uint32_t basePri)
+{
+	g_simBasepri = basePri;
+}
+
+/* Exception priorities have no effect on the host */
+static inline void NVIC_SetPriority(IRQn_Type IRQn, uint32_t priority)
+{
+	(void)IRQn;
+	(void)priority;
+}
+
+static inline void __WFI(void)
+{
+	SimTime_waitForInterrupt();
+}
+
+static inline void __DMB(void)
+{
+	__atomic_signal_fence(__ATOMIC_SEQ_CST);
+}
+
+static inline void __DSB(void)
+{
+	__atomic_signal_fence(__ATOMIC_SEQ_CST);
+}
+
+static inline void __ISB(void)
+{
+	__atomic_signal_fence(__ATOMIC_SEQ_CST);
+}
+
+static inline uint32_t __LDREXW(volatile uint32_t *addr)
+{
+	g_simExclusive = 1U;
+	return *addr;
+}
+
+static inline uint32_t __STREXW(uint32_t value, volatile uint32_t *addr)
+{
+	bool (*l_hook_pf)(void) = g_simStrexHook;
+
+	if (NULL != l_hook_pf)
+	{
+		/* The nested interrupt runs without the hook, it does not nest again */
+		g_simStrexHook = NULL;
+		if (l_hook_pf())
+		{
+			g_simExclusive = 0U;
+		}
+		g_simStrexHook = l_hook_pf;
+	}
+
+	if (0U == g_simExclusive)
+	{
+		return 1U;
+	}
+	g_simExclusive = 0U;
+	*addr = value;
+
+	return 0U;
+}
+
+static inline void __CLREX(void)
+{
+	g_simExclusive = 0U;
+}
+
+/* CLZ of 0 is 32 on the core, the builtin leaves it undefined */
+static inline uint8_t __CLZ(uint32_t value)
+{
+	return (0U == value) ? 32U : (uint8_t)__builtin_clz(value);
+}
+
+static inline uint32_t __RBIT(uint32_t value)
+{
+	value = ((value >> 1) & 0x55555555U) | ((value & 0x55555555U) << 1);
+	value = ((value >> 2) & 0x33333333U) | ((value & 0x33333333U) << 2);
+	value = ((value >> 4) & 0x0F0F0F0FU) | ((value & 0x0F0F0F0FU) << 4);
+
+	return __builtin_bswap32(value);
+}
+
+#endif
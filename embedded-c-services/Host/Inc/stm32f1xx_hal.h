@@ -0,0 +1,43 @@
+/*****************************************************************************
+ * @file      stm32f1xx_hal.h
+ * @author    Jet Station
+ * @brief     Host stand-in for the HAL time base on the virtual clock
+ * @date      [2026-10-17]
+ *
+ * Contact:
+ *   @website   https://jet-station.github.io/
+ *   @github    https://github.com/jet-station
+ *   @linkedin  https://www.linkedin.com/in/thien-ai-ho/
+ *   @email     thienaiho95@gmail.com
+ *
+ * @copyright  Copyright (c) 2026 Jet Station. All rights reserved.
+ *****************************************************************************/
+
+#ifndef __STM32F1XX_HAL_H__
+#define __STM32F1XX_HAL_H__
+
+#include <stdint.h>
+#include "stm32f1xx.h"
+
+#define HAL_MAX_DELAY (0xFFFFFFFFU)
+
+typedef enum {
+	HAL_TICK_FREQ_10HZ = 100U,
+	HAL_TICK_FREQ_100HZ = 10U,
+	HAL_TICK_FREQ_1KHZ = 1U,
+	HAL_TICK_FREQ_DEFAULT = HAL_TICK_FREQ_1KHZ
+} HAL_TickFreqTypeDef;
+
+#define PWR_MAINREGULATOR_ON (0x00000000U)
+#define PWR_SLEEPENTRY_WFI ((uint8_t)0x01)
+
+extern __IO uint32_t uwTick;
+extern HAL_TickFreqTypeDef uwTickFreq;
+
+void HAL_IncTick(void);
+uint32_t HAL_GetTick(void);
+HAL_TickFreqTypeDef HAL_GetTickFreq(void);
+void HAL_Delay(uint32_t Delay);
+void HAL_PWR_EnterSLEEPMode(uint32_t Regulator, uint8_t SLEEPEntry);
+
+#endif
@@ -0,0 +1,199 @@
+/*****************************************************************************
+ * @file      bench_counter.c
+ * @author    Jet Station
+ * @brief     Host cycle counters for the micro-benchmark framework
+ * @date      [2026-10-17]
+ *
+ * Contact:
+ *   @website   https://jet-station.github.io/
+ *   @github    https://github.com/jet-station
+ *   @linkedin  https://www.linkedin.com/in/thien-ai-ho/
+ *   @email     thienaiho95@gmail.com
+ *
+ * @copyright  Copyright (c) 2026 Jet Station. All rights reserved.
+ *****************************************************************************/
+
+/* sched_getcpu() and the CPU affinity macros */
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sched.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#include "bench_counter.h"
+
+static BenchCounter_Source_e s_source = BENCH_COUNTER_CLOCK;
+static int s_perfFd_i = -1;
+static uint32_t s_cyclesPerUs_u32 = 1000U;
+
+/**
+  * @brief  CLOCK_MONOTONIC in ns
+  * @param  None
+  * @retval uint64_t
+  */
+static uint64_t BenchCounter_clockNs(void)
+{
+	struct timespec l_ts_st;
+
+	(void)clock_gettime(CLOCK_MONOTONIC, &l_ts_st);
+
+	return ((uint64_t)l_ts_st.tv_sec * 1000000000ULL) + (uint64_t)l_ts_st.tv_nsec;
+}
+
+/**
+  * @brief  Full width value of the selected counter
+  * @param  None
+  * @retval uint64_t
+  */
+static uint64_t BenchCounter_read64(void)
+{
+	uint64_t l_value_u64 = 0U;
+
+	switch (s_source)
+	{
+#if defined(__x86_64__) || defined(__i386__)
+	case BENCH_COUNTER_TSC:
+	{
+		uint32_t l_lo_u32 = 0U;
+		uint32_t l_hi_u32 = 0U;
+
+		/* lfence keeps earlier instructions from drifting past the read,
+		 * like the in-order M3 pipeline does for DWT->CYCCNT */
+		__asm__ volatile ("lfence\n\trdtsc" : "=a" (l_lo_u32), "=d" (l_hi_u32) : : "memory");
+		l_value_u64 = ((uint64_t)l_hi_u32 << 32) | l_lo_u32;
+		break;
+	}
+#endif
+	case BENCH_COUNTER_PERF:
+		if (sizeof(l_value_u64) != read(s_perfFd_i, &l_value_u64, sizeof(l_value_u64)))
+		{
+			l_value_u64 = 0U;
+		}
+		break;
+
+	default:
+		l_value_u64 = BenchCounter_clockNs();
+		break;
+	}
+
+	return l_value_u64;
+}
+
+/**
+  * @brief  Open a user-mode core cycle counter for this thread
+  * @param  None
+  * @retval File descriptor or -1
+  */
+static int BenchCounter_openPerf(void)
+{
+	struct perf_event_attr l_attr_st;
+
+	memset(&l_attr_st, 0, sizeof(l_attr_st));
+	l_attr_st.type = PERF_TYPE_HARDWARE;
+	l_attr_st.size = sizeof(l_attr_st);
+	l_attr_st.config = PERF_COUNT_HW_CPU_CYCLES;
+	l_attr_st.exclude_kernel = 1U;
+	l_attr_st.exclude_hv = 1U;
+
+	return (int)syscall(SYS_perf_event_open, &l_attr_st, 0, -1, -1, 0UL);
+}
+
+/**
+  * @brief  Select the counter, pin the process and calibrate the frequency
+  * @param  source: requested counter
+  * @retval Counter actually used
+  */
+BenchCounter_Source_e BenchCounter_init(BenchCounter_Source_e source)
+{
+	cpu_set_t l_cpus_st;
+	uint64_t l_startNs_u64 = 0U;
+	uint64_t l_endNs_u64 = 0U;
+	uint64_t l_startCount_u64 = 0U;
+	uint64_t l_endCount_u64 = 0U;
+	int l_cpu_i = sched_getcpu();
+
+	/* A migration between the two reads of a sample mixes two counters */
+	if (l_cpu_i >= 0)
+	{
+		CPU_ZERO(&l_cpus_st);
+		CPU_SET(l_cpu_i, &l_cpus_st);
+		(void)sched_setaffinity(0, sizeof(l_cpus_st), &l_cpus_st);
+	}
+
+	if (BENCH_COUNTER_PERF == source)
+	{
+		s_perfFd_i = BenchCounter_openPerf();
+		if (s_perfFd_i < 0)
+		{
+			source = BENCH_COUNTER_TSC;
+		}
+	}
+#if !defined(__x86_64__) && !defined(__i386__)
+	if (BENCH_COUNTER_TSC == source)
+	{
+		source = BENCH_COUNTER_CLOCK;
+	}
+#endif
+	s_source = source;
+
+	/* Busy loop, so the core clock runs at its working frequency for perf */
+	l_startNs_u64 = BenchCounter_clockNs();
+	l_startCount_u64 = BenchCounter_read64();
+	do
+	{
+		l_endNs_u64 = BenchCounter_clockNs();
+	} while ((l_endNs_u64 - l_startNs_u64) < (BENCH_COUNTER_CALIB_MS * 1000000ULL));
+	l_endCount_u64 = BenchCounter_read64();
+
+	s_cyclesPerUs_u32 = (uint32_t)(((l_endCount_u64 - l_startCount_u64) * 1000ULL) /
+	                               (l_endNs_u64 - l_startNs_u64));
+	if (0U == s_cyclesPerUs_u32)
+	{
+		s_cyclesPerUs_u32 = 1U;
+	}
+
+	return s_source;
+}
+
+/**
+  * @brief  Low 32 bits of the selected counter
+  * @param  None
+  * @retval uint32_t
+  */
+uint32_t BenchCounter_read(void)
+{
+	return (uint32_t)BenchCounter_read64();
+}
+
+/**
+  * @brief  Counter ticks per microsecond
+  * @param  None
+  * @retval uint32_t
+  */
+uint32_t BenchCounter_getCyclesPerUs(void)
+{
+	return s_cyclesPerUs_u32;
+}
+
+/**
+  * @brief  Printable name of a counter
+  * @param  source: counter
+  * @retval const char *
+  */
+const char *BenchCounter_getName(BenchCounter_Source_e source)
+{
+	switch (source)
+	{
+	case BENCH_COUNTER_TSC:
+		return "rdtsc";
+	case BENCH_COUNTER_PERF:
+		return "perf cycles";
+	default:
+		return "CLOCK_MONOTONIC ns";
+	}
+}
@@ -0,0 +1,62 @@
+/*****************************************************************************
+ * @file      bench_counter.h
+ * @author    Jet Station
+ * @brief     Host cycle counters for the micro-benchmark framework
+ * @date      [2026-10-17]
+ *
+ * Contact:
+ *   @website   https://jet-station.github.io/
+ *   @github    https://github.com/jet-station
+ *   @linkedin  https://www.linkedin.com/in/thien-ai-ho/
+ *   @email     thienaiho95@gmail.com
+ *
+ * @copyright  Copyright (c) 2026 Jet Station. All rights reserved.
+ *****************************************************************************/
+
+#ifndef __BENCH_COUNTER_H__
+#define __BENCH_COUNTER_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Calibration time of the counter frequency against CLOCK_MONOTONIC */
+#define BENCH_COUNTER_CALIB_MS (50U)
+
+typedef enum {
+	BENCH_COUNTER_TSC = 0, /* rdtsc, constant rate on current x86-64 parts */
+	BENCH_COUNTER_PERF, /* perf_event_open core cycles of this thread, user mode only */
+	BENCH_COUNTER_CLOCK /* CLOCK_MONOTONIC in ns, portable fallback */
+} BenchCounter_Source_e;
+
+/**
+  * @brief  Select the counter, pin the process to its current CPU and
+  *         calibrate the counter frequency
+  * @param  source: requested counter
+  * @retval Counter actually used, perf falls back to the TSC when the
+  *         kernel refuses the event (containers, perf_event_paranoid)
+  */
+BenchCounter_Source_e BenchCounter_init(BenchCounter_Source_e source);
+
+/**
+  * @brief  Low 32 bits of the selected counter, BENCH_READ_CYCLES() of the
+  *         host build
+  * @param  None
+  * @retval uint32_t
+  */
+uint32_t BenchCounter_read(void);
+
+/**
+  * @brief  Counter ticks per microsecond measured by BenchCounter_init()
+  * @param  None
+  * @retval uint32_t
+  */
+uint32_t BenchCounter_getCyclesPerUs(void);
+
+/**
+  * @brief  Printable name of a counter
+  * @param  source: counter
+  * @retval const char *
+  */
+const char *BenchCounter_getName(BenchCounter_Source_e source);
+
+#endif
@@ -0,0 +1,92 @@
+/*****************************************************************************
+ * @file      bench_main.c
+ * @author    Jet Station
+ * @brief     Host runner of the target micro-benchmark suites
+ * @date      [2026-10-17]
+ *
+ * Contact:
+ *   @website   https://jet-station.github.io/
+ *   @github    https://github.com/jet-station
+ *   @linkedin  https://www.linkedin.com/in/thien-ai-ho/
+ *   @email     thienaiho95@gmail.com
+ *
+ * @copyright  Copyright (c) 2026 Jet Station. All rights reserved.
+ *****************************************************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "bench_counter.h"
+#include "micro_bench.h"
+#include "rect_layout.h"
+
+/* Same warm-up and sample count as Test_execTiming() on target */
+#define BENCH_HOST_WARMUP (8U)
+#define BENCH_HOST_ITERATIONS (64U)
+
+/**
+  * @brief  Run the benchmark suites and write g_benchResults
+  * @note   Usage: host_bench [tsc|perf|clock] [results.bin]
+  * @param  argc: argument count
+  * @param  argv: arguments
+  * @retval 0 on success
+  */
+int main(int argc, char *argv[])
+{
+	BenchCounter_Source_e l_source_e = BENCH_COUNTER_TSC;
+	BenchCounter_Source_e l_used_e = BENCH_COUNTER_TSC;
+	const char *l_dumpPath_pc = NULL;
+	FILE *l_dump_pst = NULL;
+
+	if (argc > 1)
+	{
+		if (0 == strcmp(argv[1], "perf"))
+		{
+			l_source_e = BENCH_COUNTER_PERF;
+		}
+		else if (0 == strcmp(argv[1], "clock"))
+		{
+			l_source_e = BENCH_COUNTER_CLOCK;
+		}
+	}
+	if (argc > 2)
+	{
+		l_dumpPath_pc = argv[2];
+	}
+
+	l_used_e = BenchCounter_init(l_source_e);
+	if (l_used_e != l_source_e)
+	{
+		printf("%s unavailable, check /proc/sys/kernel/perf_event_paranoid\n", BenchCounter_getName(l_source_e));
+	}
+	printf("counter: %s, %u counts/us\n", BenchCounter_getName(l_used_e), BenchCounter_getCyclesPerUs());
+
+	/* Same registration as the c-inline demo: the MaxFunc cases and the
+	 * kernel suite of every linked level come from the bench registry. The
+	 * target cycles/us from SystemCoreClock is replaced by the calibrated
+	 * host counter rate */
+	Bench_init();
+	g_benchResults.cyclesPerUs = BenchCounter_getCyclesPerUs();
+	RectLayout_init();
+	if (0U != Bench_runAll(BENCH_HOST_WARMUP, BENCH_HOST_ITERATIONS))
+	{
+		printf("%u cases skipped, raise BENCH_MAX_CASES (%u)\n", g_benchResults.skipped, BENCH_MAX_CASES);
+	}
+
+	/* Same layout as on target, readable with Tools/bench_dump.py --bin */
+	if (NULL != l_dumpPath_pc)
+	{
+		l_dump_pst = fopen(l_dumpPath_pc, "wb");
+		if (NULL == l_dump_pst)
+		{
+			perror(l_dumpPath_pc);
+			return 1;
+		}
+		(void)fwrite(&g_benchResults, sizeof(g_benchResults), 1U, l_dump_pst);
+		(void)fclose(l_dump_pst);
+	}
+
+	return 0;
+}
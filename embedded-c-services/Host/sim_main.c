@@ -0,0 +1,1366 @@
+/*****************************************************************************
+ * @file      sim_main.c
+ * @author    Jet Station
+ * @brief     Host simulation of the time services and demo state machines
+ * @date      [2026-10-17]
+ *
+ * Contact:
+ *   @website   https://jet-station.github.io/
+ *   @github    https://github.com/jet-station
+ *   @linkedin  https://www.linkedin.com/in/thien-ai-ho/
+ *   @email     thienaiho95@gmail.com
+ *
+ * @copyright  Copyright (c) 2026 Jet Station. All rights reserved.
+ *****************************************************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "stm32f1xx_hal.h"
+#include "sim_time.h"
+#include "mono_clock.h"
+#include "timer_wheel.h"
+#include "deferred_call.h"
+#include "tickless_idle.h"
+#include "task_scheduler.h"
+#include "event_queue.h"
+#include "macro_demo.h"
+#include "jitter_monitor.h"
+#include "mem_pool.h"
+#include "arena.h"
+#include "tlsf.h"
+#include "rt_kernel.h"
+
+/* Queue size of the event queue scenario, the largest batch the main
+ * loop takes per tick, and the SPSC start index a few events before the
+ * 32-bit index wrap. The main loop stalls for SIM_EVENT_STALL ticks every
+ * SIM_DEFER_STALL_EVERY, 1.5 events per tick on average overflow the queue */
+#define SIM_EVENT_SIZE (16U)
+#define SIM_EVENT_BATCH (8U)
+#define SIM_EVENT_START (0U - 40U)
+#define SIM_EVENT_STALL (2U * SIM_EVENT_SIZE)
+
+/* Number of periodic timers in the timer wheel scenario */
+#define SIM_TIMERS (64U)
+
+/* Longest run of a task of the scheduler scenario, in core cycles */
+#define SIM_TASK_MAX_CYCLES (2000U)
+
+/* Every SIM_DEFER_STALL_EVERY ticks the main loop of the deferred call
+ * scenario misses SIM_DEFER_STALL ticks, long enough to fill the queue */
+#define SIM_DEFER_STALL_EVERY (1000U)
+#define SIM_DEFER_STALL (10U)
+
+/* Blocks held at a time in the memory pool scenario, more than the pools
+ * have so that the classes run empty */
+#define SIM_POOL_HELD (64U)
+
+/* Storage and scope nesting of the arena scenario */
+#define SIM_ARENA_SIZE (2048U)
+#define SIM_ARENA_DEPTH (4U)
+
+/* Pool and live blocks of the TLSF scenario, Tlsf_check() runs every
+ * SIM_TLSF_CHECK operations */
+#define SIM_TLSF_SIZE (8192U)
+#define SIM_TLSF_HELD (96U)
+#define SIM_TLSF_CHECK (1000U)
+
+/* Threads of the kernel scenario, their priorities and stack size */
+#define SIM_KERNEL_THREADS (8U)
+#define SIM_KERNEL_STACK_WORDS (64U)
+
+/* The tickless scenario starts SIM_TICKLESS_LEAD ms before the uwTick
+ * rollover, another interrupt cuts every SIM_TICKLESS_WAKE_EVERY-th sleep
+ * short */
+#define SIM_TICKLESS_LEAD (10U * 60U * 1000U)
+#define SIM_TICKLESS_WAKE_EVERY (4U)
+
+/* Ticks before the uwTick rollover at which the scenarios start */
+#define SIM_ROLLOVER_LEAD (1000000U)
+
+/* Tick variables of the c-macro demo */
+uint32_t g_tickCount = 0U;
+uint32_t g_lastEventTick = 0U;
+
+/* Notification check of the c-macro demo */
+static uint32_t s_lastNotifyTick_u32 = 0U;
+static uint32_t s_notifyCount_u32 = 0U;
+static uint32_t s_notifyErrors_u32 = 0U;
+
+/* Timer of the timer wheel scenario */
+typedef struct {
+	TimerWheel_Timer_st node;
+	uint32_t expected; /* Tick of the next expiry */
+	uint32_t period;
+	uint32_t count;
+} Sim_Timer_st;
+
+static Sim_Timer_st s_timers[SIM_TIMERS];
+static uint32_t s_timerErrors_u32 = 0U;
+
+/* Model of the deferred call queue: sequence numbers of the accepted posts
+ * in the order they must run */
+static uint32_t s_deferModel_u32[DEFERRED_CALL_POSTS];
+static uint32_t s_deferHead_u32 = 0U;
+static uint32_t s_deferTail_u32 = 0U;
+static uint32_t s_deferSeq_u32 = 0U;
+static uint32_t s_deferDropped_u32 = 0U;
+static uint32_t s_deferErrors_u32 = 0U;
+
+/* Queues of the event queue scenario and their model: the sequence numbers
+ * of the accepted events in queue order */
+static EventQueue_Event_st s_spscBuf[SIM_EVENT_SIZE];
+static EventQueue_Slot_st s_mpscSlots[SIM_EVENT_SIZE];
+static EventQueue_Spsc_st s_spsc;
+static EventQueue_Mpsc_st s_mpsc;
+static bool s_eventMpsc_b = false;
+static uint32_t s_eventModel_u32[SIM_EVENT_SIZE];
+static uint32_t s_eventHead_u32 = 0U;
+static uint32_t s_eventTail_u32 = 0U;
+static uint32_t s_eventSeq_u32 = 0U;
+static uint32_t s_eventDropped_u32 = 0U;
+static uint32_t s_eventNested_u32 = 0U;
+static uint32_t s_eventErrors_u32 = 0U;
+static uint32_t s_toggleCount_u32 = 0U;
+
+/**
+  * @brief  Host clock in seconds, for the throughput figures
+  * @param  None
+  * @retval double
+  */
+static double Sim_hostSeconds(void)
+{
+	struct timespec l_ts;
+
+	(void)clock_gettime(CLOCK_MONOTONIC, &l_ts);
+
+	return (double)l_ts.tv_sec + ((double)l_ts.tv_nsec * 1e-9);
+}
+
+/**
+  * @brief  Print the result line of one scenario
+  * @param  name: scenario name
+  * @param  ticks: simulated ticks
+  * @param  seconds: host time
+  * @param  errors: number of timing errors
+  * @retval None
+  */
+static void Sim_report(const char *name, uint64_t ticks, double seconds, uint32_t errors)
+{
+	printf("%-12s %14llu ticks %8.3f s %10.2f Mticks/s %s (%u errors)\n", name,
+	       (unsigned long long)ticks, seconds, ((double)ticks / seconds) * 1e-6,
+	       (0U == errors) ? "PASS" : "FAIL", errors);
+}
+
+/**
+  * @brief  LED output of the c-macro demo, checks the 500 ms interval
+  * @param  None
+  * @retval None
+  */
+void BSP_Stm32f103BluePill_turnOnBoardLedsOn(void)
+{
+	if ((0U != s_notifyCount_u32) && (500U != (g_tickCount - s_lastNotifyTick_u32)))
+	{
+		s_notifyErrors_u32++;
+	}
+	s_lastNotifyTick_u32 = g_tickCount;
+	s_notifyCount_u32++;
+}
+
+/**
+  * @brief  c-macro demo state machine across the 32-bit tick rollover
+  * @param  ticks: simulated ticks
+  * @retval Number of errors
+  */
+static uint32_t Sim_macroDemo(uint64_t ticks)
+{
+	uint64_t l_index_u64 = 0U;
+	double l_start_d = Sim_hostSeconds();
+
+	g_tickCount = 0U - SIM_ROLLOVER_LEAD;
+	g_lastEventTick = g_tickCount;
+	s_notifyCount_u32 = 0U;
+	s_notifyErrors_u32 = 0U;
+
+	for (l_index_u64 = 0U; l_index_u64 < ticks; l_index_u64++)
+	{
+		MacroDemo_tickCountUp();
+	}
+
+	if (s_notifyCount_u32 != (uint32_t)(ticks / 500U))
+	{
+		s_notifyErrors_u32++;
+	}
+
+	Sim_report("macro_demo", ticks, Sim_hostSeconds() - l_start_d, s_notifyErrors_u32);
+
+	return s_notifyErrors_u32;
+}
+
+/**
+  * @brief  Expiry callback, checks the exact expiry tick
+  * @param  ctx: Sim_Timer_st
+  * @retval None
+  */
+static void Sim_timerExpired(void *ctx)
+{
+	Sim_Timer_st *l_timer_pst = (Sim_Timer_st *)ctx;
+
+	if (HAL_GetTick() != l_timer_pst->expected)
+	{
+		s_timerErrors_u32++;
+	}
+	l_timer_pst->expected += l_timer_pst->period;
+	l_timer_pst->count++;
+}
+
+/**
+  * @brief  Periodic timers of all wheel levels, processed on every tick
+  * @param  ticks: simulated ticks
+  * @retval Number of errors
+  */
+static uint32_t Sim_timerWheel(uint64_t ticks)
+{
+	Sim_Timer_st *l_timer_pst = NULL;
+	uint64_t l_index_u64 = 0U;
+	uint32_t l_index_u32 = 0U;
+	double l_start_d = 0.0;
+
+	SimTime_init(0U - SIM_ROLLOVER_LEAD);
+	TimerWheel_init(HAL_GetTick());
+	s_timerErrors_u32 = 0U;
+	srand(1U);
+
+	for (l_index_u32 = 0U; l_index_u32 < SIM_TIMERS; l_index_u32++)
+	{
+		l_timer_pst = &s_timers[l_index_u32];
+
+		/* Periods from 1 tick up to about 2^22 ticks, every level gets some */
+		l_timer_pst->period = 1U + ((uint32_t)rand() % (1UL << (2U + ((l_index_u32 % 11U) * 2U))));
+		l_timer_pst->expected = HAL_GetTick() + l_timer_pst->period;
+		l_timer_pst->count = 0U;
+		(void)TimerWheel_start(&l_timer_pst->node, l_timer_pst->period, l_timer_pst->period,
+		                       Sim_timerExpired, l_timer_pst);
+	}
+
+	l_start_d = Sim_hostSeconds();
+	for (l_index_u64 = 0U; l_index_u64 < ticks; l_index_u64++)
+	{
+		SimTime_tick();
+		TimerWheel_process(HAL_GetTick());
+	}
+
+	for (l_index_u32 = 0U; l_index_u32 < SIM_TIMERS; l_index_u32++)
+	{
+		l_timer_pst = &s_timers[l_index_u32];
+		if (l_timer_pst->count != (uint32_t)(ticks / l_timer_pst->period))
+		{
+			s_timerErrors_u32++;
+		}
+	}
+
+	Sim_report("timer_wheel", ticks, Sim_hostSeconds() - l_start_d, s_timerErrors_u32);
+
+	return s_timerErrors_u32;
+}
+
+static void Sim_deferCall(void *ctx);
+
+/**
+  * @brief  Post one call with the next sequence number and check the
+  *         result against the queue model
+  * @param  None
+  * @retval None
+  */
+static void Sim_deferPost(void)
+{
+	bool l_room_b = ((s_deferHead_u32 - s_deferTail_u32) < DEFERRED_CALL_POSTS);
+
+	if (l_room_b != DeferredCall_post(Sim_deferCall, (void *)(uintptr_t)s_deferSeq_u32))
+	{
+		s_deferErrors_u32++;
+	}
+
+	if (l_room_b)
+	{
+		s_deferModel_u32[s_deferHead_u32 % DEFERRED_CALL_POSTS] = s_deferSeq_u32;
+		s_deferHead_u32++;
+	}
+	else
+	{
+		s_deferDropped_u32++;
+	}
+	s_deferSeq_u32++;
+}
+
+/**
+  * @brief  Posted call, must run in posting order. Every fifth call posts
+  *         again, like an interrupt arriving while the main loop drains
+  * @param  ctx: sequence number
+  * @retval None
+  */
+static void Sim_deferCall(void *ctx)
+{
+	uint32_t l_seq_u32 = (uint32_t)(uintptr_t)ctx;
+
+	if ((s_deferHead_u32 == s_deferTail_u32) ||
+	    (l_seq_u32 != s_deferModel_u32[s_deferTail_u32 % DEFERRED_CALL_POSTS]))
+	{
+		s_deferErrors_u32++;
+		return;
+	}
+	s_deferTail_u32++;
+
+	if (0U == (l_seq_u32 % 5U))
+	{
+		Sim_deferPost();
+	}
+}
+
+/**
+  * @brief  SysTick hook of the deferred call scenario, posts 0..2 calls
+  * @param  None
+  * @retval None
+  */
+static void Sim_deferIsr(void)
+{
+	uint32_t l_count_u32 = (uint32_t)rand() % 3U;
+
+	while (0U != l_count_u32)
+	{
+		Sim_deferPost();
+		l_count_u32--;
+	}
+}
+
+/**
+  * @brief  Calls posted from the SysTick interrupt, run in order by the
+  *         main loop, and dropped while a stalled main loop lets the queue
+  *         fill up
+  * @param  ticks: simulated ticks
+  * @retval Number of errors
+  */
+static uint32_t Sim_deferredCall(uint64_t ticks)
+{
+	uint64_t l_index_u64 = 0U;
+	uint32_t l_dropped_u32 = DeferredCall_dropped();
+	double l_start_d = 0.0;
+
+	SimTime_init(0U - SIM_ROLLOVER_LEAD);
+	TimerWheel_init(HAL_GetTick());
+	SimTime_setTickHook(Sim_deferIsr);
+	s_deferHead_u32 = 0U;
+	s_deferTail_u32 = 0U;
+	s_deferSeq_u32 = 0U;
+	s_deferDropped_u32 = 0U;
+	s_deferErrors_u32 = 0U;
+	srand(1U);
+
+	l_start_d = Sim_hostSeconds();
+	for (l_index_u64 = 0U; l_index_u64 < ticks; l_index_u64++)
+	{
+		SimTime_tick();
+		if ((l_index_u64 % SIM_DEFER_STALL_EVERY) < (SIM_DEFER_STALL_EVERY - SIM_DEFER_STALL))
+		{
+			DeferredCall_process(HAL_GetTick());
+
+			/* Everything posted so far ran, including the calls posted
+			 * by the calls themselves */
+			if (s_deferHead_u32 != s_deferTail_u32)
+			{
+				s_deferErrors_u32++;
+				s_deferTail_u32 = s_deferHead_u32;
+			}
+		}
+	}
+	SimTime_setTickHook(NULL);
+	DeferredCall_process(HAL_GetTick());
+
+	/* Every dropped call counted, and the stalls did overflow the queue */
+	l_dropped_u32 = DeferredCall_dropped() - l_dropped_u32;
+	if ((l_dropped_u32 != s_deferDropped_u32) ||
+	    ((0U == l_dropped_u32) && (ticks >= SIM_DEFER_STALL_EVERY)))
+	{
+		s_deferErrors_u32++;
+	}
+
+	printf("  deferred calls: %u posted, %u dropped\n", s_deferSeq_u32, l_dropped_u32);
+	Sim_report("deferred", ticks, Sim_hostSeconds() - l_start_d, s_deferErrors_u32);
+
+	return s_deferErrors_u32;
+}
+
+/**
+  * @brief  Push one event with the next sequence number and update the
+  *         queue model in the order the pushes complete
+  * @param  None
+  * @retval None
+  */
+static void Sim_eventPush(void)
+{
+	uint32_t l_seq_u32 = s_eventSeq_u32++;
+	bool l_pushed_b = false;
+
+	if (s_eventMpsc_b)
+	{
+		l_pushed_b = EventQueue_mpscPush(&s_mpsc, 1U, l_seq_u32);
+	}
+	else
+	{
+		l_pushed_b = EventQueue_spscPush(&s_spsc, 1U, l_seq_u32);
+	}
+
+	/* A nested push may have taken the last free slot meanwhile, the
+	 * model is checked once this push is complete */
+	if (l_pushed_b)
+	{
+		if ((s_eventHead_u32 - s_eventTail_u32) >= SIM_EVENT_SIZE)
+		{
+			s_eventErrors_u32++;
+			return;
+		}
+		s_eventModel_u32[s_eventHead_u32 % SIM_EVENT_SIZE] = l_seq_u32;
+		s_eventHead_u32++;
+	}
+	else
+	{
+		if ((s_eventHead_u32 - s_eventTail_u32) != SIM_EVENT_SIZE)
+		{
+			s_eventErrors_u32++;
+		}
+		s_eventDropped_u32++;
+	}
+}
+
+/**
+  * @brief  STREX hook, now and then a higher priority ISR pushes between
+  *         LDREX and STREX of an interrupted push
+  * @param  None
+  * @retval true if the nested ISR ran
+  */
+static bool Sim_eventNestedIsr(void)
+{
+	if (0U != ((uint32_t)rand() % 4U))
+	{
+		return false;
+	}
+
+	Sim_eventPush();
+	s_eventNested_u32++;
+
+	return true;
+}
+
+/**
+  * @brief  SysTick hook of the event queue scenario, pushes 0..3 events
+  * @param  None
+  * @retval None
+  */
+static void Sim_eventIsr(void)
+{
+	uint32_t l_count_u32 = (uint32_t)rand() % 4U;
+
+	while (0U != l_count_u32)
+	{
+		Sim_eventPush();
+		l_count_u32--;
+	}
+}
+
+/**
+  * @brief  Events pushed from the SysTick hook, drained by the main loop in
+  *         batches of random size. A stalled main loop fills the queue
+  * @param  ticks: simulated ticks
+  * @param  mpsc: true for the multi-producer queue with nested pushes
+  * @retval Number of errors
+  */
+static uint32_t Sim_eventQueue(uint64_t ticks, bool mpsc)
+{
+	EventQueue_Event_st l_events_st[SIM_EVENT_BATCH];
+	uint64_t l_index_u64 = 0U;
+	uint32_t l_count_u32 = 0U;
+	uint32_t l_event_u32 = 0U;
+	uint32_t l_dropped_u32 = 0U;
+	double l_start_d = 0.0;
+
+	SimTime_init(0U - SIM_ROLLOVER_LEAD);
+	s_eventMpsc_b = mpsc;
+	s_eventHead_u32 = 0U;
+	s_eventTail_u32 = 0U;
+	s_eventSeq_u32 = 0U;
+	s_eventDropped_u32 = 0U;
+	s_eventNested_u32 = 0U;
+	s_eventErrors_u32 = 0U;
+	srand(1U);
+
+	if (mpsc)
+	{
+		(void)EventQueue_mpscInit(&s_mpsc, s_mpscSlots, SIM_EVENT_SIZE);
+		g_simStrexHook = Sim_eventNestedIsr;
+	}
+	else
+	{
+		/* head and tail run freely, start close to the 32-bit wrap */
+		(void)EventQueue_spscInit(&s_spsc, s_spscBuf, SIM_EVENT_SIZE);
+		s_spsc.head = SIM_EVENT_START;
+		s_spsc.tail = SIM_EVENT_START;
+	}
+	SimTime_setTickHook(Sim_eventIsr);
+
+	l_start_d = Sim_hostSeconds();
+	for (l_index_u64 = 0U; l_index_u64 <= ticks; l_index_u64++)
+	{
+		if (l_index_u64 < ticks)
+		{
+			SimTime_tick();
+		}
+		else
+		{
+			/* Final pass: no more events, drain what is left */
+			SimTime_setTickHook(NULL);
+			g_simStrexHook = NULL;
+		}
+
+		/* Stall, the queue fills up and drops */
+		if (((l_index_u64 % SIM_DEFER_STALL_EVERY) >= (SIM_DEFER_STALL_EVERY - SIM_EVENT_STALL)) &&
+		    (l_index_u64 < ticks))
+		{
+			continue;
+		}
+
+		do
+		{
+			l_count_u32 = 1U + ((uint32_t)rand() % SIM_EVENT_BATCH);
+			if (mpsc)
+			{
+				l_count_u32 = EventQueue_mpscPopBatch(&s_mpsc, l_events_st, l_count_u32);
+			}
+			else
+			{
+				l_count_u32 = EventQueue_spscPopBatch(&s_spsc, l_events_st, l_count_u32);
+			}
+
+			for (l_event_u32 = 0U; l_event_u32 < l_count_u32; l_event_u32++)
+			{
+				if ((s_eventHead_u32 == s_eventTail_u32) ||
+				    (l_events_st[l_event_u32].data != s_eventModel_u32[s_eventTail_u32 % SIM_EVENT_SIZE]))
+				{
+					s_eventErrors_u32++;
+					continue;
+				}
+				s_eventTail_u32++;
+			}
+		} while (0U != l_count_u32);
+
+		/* Batches until empty: every accepted event came out in order */
+		if (s_eventHead_u32 != s_eventTail_u32)
+		{
+			s_eventErrors_u32++;
+			s_eventTail_u32 = s_eventHead_u32;
+		}
+	}
+
+	/* Every lost event counted, and the stalls did fill the queue */
+	l_dropped_u32 = mpsc ? s_mpsc.dropped : s_spsc.dropped;
+	if ((l_dropped_u32 != s_eventDropped_u32) ||
+	    ((0U == l_dropped_u32) && (ticks >= SIM_DEFER_STALL_EVERY)))
+	{
+		s_eventErrors_u32++;
+	}
+
+	printf("  events: %u pushed, %u dropped, %u nested\n", s_eventSeq_u32, l_dropped_u32, s_eventNested_u32);
+	Sim_report(mpsc ? "event_mpsc" : "event_spsc", ticks, Sim_hostSeconds() - l_start_d, s_eventErrors_u32);
+
+	return s_eventErrors_u32;
+}
+
+/**
+  * @brief  Task body, consumes a random number of virtual cycles so that
+  *         the tasks released in the same tick start with some jitter
+  * @param  None
+  * @retval None
+  */
+static void Sim_task(void)
+{
+	SimTime_execute((uint32_t)rand() % SIM_TASK_MAX_CYCLES);
+}
+
+/**
+  * @brief  Scheduler releases of periodic tasks, dispatched on every tick
+  *         around the rollover, and their release jitter
+  * @param  ticks: simulated ticks
+  * @param  dumpPath: file for the jitter monitor table, NULL for none
+  * @retval Number of errors
+  */
+static uint32_t Sim_scheduler(uint64_t ticks, const char *dumpPath)
+{
+	static TaskSched_Task_st l_tasks_st[] = {
+		TASK_SCHED_TASK(Sim_task, 1U, 0U, 31U),
+		TASK_SCHED_TASK(Sim_task, 5U, 1U, 20U),
+		TASK_SCHED_TASK(Sim_task, 100U, 3U, 10U),
+		TASK_SCHED_TASK(Sim_task, 1000U, 7U, 1U),
+	};
+	uint32_t l_count_u32 = sizeof(l_tasks_st) / sizeof(l_tasks_st[0]);
+	uint64_t l_index_u64 = 0U;
+	uint32_t l_task_u32 = 0U;
+	uint32_t l_errors_u32 = 0U;
+	uint32_t l_expected_u32 = 0U;
+	JitterMon_Channel_st *l_channel_pst = NULL;
+	double l_start_d = 0.0;
+	FILE *l_dump_pst = NULL;
+
+	SimTime_init(0U - (uint32_t)(ticks / 2U));
+	if (false == TaskSched_init(l_tasks_st, l_count_u32))
+	{
+		l_errors_u32++;
+	}
+
+	l_start_d = Sim_hostSeconds();
+	for (l_index_u64 = 0U; l_index_u64 < ticks; l_index_u64++)
+	{
+		while (TaskSched_dispatch())
+		{
+		}
+		SimTime_tick();
+
+		/* SysTick wrapped once since the last tick */
+		if (0U == (SimTime_readSysTickCtrl() & SysTick_CTRL_COUNTFLAG_Msk))
+		{
+			l_errors_u32++;
+		}
+	}
+
+	for (l_task_u32 = 0U; l_task_u32 < l_count_u32; l_task_u32++)
+	{
+		/* Releases at offset, offset + period, ... before the last tick */
+		l_expected_u32 = (uint32_t)((ticks - 1U - l_tasks_st[l_task_u32].offset) / l_tasks_st[l_task_u32].period) + 1U;
+		if ((l_tasks_st[l_task_u32].runCount != l_expected_u32) || (0U != l_tasks_st[l_task_u32].missedReleases))
+		{
+			l_errors_u32++;
+		}
+
+		/* Dispatched after the tasks of higher priority released on the same
+		 * tick, each of them runs for less than SIM_TASK_MAX_CYCLES */
+		l_channel_pst = &g_jitterMon.channel[l_task_u32];
+		if ((l_channel_pst->activations != l_expected_u32) || (0U != l_channel_pst->deadlineMisses) ||
+		    (l_channel_pst->minJitter < 0) || (l_channel_pst->maxJitter >= (int32_t)(l_task_u32 * SIM_TASK_MAX_CYCLES + 100U)) ||
+		    (l_channel_pst->maxResponse >= ((l_task_u32 + 1U) * SIM_TASK_MAX_CYCLES + 100U)))
+		{
+			l_errors_u32++;
+		}
+		printf("  task %u: release jitter %d..%d cycles, response up to %u cycles\n", l_task_u32,
+		       l_channel_pst->minJitter, l_channel_pst->maxJitter, l_channel_pst->maxResponse);
+	}
+
+	Sim_report("scheduler", ticks, Sim_hostSeconds() - l_start_d, l_errors_u32);
+
+	/* Same layout as on target, readable with Tools/jitter_dump.py --bin */
+	if (NULL != dumpPath)
+	{
+		l_dump_pst = fopen(dumpPath, "wb");
+		if (NULL != l_dump_pst)
+		{
+			(void)fwrite(&g_jitterMon, sizeof(g_jitterMon), 1U, l_dump_pst);
+			(void)fclose(l_dump_pst);
+		}
+	}
+
+	return l_errors_u32;
+}
+
+/**
+  * @brief  LED toggle of the stm32f103c6 blink demo
+  * @param  ctx: unused
+  * @retval None
+  */
+static void Sim_toggleLed(void *ctx)
+{
+	(void)ctx;
+	s_toggleCount_u32++;
+}
+
+/**
+  * @brief  Main loop of the stm32f103c6 blink demo with tickless sleep across
+  *         the uwTick rollover, on the SysTick register traps. Checks that
+  *         uwTick follows the core clock and the 64-bit clock is continuous
+  * @param  ms: simulated time
+  * @retval Number of errors
+  */
+static uint32_t Sim_ticklessBlink(uint64_t ms)
+{
+	static TimerWheel_Timer_st l_blinkTimer;
+	uint32_t l_cyclesPerMs_u32 = SystemCoreClock / 1000U;
+	uint64_t l_startMs_u64 = 0U;
+	uint64_t l_lastMs_u64 = 0U;
+	uint64_t l_nowMs_u64 = 0U;
+	int64_t l_lag_i64 = 0;
+	int64_t l_lagMin_i64 = INT64_MAX;
+	int64_t l_lagMax_i64 = INT64_MIN;
+	uint32_t l_now_u32 = 0U;
+	uint32_t l_idleMs_u32 = 0U;
+	uint32_t l_sleeps_u32 = 0U;
+	uint32_t l_early_u32 = 0U;
+	uint32_t l_errors_u32 = 0U;
+	double l_start_d = 0.0;
+
+	/* TicklessIdle_sleep() relies on the side effects of the registers */
+	if (false == SimTime_setSysTickTraps(true))
+	{
+		printf("%-12s SKIP (no SysTick register traps on this host)\n", "tickless");
+		return 0U;
+	}
+
+	SimTime_init(0U - SIM_TICKLESS_LEAD);
+	TicklessIdle_init();
+	MonoClock_init();
+	TimerWheel_init(HAL_GetTick());
+	(void)TimerWheel_start(&l_blinkTimer, 200U, 200U, Sim_toggleLed, NULL);
+	s_toggleCount_u32 = 0U;
+	l_startMs_u64 = MonoClock_nowMs();
+	l_lastMs_u64 = l_startMs_u64;
+	srand(5U);
+
+	l_start_d = Sim_hostSeconds();
+	while (SimTime_getElapsedMs() < ms)
+	{
+		l_now_u32 = HAL_GetTick();
+		TimerWheel_process(l_now_u32);
+		l_idleMs_u32 = TimerWheel_ticksToNextExpiry(l_now_u32);
+
+		/* Another interrupt ends some sleeps early, at any point */
+		if ((0U == (l_sleeps_u32 % SIM_TICKLESS_WAKE_EVERY)) && (0U != l_idleMs_u32))
+		{
+			SimTime_setWakeup(1U + ((uint32_t)rand() % (l_idleMs_u32 * l_cyclesPerMs_u32)));
+			l_early_u32++;
+		}
+		(void)TicklessIdle_sleep(l_idleMs_u32);
+		SimTime_setWakeup(0U);
+		l_sleeps_u32++;
+
+		/* uwTick lags the core clock by the started tick only */
+		l_nowMs_u64 = MonoClock_nowMs();
+		l_lag_i64 = (int64_t)SimTime_getCycles() - (int64_t)((l_nowMs_u64 - l_startMs_u64) * l_cyclesPerMs_u32);
+		if (l_lag_i64 < l_lagMin_i64)
+		{
+			l_lagMin_i64 = l_lag_i64;
+		}
+		if (l_lag_i64 > l_lagMax_i64)
+		{
+			l_lagMax_i64 = l_lag_i64;
+		}
+		if ((l_nowMs_u64 < l_lastMs_u64) || (l_lag_i64 < 0) || (l_lag_i64 >= (int64_t)l_cyclesPerMs_u32))
+		{
+			l_errors_u32++;
+		}
+		l_lastMs_u64 = l_nowMs_u64;
+	}
+	TimerWheel_process(HAL_GetTick());
+
+	if (s_toggleCount_u32 != (uint32_t)((MonoClock_nowMs() - l_startMs_u64) / 200U))
+	{
+		l_errors_u32++;
+	}
+
+	printf("  tickless: %u sleeps, %u woken early, uwTick %lld..%lld cycles behind the core clock\n",
+	       l_sleeps_u32, l_early_u32, (long long)l_lagMin_i64, (long long)l_lagMax_i64);
+	Sim_report("tickless", SimTime_getElapsedMs(), Sim_hostSeconds() - l_start_d, l_errors_u32);
+	(void)SimTime_setSysTickTraps(false);
+
+	return l_errors_u32;
+}
+
+/**
+  * @brief  One allocation or free per tick from the size class pools, every
+  *         held block is filled with its slot number and checked on free
+  * @param  ticks: simulated ticks
+  * @retval Number of errors
+  */
+static uint32_t Sim_memPool(uint64_t ticks)
+{
+	static uint8_t *l_held_pu8[SIM_POOL_HELD];
+	static uint32_t l_size_u32[SIM_POOL_HELD];
+	const MemPool_Pool_st *l_pool_pst = NULL;
+	uint64_t l_index_u64 = 0U;
+	uint32_t l_slot_u32 = 0U;
+	uint32_t l_byte_u32 = 0U;
+	uint32_t l_class_u32 = 0U;
+	uint32_t l_heldCount_u32 = 0U;
+	uint32_t l_used_u32 = 0U;
+	uint32_t l_total_u32 = 0U;
+	uint32_t l_errors_u32 = 0U;
+	double l_start_d = 0.0;
+
+	MemPool_init();
+	srand(3U);
+
+	l_start_d = Sim_hostSeconds();
+	for (l_index_u64 = 0U; l_index_u64 < ticks; l_index_u64++)
+	{
+		l_slot_u32 = (uint32_t)rand() % SIM_POOL_HELD;
+		if (NULL == l_held_pu8[l_slot_u32])
+		{
+			l_size_u32[l_slot_u32] = 1U + ((uint32_t)rand() % 128U);
+			l_held_pu8[l_slot_u32] = (uint8_t *)MemPool_alloc(l_size_u32[l_slot_u32]);
+			if (NULL != l_held_pu8[l_slot_u32])
+			{
+				for (l_byte_u32 = 0U; l_byte_u32 < l_size_u32[l_slot_u32]; l_byte_u32++)
+				{
+					l_held_pu8[l_slot_u32][l_byte_u32] = (uint8_t)l_slot_u32;
+				}
+			}
+		}
+		else
+		{
+			/* A block handed out twice was overwritten by its other owner */
+			for (l_byte_u32 = 0U; l_byte_u32 < l_size_u32[l_slot_u32]; l_byte_u32++)
+			{
+				if (l_held_pu8[l_slot_u32][l_byte_u32] != (uint8_t)l_slot_u32)
+				{
+					l_errors_u32++;
+					break;
+				}
+			}
+			MemPool_free(l_held_pu8[l_slot_u32]);
+			l_held_pu8[l_slot_u32] = NULL;
+		}
+	}
+
+	/* The usage of all classes matches the blocks still held */
+	for (l_slot_u32 = 0U; l_slot_u32 < SIM_POOL_HELD; l_slot_u32++)
+	{
+		if (NULL != l_held_pu8[l_slot_u32])
+		{
+			l_heldCount_u32++;
+			MemPool_free(l_held_pu8[l_slot_u32]);
+			l_held_pu8[l_slot_u32] = NULL;
+		}
+	}
+	for (l_class_u32 = 0U; l_class_u32 < MemPool_getClassCount(); l_class_u32++)
+	{
+		l_pool_pst = MemPool_getClass(l_class_u32);
+		l_used_u32 += l_pool_pst->used;
+		l_total_u32 += l_pool_pst->blockCount;
+		printf("  pool %4u B: %3u blocks, peak %3u, %10u allocs, %10u empty\n", l_pool_pst->blockSize,
+		       l_pool_pst->blockCount, l_pool_pst->peakUsed, l_pool_pst->allocs, l_pool_pst->empty);
+	}
+	if ((0U != l_used_u32) || (l_heldCount_u32 > l_total_u32))
+	{
+		l_errors_u32++;
+	}
+
+	/* Every block is back on a free list */
+	for (l_slot_u32 = 0U; l_slot_u32 < l_total_u32; l_slot_u32++)
+	{
+		if (NULL == MemPool_alloc(1U))
+		{
+			l_errors_u32++;
+		}
+	}
+	if (NULL != MemPool_alloc(1U))
+	{
+		l_errors_u32++;
+	}
+
+	Sim_report("mem_pool", ticks, Sim_hostSeconds() - l_start_d, l_errors_u32);
+
+	return l_errors_u32;
+}
+
+/**
+  * @brief  One scope level of the arena scenario: fills a few allocations,
+  *         runs the inner levels and checks that its own blocks survived
+  * @param  arena: arena under test
+  * @param  depth: remaining nesting
+  * @retval Number of errors
+  */
+static uint32_t Sim_arenaScope(Arena_st *arena, uint32_t depth)
+{
+	uint8_t *l_block_pu8[3] = { NULL, NULL, NULL };
+	uint32_t l_size_u32[3] = { 0U, 0U, 0U };
+	uint32_t l_mark_u32 = Arena_mark(arena);
+	uint32_t l_index_u32 = 0U;
+	uint32_t l_byte_u32 = 0U;
+	uint32_t l_errors_u32 = 0U;
+
+	ARENA_SCOPE(arena)
+	{
+		for (l_index_u32 = 0U; l_index_u32 < 3U; l_index_u32++)
+		{
+			l_size_u32[l_index_u32] = 1U + ((uint32_t)rand() % 200U);
+			l_block_pu8[l_index_u32] = (uint8_t *)Arena_alloc(arena, l_size_u32[l_index_u32]);
+			if (NULL == l_block_pu8[l_index_u32])
+			{
+				continue;
+			}
+			if (0U != ((uintptr_t)l_block_pu8[l_index_u32] & (ARENA_ALIGN - 1U)))
+			{
+				l_errors_u32++;
+			}
+			for (l_byte_u32 = 0U; l_byte_u32 < l_size_u32[l_index_u32]; l_byte_u32++)
+			{
+				l_block_pu8[l_index_u32][l_byte_u32] = (uint8_t)(depth + l_index_u32);
+			}
+		}
+
+		if (depth > 1U)
+		{
+			l_errors_u32 += Sim_arenaScope(arena, 1U + ((uint32_t)rand() % (depth - 1U)));
+		}
+
+		for (l_index_u32 = 0U; l_index_u32 < 3U; l_index_u32++)
+		{
+			for (l_byte_u32 = 0U; (NULL != l_block_pu8[l_index_u32]) && (l_byte_u32 < l_size_u32[l_index_u32]);
+			     l_byte_u32++)
+			{
+				if (l_block_pu8[l_index_u32][l_byte_u32] != (uint8_t)(depth + l_index_u32))
+				{
+					l_errors_u32++;
+					break;
+				}
+			}
+		}
+	}
+
+	/* The scope released exactly its own allocations */
+	if (Arena_mark(arena) != l_mark_u32)
+	{
+		l_errors_u32++;
+	}
+
+	return l_errors_u32;
+}
+
+/**
+  * @brief  Nested arena scopes with random allocations on every tick, then
+  *         an overrun that the guards must report
+  * @param  ticks: simulated ticks
+  * @retval Number of errors
+  */
+static uint32_t Sim_arena(uint64_t ticks)
+{
+	static uint64_t l_storage_u64[SIM_ARENA_SIZE / 8U];
+	Arena_st l_arena;
+	uint8_t *l_block_pu8 = NULL;
+	uint64_t l_index_u64 = 0U;
+	uint32_t l_errors_u32 = 0U;
+	double l_start_d = 0.0;
+
+	(void)Arena_create(&l_arena, l_storage_u64, SIM_ARENA_SIZE);
+	srand(4U);
+
+	l_start_d = Sim_hostSeconds();
+	for (l_index_u64 = 0U; l_index_u64 < ticks; l_index_u64++)
+	{
+		l_errors_u32 += Sim_arenaScope(&l_arena, SIM_ARENA_DEPTH);
+	}
+
+	if ((0U != Arena_mark(&l_arena)) || (Arena_getPeak(&l_arena) > SIM_ARENA_SIZE) ||
+	    (0U != l_arena.corruptions))
+	{
+		l_errors_u32++;
+	}
+	printf("  arena %u B: peak %u B, %u failed allocations\n", SIM_ARENA_SIZE, Arena_getPeak(&l_arena),
+	       l_arena.failures);
+
+#if (0U != ARENA_GUARDS)
+	/* One byte past the rounded size lands on the guard */
+	l_block_pu8 = (uint8_t *)Arena_alloc(&l_arena, 10U);
+	l_block_pu8[16] = 0U;
+	if ((true == Arena_reset(&l_arena, 0U)) || (1U != l_arena.corruptions))
+	{
+		l_errors_u32++;
+	}
+#else
+	(void)l_block_pu8;
+#endif
+
+	Sim_report("arena", ticks, Sim_hostSeconds() - l_start_d, l_errors_u32);
+
+	return l_errors_u32;
+}
+
+/**
+  * @brief  Fill a TLSF block with the pattern of its slot
+  * @param  block: block
+  * @param  size: bytes
+  * @param  slot: slot number
+  * @retval None
+  */
+static void Sim_tlsfFill(uint8_t *block, uint32_t size, uint32_t slot)
+{
+	uint32_t l_byte_u32 = 0U;
+
+	for (l_byte_u32 = 0U; l_byte_u32 < size; l_byte_u32++)
+	{
+		block[l_byte_u32] = (uint8_t)(slot + l_byte_u32);
+	}
+}
+
+/**
+  * @brief  Check the pattern of a TLSF block
+  * @param  block: block
+  * @param  size: bytes
+  * @param  slot: slot number
+  * @retval true if the pattern is intact
+  */
+static bool Sim_tlsfVerify(const uint8_t *block, uint32_t size, uint32_t slot)
+{
+	uint32_t l_byte_u32 = 0U;
+
+	for (l_byte_u32 = 0U; l_byte_u32 < size; l_byte_u32++)
+	{
+		if (block[l_byte_u32] != (uint8_t)(slot + l_byte_u32))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+/**
+  * @brief  One TLSF malloc, realloc or free per tick with random sizes,
+  *         block contents and the heap structure checked along the way
+  * @param  ticks: simulated ticks
+  * @retval Number of errors
+  */
+static uint32_t Sim_tlsf(uint64_t ticks)
+{
+	static uint64_t l_pool_u64[SIM_TLSF_SIZE / 8U];
+	static uint8_t *l_held_pu8[SIM_TLSF_HELD];
+	static uint32_t l_size_u32[SIM_TLSF_HELD];
+	Tlsf_st l_heap;
+	Tlsf_Stats_st l_stats;
+	uint8_t *l_block_pu8 = NULL;
+	uint64_t l_index_u64 = 0U;
+	uint32_t l_slot_u32 = 0U;
+	uint32_t l_newSize_u32 = 0U;
+	uint32_t l_errors_u32 = 0U;
+	double l_start_d = 0.0;
+
+	(void)Tlsf_create(&l_heap, l_pool_u64, SIM_TLSF_SIZE);
+	srand(5U);
+
+	l_start_d = Sim_hostSeconds();
+	for (l_index_u64 = 0U; l_index_u64 < ticks; l_index_u64++)
+	{
+		l_slot_u32 = (uint32_t)rand() % SIM_TLSF_HELD;
+		/* Mostly small blocks, some up to 1 KB */
+		l_newSize_u32 = 1U + ((uint32_t)rand() % ((0U == ((uint32_t)rand() % 8U)) ? 1024U : 96U));
+
+		if (NULL == l_held_pu8[l_slot_u32])
+		{
+			l_held_pu8[l_slot_u32] = (uint8_t *)Tlsf_malloc(&l_heap, l_newSize_u32);
+			if (NULL != l_held_pu8[l_slot_u32])
+			{
+				if (0U != ((uintptr_t)l_held_pu8[l_slot_u32] & (TLSF_ALIGN - 1U)))
+				{
+					l_errors_u32++;
+				}
+				l_size_u32[l_slot_u32] = l_newSize_u32;
+				Sim_tlsfFill(l_held_pu8[l_slot_u32], l_newSize_u32, l_slot_u32);
+			}
+		}
+		else
+		{
+			if (false == Sim_tlsfVerify(l_held_pu8[l_slot_u32], l_size_u32[l_slot_u32], l_slot_u32))
+			{
+				l_errors_u32++;
+			}
+			if (0U == ((uint32_t)rand() % 4U))
+			{
+				/* realloc keeps the common part of the contents */
+				l_block_pu8 = (uint8_t *)Tlsf_realloc(&l_heap, l_held_pu8[l_slot_u32], l_newSize_u32);
+				if (NULL != l_block_pu8)
+				{
+					if (false == Sim_tlsfVerify(l_block_pu8, (l_newSize_u32 < l_size_u32[l_slot_u32]) ?
+					                                          l_newSize_u32 : l_size_u32[l_slot_u32], l_slot_u32))
+					{
+						l_errors_u32++;
+					}
+					l_held_pu8[l_slot_u32] = l_block_pu8;
+					l_size_u32[l_slot_u32] = l_newSize_u32;
+					Sim_tlsfFill(l_block_pu8, l_newSize_u32, l_slot_u32);
+				}
+			}
+			else
+			{
+				Tlsf_free(&l_heap, l_held_pu8[l_slot_u32]);
+				l_held_pu8[l_slot_u32] = NULL;
+			}
+		}
+
+		if (0U == (l_index_u64 % SIM_TLSF_CHECK))
+		{
+			l_errors_u32 += Tlsf_check(&l_heap);
+		}
+	}
+
+	Tlsf_getStats(&l_heap, &l_stats);
+	printf("  tlsf %u B: peak %u B used, now %u B in %u blocks, %u B free in %u blocks, "
+	       "largest %u B, fragmentation %u%%, %u failed\n", SIM_TLSF_SIZE, l_heap.peakUsedBytes,
+	       l_stats.usedBytes, l_stats.usedBlocks, l_stats.freeBytes, l_stats.freeBlocks, l_stats.largestFree,
+	       l_stats.fragmentation, l_heap.failures);
+	if ((l_stats.usedBytes != l_heap.usedBytes) || (0U != Tlsf_check(&l_heap)))
+	{
+		l_errors_u32++;
+	}
+
+	/* Everything freed merges back into the one block of the start */
+	for (l_slot_u32 = 0U; l_slot_u32 < SIM_TLSF_HELD; l_slot_u32++)
+	{
+		Tlsf_free(&l_heap, l_held_pu8[l_slot_u32]);
+		l_held_pu8[l_slot_u32] = NULL;
+	}
+	Tlsf_getStats(&l_heap, &l_stats);
+	if ((1U != l_stats.freeBlocks) || (0U != l_stats.usedBlocks) || (0U != l_heap.usedBytes) ||
+	    (0U != Tlsf_check(&l_heap)))
+	{
+		l_errors_u32++;
+	}
+
+	Sim_report("tlsf", ticks, Sim_hostSeconds() - l_start_d, l_errors_u32);
+
+	return l_errors_u32;
+}
+
+/* PendSV of the host kernel build, the switch without the registers */
+void PendSV_Handler(void);
+
+/**
+  * @brief  Take a pended context switch once nothing masks PendSV, as the
+  *         core does after the kernel call returns
+  * @param  None
+  * @retval None
+  */
+static void Sim_kernelSwitch(void)
+{
+	if ((0U != (SCB->ICSR & SCB_ICSR_PENDSVSET_Msk)) && (0U == g_simBasepri) && (0U == g_simPrimask))
+	{
+		SCB->ICSR &= ~SCB_ICSR_PENDSVSET_Msk;
+		PendSV_Handler();
+	}
+}
+
+/**
+  * @brief  Thread body of the kernel scenario, never runs on the host: the
+  *         scenario makes the kernel calls on behalf of the current thread
+  * @param  arg: unused
+  * @retval None
+  */
+static void Sim_kernelThread(void *arg)
+{
+	(void)arg;
+}
+
+/**
+  * @brief  Check the running thread after a kernel call
+  * @param  expected: thread id, RT_KERNEL_INVALID_THREAD for the idle thread
+  * @retval 1 if another thread runs, else 0
+  */
+static uint32_t Sim_kernelExpect(uint8_t expected)
+{
+	Sim_kernelSwitch();
+
+	return (RtKernel_getCurrentThread() == expected) ? 0U : 1U;
+}
+
+/**
+  * @brief  Semaphore hand-over and timeout, mutex priority inheritance
+  * @param  None
+  * @retval Number of errors
+  */
+static uint32_t Sim_kernelSync(void)
+{
+	static uint32_t l_stacks_u32[4][SIM_KERNEL_STACK_WORDS];
+	static const uint8_t l_prio_u8[4] = { 5U, 7U, 10U, 20U };
+	RtKernel_Sem_st l_sem;
+	RtKernel_Mutex_st l_mutex;
+	uint32_t l_index_u32 = 0U;
+	uint32_t l_errors_u32 = 0U;
+	const uint8_t l_low_u8 = 0U;
+	const uint8_t l_mid_u8 = 1U;
+	const uint8_t l_high_u8 = 2U;
+	const uint8_t l_top_u8 = 3U;
+
+	RtKernel_init();
+	for (l_index_u32 = 0U; l_index_u32 < 4U; l_index_u32++)
+	{
+		if (l_index_u32 != RtKernel_createThread(Sim_kernelThread, NULL, l_stacks_u32[l_index_u32],
+		                                         SIM_KERNEL_STACK_WORDS, l_prio_u8[l_index_u32]))
+		{
+			l_errors_u32++;
+		}
+	}
+	/* Priorities are unique */
+	if (RT_KERNEL_INVALID_THREAD != RtKernel_createThread(Sim_kernelThread, NULL, l_stacks_u32[0],
+	                                                      SIM_KERNEL_STACK_WORDS, l_prio_u8[0]))
+	{
+		l_errors_u32++;
+	}
+	RtKernel_start();
+	l_errors_u32 += Sim_kernelExpect(l_top_u8);
+
+	/* The give hands the count straight to the blocked waiter */
+	RtKernel_semInit(&l_sem, 0U, 1U);
+	(void)RtKernel_semTake(&l_sem, RT_KERNEL_WAIT_FOREVER);
+	l_errors_u32 += Sim_kernelExpect(l_high_u8);
+	RtKernel_semGive(&l_sem);
+	l_errors_u32 += Sim_kernelExpect(l_top_u8);
+
+	/* A timed take ends on the tick of its timeout, a later give counts up */
+	(void)RtKernel_semTake(&l_sem, 2U);
+	l_errors_u32 += Sim_kernelExpect(l_high_u8);
+	RtKernel_tick();
+	l_errors_u32 += Sim_kernelExpect(l_high_u8);
+	RtKernel_tick();
+	l_errors_u32 += Sim_kernelExpect(l_top_u8);
+	RtKernel_semGive(&l_sem);
+	if ((false == RtKernel_semTake(&l_sem, 0U)) || (true == RtKernel_semTake(&l_sem, 0U)))
+	{
+		l_errors_u32++;
+	}
+
+	/* The lowest thread locks, the middle one would preempt it while the
+	 * high one waits for the mutex, unless the owner inherits its priority */
+	RtKernel_mutexInit(&l_mutex);
+	RtKernel_sleep(50U);
+	l_errors_u32 += Sim_kernelExpect(l_high_u8);
+	RtKernel_sleep(3U);
+	l_errors_u32 += Sim_kernelExpect(l_mid_u8);
+	RtKernel_sleep(1U);
+	l_errors_u32 += Sim_kernelExpect(l_low_u8);
+	if (false == RtKernel_mutexLock(&l_mutex))
+	{
+		l_errors_u32++;
+	}
+	RtKernel_tick();
+	l_errors_u32 += Sim_kernelExpect(l_mid_u8);
+	RtKernel_tick();
+	RtKernel_tick();
+	l_errors_u32 += Sim_kernelExpect(l_high_u8);
+	(void)RtKernel_mutexLock(&l_mutex);
+	l_errors_u32 += Sim_kernelExpect(l_low_u8);
+
+	/* Unlock hands the mutex over and drops the inherited priority */
+	if ((false == RtKernel_mutexUnlock(&l_mutex)) || (l_high_u8 != l_mutex.owner))
+	{
+		l_errors_u32++;
+	}
+	l_errors_u32 += Sim_kernelExpect(l_high_u8);
+	if ((false == RtKernel_mutexUnlock(&l_mutex)) || (RT_KERNEL_INVALID_THREAD != l_mutex.owner))
+	{
+		l_errors_u32++;
+	}
+	RtKernel_sleep(100U);
+	l_errors_u32 += Sim_kernelExpect(l_mid_u8);
+
+	return l_errors_u32;
+}
+
+/**
+  * @brief  Kernel ready queue and delay list: on every tick the running
+  *         threads go to sleep for random times, the kernel must always run
+  *         the highest priority thread whose sleep is over
+  * @param  ticks: simulated ticks
+  * @retval Number of errors
+  */
+static uint32_t Sim_rtKernel(uint64_t ticks)
+{
+	static uint32_t l_stacks_u32[SIM_KERNEL_THREADS][SIM_KERNEL_STACK_WORDS];
+	uint32_t l_wake_u32[SIM_KERNEL_THREADS];
+	uint8_t l_prio_u8[SIM_KERNEL_THREADS];
+	uint64_t l_index_u64 = 0U;
+	uint32_t l_thread_u32 = 0U;
+	uint32_t l_now_u32 = 0U;
+	uint32_t l_errors_u32 = 0U;
+	uint8_t l_current_u8 = 0U;
+	uint8_t l_expected_u8 = 0U;
+	double l_start_d = Sim_hostSeconds();
+
+	SimTime_init(0U);
+	l_errors_u32 += Sim_kernelSync();
+
+	RtKernel_init();
+	srand(6U);
+	for (l_thread_u32 = 0U; l_thread_u32 < SIM_KERNEL_THREADS; l_thread_u32++)
+	{
+		/* Priorities unique and out of creation order */
+		l_prio_u8[l_thread_u32] = (uint8_t)(((l_thread_u32 * 7U) + 3U) % RT_KERNEL_PRIORITIES);
+		l_wake_u32[l_thread_u32] = 0U;
+		(void)RtKernel_createThread(Sim_kernelThread, NULL, l_stacks_u32[l_thread_u32], SIM_KERNEL_STACK_WORDS,
+		                            l_prio_u8[l_thread_u32]);
+	}
+	RtKernel_start();
+
+	for (l_index_u64 = 0U; l_index_u64 < ticks; l_index_u64++)
+	{
+		/* Some of the ready threads sleep, each one the moment it runs */
+		l_current_u8 = RtKernel_getCurrentThread();
+		while ((RT_KERNEL_INVALID_THREAD != l_current_u8) && (0U != ((uint32_t)rand() % 4U)))
+		{
+			l_wake_u32[l_current_u8] = RtKernel_getTicks() + 1U + ((uint32_t)rand() % 16U);
+			RtKernel_sleep(l_wake_u32[l_current_u8] - RtKernel_getTicks());
+			Sim_kernelSwitch();
+			l_current_u8 = RtKernel_getCurrentThread();
+		}
+
+		RtKernel_tick();
+		l_now_u32 = RtKernel_getTicks();
+
+		l_expected_u8 = RT_KERNEL_INVALID_THREAD;
+		for (l_thread_u32 = 0U; l_thread_u32 < SIM_KERNEL_THREADS; l_thread_u32++)
+		{
+			if (MonoClock_isDue32(l_now_u32, l_wake_u32[l_thread_u32]) &&
+			    ((RT_KERNEL_INVALID_THREAD == l_expected_u8) || (l_prio_u8[l_thread_u32] > l_prio_u8[l_expected_u8])))
+			{
+				l_expected_u8 = (uint8_t)l_thread_u32;
+			}
+		}
+		l_errors_u32 += Sim_kernelExpect(l_expected_u8);
+	}
+
+	Sim_report("rt_kernel", ticks, Sim_hostSeconds() - l_start_d, l_errors_u32);
+
+	return l_errors_u32;
+}
+
+/**
+  * @brief  Run all scenarios
+  * @param  argc: argument count
+  * @param  argv: optional number of ticks per scenario and jitter dump file
+  * @retval 0 if every scenario passed
+  */
+int main(int argc, char *argv[])
+{
+	uint64_t l_ticks_u64 = 10000000U;
+	uint32_t l_errors_u32 = 0U;
+	const char *l_dumpPath_pc = NULL;
+
+	if (argc > 1)
+	{
+		l_ticks_u64 = strtoull(argv[1], NULL, 0);
+	}
+	if (argc > 2)
+	{
+		l_dumpPath_pc = argv[2];
+	}
+
+	l_errors_u32 += Sim_macroDemo(l_ticks_u64);
+	l_errors_u32 += Sim_timerWheel(l_ticks_u64);
+	l_errors_u32 += Sim_deferredCall(l_ticks_u64);
+	l_errors_u32 += Sim_eventQueue(l_ticks_u64, false);
+	l_errors_u32 += Sim_eventQueue(l_ticks_u64, true);
+	l_errors_u32 += Sim_scheduler(l_ticks_u64, l_dumpPath_pc);
+	l_errors_u32 += Sim_memPool(l_ticks_u64);
+	l_errors_u32 += Sim_arena(l_ticks_u64);
+	l_errors_u32 += Sim_tlsf(l_ticks_u64);
+	l_errors_u32 += Sim_rtKernel(l_ticks_u64);
+
+	/* Blinking from 10 minutes before to 10 minutes after the rollover */
+	l_errors_u32 += Sim_ticklessBlink(2ULL * SIM_TICKLESS_LEAD);
+
+	return (0U == l_errors_u32) ? 0 : 1;
+}
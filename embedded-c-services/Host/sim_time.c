@@ -0,0 +1,568 @@
+/*****************************************************************************
+ * @file      sim_time.c
+ * @author    Jet Station
+ * @brief     Virtual clock for the host simulation of the time services
+ * @date      [2026-10-17]
+ *
+ * Contact:
+ *   @website   https://jet-station.github.io/
+ *   @github    https://github.com/jet-station
+ *   @linkedin  https://www.linkedin.com/in/thien-ai-ho/
+ *   @email     thienaiho95@gmail.com
+ *
+ * @copyright  Copyright (c) 2026 Jet Station. All rights reserved.
+ *****************************************************************************/
+
+/* The SysTick register traps need x86-64 Linux signals */
+#if defined(__x86_64__) && defined(__linux__)
+#define SIM_TIME_TRAPS (1U)
+#else
+#define SIM_TIME_TRAPS (0U)
+#endif
+
+#if (1U == SIM_TIME_TRAPS)
+/* REG_ERR and REG_EFL of the signal context */
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#if (1U == SIM_TIME_TRAPS)
+#include <signal.h>
+#include <ucontext.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#endif
+#include "stm32f1xx_hal.h"
+#include "sim_time.h"
+
+/* Trap flag of RFLAGS: the CPU raises SIGTRAP after one instruction */
+#define SIM_TIME_EFLAGS_TF (0x100)
+
+/* Page fault error code bit of a write access */
+#define SIM_TIME_PF_WRITE (0x2)
+
+/* Word index of the SysTick registers on their page */
+#define SIM_TIME_ST_CTRL (0U)
+#define SIM_TIME_ST_LOAD (1U)
+#define SIM_TIME_ST_VAL (2U)
+
+/* Core cycles of one SysTick register access, stands in for the
+ * instructions around it */
+#define SIM_TIME_ACCESS_CYCLES (2U)
+
+/* Core cycles from a wakeup event to the first instruction after WFI */
+#define SIM_TIME_WAKE_CYCLES (6U)
+
+/* SysTick registers, counted down in place as the virtual clock runs. Code
+ * under test reads them as plain memory, its writes have no side effects */
+static SysTick_Type s_sysTick;
+
+/* Core registers of the simulated device. With the register traps on,
+ * SysTick is a page without access rights instead: every access traps into
+ * the model below, which gives CTRL, LOAD and VAL their side effects */
+SysTick_Type *g_simSysTick = &s_sysTick;
+SCB_Type g_simScb;
+DWT_Type g_simDwt;
+CoreDebug_Type g_simCoreDebug;
+uint32_t SystemCoreClock = SIM_TIME_CORE_CLOCK;
+uint32_t g_simPrimask = 0U;
+uint32_t g_simBasepri = 0U;
+uint32_t g_simExclusive = 0U;
+bool (*g_simStrexHook)(void) = NULL;
+
+/* HAL time base */
+__IO uint32_t uwTick = 0U;
+HAL_TickFreqTypeDef uwTickFreq = HAL_TICK_FREQ_DEFAULT;
+
+static SimTime_Hook s_tickHook = NULL;
+
+/* Core cycles since SimTime_init(), DWT->CYCCNT follows it. Code may advance
+ * DWT->CYCCNT to model its execution time, the clock catches up with it on
+ * the next tick or register trap. SimTime_execute() moves SysTick->VAL along at once */
+static uint64_t s_cycles_u64 = 0U;
+
+/* Cycle of the next interrupt other than SysTick, 0 for none */
+static uint64_t s_wakeup_u64 = 0U;
+
+/* SysTick exception pending, PENDSTSET, and the cycle s_sysTick is at */
+static bool s_stPending_b = false;
+static uint64_t s_stSync_u64 = 0U;
+
+#if (1U == SIM_TIME_TRAPS)
+/* Protected SysTick page and the access being single-stepped */
+static SysTick_Type *s_trapPage_pst = NULL;
+static uint32_t s_trapWord_u32 = 0U;
+static bool s_trapWrite_b = false;
+static size_t s_pageSize = 0U;
+#endif
+
+/**
+  * @brief  Run the SysTick counter up to the current cycle
+  * @note   Counts down to 0, sets COUNTFLAG and pends the exception on the
+  *         step from 1 to 0, reloads from LOAD on the following clock
+  * @param  None
+  * @retval None
+  */
+static void SimTime_syncSysTick(void)
+{
+	uint64_t l_elapsed_u64 = s_cycles_u64 - s_stSync_u64;
+
+	s_stSync_u64 = s_cycles_u64;
+	if (0U == (s_sysTick.CTRL & SysTick_CTRL_ENABLE_Msk))
+	{
+		return;
+	}
+
+	while (0U != l_elapsed_u64)
+	{
+		if (0U == s_sysTick.VAL)
+		{
+			/* A reload value of 0 leaves the counter at 0 */
+			if (0U == s_sysTick.LOAD)
+			{
+				return;
+			}
+			s_sysTick.VAL = s_sysTick.LOAD;
+			l_elapsed_u64--;
+		}
+		else if (l_elapsed_u64 < s_sysTick.VAL)
+		{
+			s_sysTick.VAL -= (uint32_t)l_elapsed_u64;
+			l_elapsed_u64 = 0U;
+		}
+		else
+		{
+			l_elapsed_u64 -= s_sysTick.VAL;
+			s_sysTick.VAL = 0U;
+			s_sysTick.CTRL |= SysTick_CTRL_COUNTFLAG_Msk;
+			if (0U != (s_sysTick.CTRL & SysTick_CTRL_TICKINT_Msk))
+			{
+				s_stPending_b = true;
+				g_simScb.ICSR |= SCB_ICSR_PENDSTSET_Msk;
+			}
+		}
+	}
+}
+
+/**
+  * @brief  Cycles until the counter requests the next SysTick exception
+  * @param  None
+  * @retval 0 if SysTick will not interrupt
+  */
+static uint64_t SimTime_cyclesToSysTick(void)
+{
+	if ((0U == (s_sysTick.CTRL & SysTick_CTRL_ENABLE_Msk)) ||
+	    (0U == (s_sysTick.CTRL & SysTick_CTRL_TICKINT_Msk)))
+	{
+		return 0U;
+	}
+	if (0U == s_sysTick.VAL)
+	{
+		return (0U == s_sysTick.LOAD) ? 0U : ((uint64_t)s_sysTick.LOAD + 1U);
+	}
+
+	return s_sysTick.VAL;
+}
+
+/**
+  * @brief  Let core cycles pass
+  * @param  cycles: number of cycles
+  * @retval None
+  */
+static void SimTime_run(uint64_t cycles)
+{
+	s_cycles_u64 += cycles;
+	g_simDwt.CYCCNT = (uint32_t)s_cycles_u64;
+	SimTime_syncSysTick();
+}
+
+/**
+  * @brief  Let the cycles pass that code modelled on DWT->CYCCNT
+  * @param  None
+  * @retval None
+  */
+static void SimTime_catchUp(void)
+{
+	uint32_t l_ahead_u32 = g_simDwt.CYCCNT - (uint32_t)s_cycles_u64;
+
+	if ((0U != l_ahead_u32) && (l_ahead_u32 < 0x80000000U))
+	{
+		SimTime_run(l_ahead_u32);
+	}
+}
+
+#if (1U == SIM_TIME_TRAPS)
+/**
+  * @brief  SIGSEGV on the SysTick page: present the register values, then
+  *         let the access run as a single step
+  * @param  sig: SIGSEGV
+  * @param  info: faulting address
+  * @param  context: signal context of the access
+  * @retval None
+  */
+static void SimTime_onAccess(int sig, siginfo_t *info, void *context)
+{
+	ucontext_t *l_uc_pst = (ucontext_t *)context;
+	uintptr_t l_offset_u = (uintptr_t)info->si_addr - (uintptr_t)s_trapPage_pst;
+
+	if (l_offset_u >= sizeof(SysTick_Type))
+	{
+		/* A real fault: crash on the next attempt */
+		(void)signal(sig, SIG_DFL);
+		return;
+	}
+
+	s_trapWord_u32 = (uint32_t)(l_offset_u / sizeof(uint32_t));
+	s_trapWrite_b = (0 != (l_uc_pst->uc_mcontext.gregs[REG_ERR] & SIM_TIME_PF_WRITE));
+
+	SimTime_catchUp();
+	SimTime_syncSysTick();
+	(void)mprotect(s_trapPage_pst, s_pageSize, PROT_READ | PROT_WRITE);
+	*s_trapPage_pst = s_sysTick;
+	s_trapPage_pst->CALIB = 0U;
+
+	l_uc_pst->uc_mcontext.gregs[REG_EFL] |= SIM_TIME_EFLAGS_TF;
+}
+
+/**
+  * @brief  SIGTRAP after the access: apply its side effects and lock the
+  *         page again
+  * @param  sig: SIGTRAP
+  * @param  info: unused
+  * @param  context: signal context after the access
+  * @retval None
+  */
+static void SimTime_onStep(int sig, siginfo_t *info, void *context)
+{
+	ucontext_t *l_uc_pst = (ucontext_t *)context;
+	uint32_t l_value_u32 = 0U;
+
+	(void)sig;
+	(void)info;
+	l_uc_pst->uc_mcontext.gregs[REG_EFL] &= ~(greg_t)SIM_TIME_EFLAGS_TF;
+
+	if (s_trapWrite_b)
+	{
+		l_value_u32 = ((volatile uint32_t *)s_trapPage_pst)[s_trapWord_u32];
+		if (SIM_TIME_ST_CTRL == s_trapWord_u32)
+		{
+			/* COUNTFLAG is read-only, it survives the write */
+			s_sysTick.CTRL = (s_sysTick.CTRL & SysTick_CTRL_COUNTFLAG_Msk) |
+			                 (l_value_u32 & (SysTick_CTRL_CLKSOURCE_Msk | SysTick_CTRL_TICKINT_Msk |
+			                                 SysTick_CTRL_ENABLE_Msk));
+		}
+		else if (SIM_TIME_ST_LOAD == s_trapWord_u32)
+		{
+			s_sysTick.LOAD = l_value_u32 & SysTick_LOAD_RELOAD_Msk;
+		}
+		else if (SIM_TIME_ST_VAL == s_trapWord_u32)
+		{
+			/* Any write clears the counter and COUNTFLAG */
+			s_sysTick.VAL = 0U;
+			s_sysTick.CTRL &= ~SysTick_CTRL_COUNTFLAG_Msk;
+		}
+		else
+		{
+			/* CALIB is read-only */
+		}
+	}
+	else if (SIM_TIME_ST_CTRL == s_trapWord_u32)
+	{
+		/* Reading CTRL clears COUNTFLAG */
+		s_sysTick.CTRL &= ~SysTick_CTRL_COUNTFLAG_Msk;
+	}
+	else
+	{
+	}
+
+	(void)mprotect(s_trapPage_pst, s_pageSize, PROT_NONE);
+	SimTime_run(SIM_TIME_ACCESS_CYCLES);
+}
+
+/**
+  * @brief  Map the SysTick page and install the access traps, once
+  * @param  None
+  * @retval None
+  */
+static void SimTime_mapSysTick(void)
+{
+	struct sigaction l_action;
+
+	if (NULL != s_trapPage_pst)
+	{
+		return;
+	}
+
+	s_pageSize = (size_t)sysconf(_SC_PAGESIZE);
+	s_trapPage_pst = (SysTick_Type *)mmap(NULL, s_pageSize, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (MAP_FAILED == (void *)s_trapPage_pst)
+	{
+		perror("mmap");
+		exit(2);
+	}
+
+	l_action.sa_flags = SA_SIGINFO;
+	(void)sigemptyset(&l_action.sa_mask);
+	l_action.sa_sigaction = SimTime_onAccess;
+	(void)sigaction(SIGSEGV, &l_action, NULL);
+	l_action.sa_sigaction = SimTime_onStep;
+	(void)sigaction(SIGTRAP, &l_action, NULL);
+}
+#endif
+
+/**
+  * @brief  Reset the virtual clock and the core registers
+  * @param  startTick: initial uwTick
+  * @retval None
+  */
+void SimTime_init(uint32_t startTick)
+{
+	/* SysTick as left by HAL_InitTick(), one tick ahead */
+	s_sysTick.LOAD = (SystemCoreClock / 1000U) - 1U;
+	s_sysTick.VAL = s_sysTick.LOAD;
+	s_sysTick.CTRL = SysTick_CTRL_CLKSOURCE_Msk | SysTick_CTRL_TICKINT_Msk | SysTick_CTRL_ENABLE_Msk;
+	s_sysTick.CALIB = 0U;
+	s_stPending_b = false;
+	s_stSync_u64 = 0U;
+
+	g_simScb.ICSR = 0U;
+	g_simDwt.CYCCNT = 0U;
+	g_simPrimask = 0U;
+	g_simBasepri = 0U;
+	g_simExclusive = 0U;
+	g_simStrexHook = NULL;
+	s_cycles_u64 = 0U;
+	s_wakeup_u64 = 0U;
+
+	uwTick = startTick;
+	uwTickFreq = HAL_TICK_FREQ_DEFAULT;
+	s_tickHook = NULL;
+}
+
+/**
+  * @brief  Switch the SysTick register traps on or off
+  * @param  enable: true to trap every access of the code under test
+  * @retval false if this host has no register traps
+  */
+bool SimTime_setSysTickTraps(bool enable)
+{
+#if (1U == SIM_TIME_TRAPS)
+	if (enable)
+	{
+		SimTime_mapSysTick();
+		g_simSysTick = s_trapPage_pst;
+	}
+	else
+	{
+		g_simSysTick = &s_sysTick;
+	}
+
+	return true;
+#else
+	g_simSysTick = &s_sysTick;
+
+	return (false == enable);
+#endif
+}
+
+/**
+  * @brief  Read SysTick->CTRL as the core does: COUNTFLAG clears on the read
+  * @param  None
+  * @retval uint32_t
+  */
+uint32_t SimTime_readSysTickCtrl(void)
+{
+	uint32_t l_ctrl_u32 = 0U;
+
+	SimTime_catchUp();
+	l_ctrl_u32 = s_sysTick.CTRL;
+	s_sysTick.CTRL &= ~SysTick_CTRL_COUNTFLAG_Msk;
+
+	return l_ctrl_u32;
+}
+
+/**
+  * @brief  Let code under test run for some core cycles, SysTick counts on
+  * @param  cycles: number of cycles
+  * @retval None
+  */
+void SimTime_execute(uint32_t cycles)
+{
+	SimTime_catchUp();
+	SimTime_run(cycles);
+}
+
+/**
+  * @brief  Function run from the virtual SysTick_Handler()
+  * @param  hook: hook or NULL
+  * @retval None
+  */
+void SimTime_setTickHook(SimTime_Hook hook)
+{
+	s_tickHook = hook;
+}
+
+/**
+  * @brief  Run the SysTick handler if the exception is pending and unmasked
+  * @param  None
+  * @retval None
+  */
+void SimTime_servePending(void)
+{
+	if (s_stPending_b && (0U == g_simPrimask))
+	{
+		s_stPending_b = false;
+		g_simScb.ICSR &= ~SCB_ICSR_PENDSTSET_Msk;
+
+		HAL_IncTick();
+		if (NULL != s_tickHook)
+		{
+			s_tickHook();
+		}
+	}
+}
+
+/**
+  * @brief  One tick: run to the next SysTick exception and its handler
+  * @param  None
+  * @retval None
+  */
+void SimTime_tick(void)
+{
+	SimTime_catchUp();
+	SimTime_run(SimTime_cyclesToSysTick());
+	SimTime_servePending();
+}
+
+/**
+  * @brief  Run a number of ticks one by one
+  * @param  ticks: number of SysTick interrupts
+  * @retval None
+  */
+void SimTime_advance(uint32_t ticks)
+{
+	while (0U != ticks)
+	{
+		SimTime_tick();
+		ticks--;
+	}
+}
+
+/**
+  * @brief  Raise an interrupt other than SysTick after some core cycles
+  * @param  cycles: delay in cycles, 0 to cancel
+  * @retval None
+  */
+void SimTime_setWakeup(uint32_t cycles)
+{
+	s_wakeup_u64 = (0U == cycles) ? 0U : (s_cycles_u64 + cycles);
+}
+
+/**
+  * @brief  Core cycles since SimTime_init()
+  * @param  None
+  * @retval uint64_t
+  */
+uint64_t SimTime_getCycles(void)
+{
+	SimTime_catchUp();
+	return s_cycles_u64;
+}
+
+/**
+  * @brief  Milliseconds of the core clock since SimTime_init()
+  * @param  None
+  * @retval uint64_t
+  */
+uint64_t SimTime_getElapsedMs(void)
+{
+	return s_cycles_u64 / (SystemCoreClock / 1000U);
+}
+
+/**
+  * @brief  WFI on the host: run to the next interrupt, SysTick or the one
+  *         set by SimTime_setWakeup(), even if PRIMASK masks it
+  * @param  None
+  * @retval None
+  */
+void SimTime_waitForInterrupt(void)
+{
+	uint64_t l_cycles_u64 = 0U;
+
+	SimTime_catchUp();
+	l_cycles_u64 = SimTime_cyclesToSysTick();
+
+	/* A pending interrupt does not let the core sleep */
+	if (false == s_stPending_b)
+	{
+		if ((0U != s_wakeup_u64) && ((0U == l_cycles_u64) || ((s_wakeup_u64 - s_cycles_u64) < l_cycles_u64)))
+		{
+			l_cycles_u64 = s_wakeup_u64 - s_cycles_u64;
+		}
+		if ((0U == l_cycles_u64) && (0U == s_wakeup_u64))
+		{
+			fprintf(stderr, "WFI without any interrupt to wake up\n");
+			exit(2);
+		}
+
+		SimTime_run(l_cycles_u64);
+		if ((0U != s_wakeup_u64) && (s_cycles_u64 >= s_wakeup_u64))
+		{
+			s_wakeup_u64 = 0U;
+		}
+		SimTime_run(SIM_TIME_WAKE_CYCLES);
+	}
+
+	SimTime_servePending();
+}
+
+/* HAL time base on the virtual clock ---------------------------------------*/
+
+/**
+  * @brief  Tick increment of the virtual SysTick_Handler()
+  * @param  None
+  * @retval None
+  */
+void HAL_IncTick(void)
+{
+	uwTick += (uint32_t)uwTickFreq;
+}
+
+/**
+  * @brief  Current virtual tick
+  * @param  None
+  * @retval uint32_t
+  */
+uint32_t HAL_GetTick(void)
+{
+	return uwTick;
+}
+
+/**
+  * @brief  Tick period in ms
+  * @param  None
+  * @retval HAL_TickFreqTypeDef
+  */
+HAL_TickFreqTypeDef HAL_GetTickFreq(void)
+{
+	return uwTickFreq;
+}
+
+/**
+  * @brief  Sleep until the next interrupt
+  * @param  Regulator: unused
+  * @param  SLEEPEntry: unused
+  * @retval None
+  */
+void HAL_PWR_EnterSLEEPMode(uint32_t Regulator, uint8_t SLEEPEntry)
+{
+	(void)Regulator;
+	(void)SLEEPEntry;
+	SimTime_waitForInterrupt();
+}
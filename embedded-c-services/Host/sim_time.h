@@ -0,0 +1,111 @@
+/*****************************************************************************
+ * @file      sim_time.h
+ * @author    Jet Station
+ * @brief     Virtual clock for the host simulation of the time services
+ * @date      [2026-10-17]
+ *
+ * Contact:
+ *   @website   https://jet-station.github.io/
+ *   @github    https://github.com/jet-station
+ *   @linkedin  https://www.linkedin.com/in/thien-ai-ho/
+ *   @email     thienaiho95@gmail.com
+ *
+ * @copyright  Copyright (c) 2026 Jet Station. All rights reserved.
+ *****************************************************************************/
+
+#ifndef __SIM_TIME_H__
+#define __SIM_TIME_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Simulated core clock, SysTick reloads once per 1 ms tick */
+#ifndef SIM_TIME_CORE_CLOCK
+#define SIM_TIME_CORE_CLOCK (72000000U)
+#endif
+
+typedef void (*SimTime_Hook)(void);
+
+/**
+  * @brief  Reset the virtual clock and the core registers
+  * @param  startTick: initial uwTick, e.g. close to a rollover
+  * @retval None
+  */
+void SimTime_init(uint32_t startTick);
+
+/**
+  * @brief  Function run from the virtual SysTick_Handler() after HAL_IncTick()
+  * @param  hook: e.g. the kernel tick, NULL for none
+  * @retval None
+  */
+void SimTime_setTickHook(SimTime_Hook hook);
+
+/**
+  * @brief  One tick: run to the next SysTick exception, then HAL_IncTick()
+  *         and the hook unless PRIMASK keeps the exception pending
+  * @param  None
+  * @retval None
+  */
+void SimTime_tick(void);
+
+/**
+  * @brief  Run a number of ticks one by one
+  * @param  ticks: number of SysTick interrupts
+  * @retval None
+  */
+void SimTime_advance(uint32_t ticks);
+
+/**
+  * @brief  Let code under test run for some core cycles, SysTick->VAL and
+  *         COUNTFLAG follow at once
+  * @param  cycles: number of cycles
+  * @retval None
+  */
+void SimTime_execute(uint32_t cycles);
+
+/**
+  * @brief  Read SysTick->CTRL as the core does: COUNTFLAG clears on the read
+  * @note   Code under test reads the plain register, COUNTFLAG stays set
+  *         there unless the register traps are on
+  * @param  None
+  * @retval uint32_t
+  */
+uint32_t SimTime_readSysTickCtrl(void);
+
+/**
+  * @brief  Switch the SysTick register traps on or off. Off, SysTick is plain
+  *         memory; on, every access of the code under test traps into the
+  *         register model, which gives the writes of CTRL, LOAD and VAL and
+  *         the read of COUNTFLAG their side effects, 2 cycles each
+  * @note   Needs Linux on x86-64, only code that reprograms SysTick, e.g.
+  *         Time/tickless_idle.c, runs on them
+  * @param  enable: true to trap every access
+  * @retval false if this host has no register traps
+  */
+bool SimTime_setSysTickTraps(bool enable);
+
+/**
+  * @brief  Raise an interrupt other than SysTick after some core cycles, it
+  *         wakes the core from WFI and has no handler
+  * @param  cycles: delay in cycles, 0 to cancel
+  * @retval None
+  */
+void SimTime_setWakeup(uint32_t cycles);
+
+/**
+  * @brief  Core cycles since SimTime_init(), 64 bits
+  * @param  None
+  * @retval uint64_t
+  */
+uint64_t SimTime_getCycles(void);
+
+/**
+  * @brief  Milliseconds of the core clock since SimTime_init(), 64 bits
+  * @note   Counts real time, uwTick only follows it as far as the code
+  *         under test keeps SysTick right
+  * @param  None
+  * @retval uint64_t
+  */
+uint64_t SimTime_getElapsedMs(void);
+
+#endif
@@ -0,0 +1,189 @@
+/*****************************************************************************
+ * @file      tlsf_malloc_main.c
+ * @author    Jet Station
+ * @brief     Host check of the C library allocator of tlsf.c (TLSF_MALLOC)
+ * @date      [2026-10-17]
+ *
+ * Contact:
+ *   @website   https://jet-station.github.io/
+ *   @github    https://github.com/jet-station
+ *   @linkedin  https://www.linkedin.com/in/thien-ai-ho/
+ *   @email     thienaiho95@gmail.com
+ *
+ * @copyright  Copyright (c) 2026 Jet Station. All rights reserved.
+ *****************************************************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "tlsf.h"
+
+/* Built with TLSF_MALLOC=1U: malloc, calloc, realloc and free of this
+ * program are the wrappers of tlsf.c over g_tlsfHeap, as in the demo
+ * project. stdout is unbuffered, the C library then allocates nothing and
+ * the heap holds only the blocks of the steps below */
+#if (0U == TLSF_MALLOC)
+#error "Build with -DTLSF_MALLOC=1U"
+#endif
+
+/* Requests of the calloc overflow step, count * size exceeds 32 bits:
+ * 2^32 wraps to 0 and 3 * 0x60000000 to 0x20000000 on the target */
+#define MALLOC_TEST_WRAP_COUNT (0x10000U)
+#define MALLOC_TEST_WRAP_SIZE (0x10000U)
+#define MALLOC_TEST_OVER_COUNT (3U)
+#define MALLOC_TEST_OVER_SIZE (0x60000000U)
+
+static uint32_t s_errors_u32 = 0U;
+
+/**
+  * @brief  Fill a block with a pattern that depends on the offset
+  * @param  block: block
+  * @param  size: bytes
+  * @param  seed: first byte
+  * @retval None
+  */
+static void MallocTest_fill(uint8_t *block, uint32_t size, uint8_t seed)
+{
+	uint32_t l_byte_u32 = 0U;
+
+	for (l_byte_u32 = 0U; l_byte_u32 < size; l_byte_u32++)
+	{
+		block[l_byte_u32] = (uint8_t)(seed + l_byte_u32);
+	}
+}
+
+/**
+  * @brief  Check the pattern of MallocTest_fill()
+  * @param  block: block
+  * @param  size: bytes
+  * @param  seed: first byte
+  * @retval true if the pattern is intact
+  */
+static bool MallocTest_verify(const uint8_t *block, uint32_t size, uint8_t seed)
+{
+	uint32_t l_byte_u32 = 0U;
+
+	for (l_byte_u32 = 0U; l_byte_u32 < size; l_byte_u32++)
+	{
+		if (block[l_byte_u32] != (uint8_t)(seed + l_byte_u32))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+/**
+  * @brief  Report one step, the heap structure is checked after each
+  * @param  name: step name
+  * @param  passed: result of the step itself
+  * @retval None
+  */
+static void MallocTest_step(const char *name, bool passed)
+{
+	uint32_t l_broken_u32 = Tlsf_check(&g_tlsfHeap);
+
+	if ((false == passed) || (0U != l_broken_u32))
+	{
+		s_errors_u32++;
+	}
+	printf("%-20s %s (Tlsf_check: %u, used %u bytes)\n", name,
+	       ((true == passed) && (0U == l_broken_u32)) ? "PASS" : "FAIL", l_broken_u32, g_tlsfHeap.usedBytes);
+}
+
+/**
+  * @brief  Run malloc, calloc and realloc through their edge cases
+  * @param  None
+  * @retval 0 if every step passed
+  */
+int main(void)
+{
+	Tlsf_Stats_st l_stats;
+	uint8_t *l_zeroed_pu8 = NULL;
+	uint8_t *l_first_pu8 = NULL;
+	uint8_t *l_block_pu8 = NULL;
+	uint8_t *l_moved_pu8 = NULL;
+	uint8_t *l_fence_pu8 = NULL;
+	uint32_t l_allocs_u32 = 0U;
+	uint32_t l_frees_u32 = 0U;
+	uint32_t l_failures_u32 = 0U;
+	uint32_t l_byte_u32 = 0U;
+	bool l_passed_b = false;
+
+	(void)setvbuf(stdout, NULL, _IONBF, 0U);
+
+	/* The block calloc gets back held a pattern before */
+	l_block_pu8 = (uint8_t *)malloc(96U);
+	l_passed_b = (NULL != l_block_pu8);
+	if (true == l_passed_b)
+	{
+		(void)memset(l_block_pu8, 0xA5, 96U);
+		free(l_block_pu8);
+	}
+	l_zeroed_pu8 = (uint8_t *)calloc(8U, 12U);
+	l_passed_b = l_passed_b && (l_zeroed_pu8 == l_block_pu8);
+	for (l_byte_u32 = 0U; (true == l_passed_b) && (l_byte_u32 < 96U); l_byte_u32++)
+	{
+		l_passed_b = (0U == l_zeroed_pu8[l_byte_u32]);
+	}
+	MallocTest_step("calloc", l_passed_b);
+
+	l_allocs_u32 = g_tlsfHeap.allocs;
+	l_passed_b = (NULL == calloc(MALLOC_TEST_WRAP_COUNT, MALLOC_TEST_WRAP_SIZE)) &&
+	             (NULL == calloc(MALLOC_TEST_OVER_COUNT, MALLOC_TEST_OVER_SIZE)) && (l_allocs_u32 == g_tlsfHeap.allocs);
+	MallocTest_step("calloc overflow", l_passed_b);
+
+	l_first_pu8 = (uint8_t *)realloc(NULL, 48U);
+	l_passed_b = (NULL != l_first_pu8) && ((l_allocs_u32 + 1U) == g_tlsfHeap.allocs);
+	MallocTest_step("realloc NULL", l_passed_b);
+
+	/* Topmost block, the rest of the pool is its free neighbour above */
+	l_block_pu8 = (uint8_t *)malloc(64U);
+	MallocTest_fill(l_block_pu8, 64U, 1U);
+	l_moved_pu8 = (uint8_t *)realloc(l_block_pu8, 512U);
+	l_passed_b = (l_moved_pu8 == l_block_pu8) && (true == MallocTest_verify(l_moved_pu8, 64U, 1U)) &&
+	             (Tlsf_getUsableSize(l_moved_pu8) >= 512U);
+	MallocTest_step("realloc grow", l_passed_b);
+
+	/* A used block right above, growing has to move */
+	l_fence_pu8 = (uint8_t *)malloc(32U);
+	MallocTest_fill(l_block_pu8, 512U, 2U);
+	l_allocs_u32 = g_tlsfHeap.allocs;
+	l_frees_u32 = g_tlsfHeap.frees;
+	l_moved_pu8 = (uint8_t *)realloc(l_block_pu8, 2048U);
+	l_passed_b = (NULL != l_moved_pu8) && (l_moved_pu8 != l_block_pu8) &&
+	             (true == MallocTest_verify(l_moved_pu8, 512U, 2U)) &&
+	             ((l_allocs_u32 + 1U) == g_tlsfHeap.allocs) && ((l_frees_u32 + 1U) == g_tlsfHeap.frees);
+	MallocTest_step("realloc move", l_passed_b);
+
+	l_block_pu8 = l_moved_pu8;
+	l_moved_pu8 = (uint8_t *)realloc(l_block_pu8, 100U);
+	l_passed_b = (l_moved_pu8 == l_block_pu8) && (true == MallocTest_verify(l_moved_pu8, 100U, 2U)) &&
+	             (Tlsf_getUsableSize(l_moved_pu8) < 2048U);
+	MallocTest_step("realloc shrink", l_passed_b);
+
+	/* No block fits, the old one stays valid */
+	l_failures_u32 = g_tlsfHeap.failures;
+	l_passed_b = (NULL == realloc(l_block_pu8, 2U * TLSF_HEAP_SIZE)) &&
+	             ((l_failures_u32 + 1U) == g_tlsfHeap.failures) && (true == MallocTest_verify(l_block_pu8, 100U, 2U));
+	MallocTest_step("realloc no fit", l_passed_b);
+
+	l_frees_u32 = g_tlsfHeap.frees;
+	l_passed_b = (NULL == realloc(l_block_pu8, 0U)) && ((l_frees_u32 + 1U) == g_tlsfHeap.frees);
+	MallocTest_step("realloc size 0", l_passed_b);
+
+	free(l_fence_pu8);
+	free(l_first_pu8);
+	free(l_zeroed_pu8);
+	free(NULL);
+	Tlsf_getStats(&g_tlsfHeap, &l_stats);
+	l_passed_b = (0U == g_tlsfHeap.usedBytes) && (0U == l_stats.usedBlocks) && (1U == l_stats.freeBlocks);
+	MallocTest_step("free all", l_passed_b);
+
+	printf("tlsf malloc: %s (%u errors)\n", (0U == s_errors_u32) ? "PASS" : "FAIL", s_errors_u32);
+
+	return (0U == s_errors_u32) ? 0 : 1;
+}
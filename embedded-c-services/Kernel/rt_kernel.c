@@ -0,0 +1,754 @@
+/*****************************************************************************
+ * @file      rt_kernel.c
+ * @author    Jet Station
+ * @brief     Minimal fixed-priority preemptive kernel for Cortex-M3
+ * @date      [2026-10-17]
+ *
+ * Contact:
+ *   @website   https://jet-station.github.io/
+ *   @github    https://github.com/jet-station
+ *   @linkedin  https://www.linkedin.com/in/thien-ai-ho/
+ *   @email     thienaiho95@gmail.com
+ *
+ * @copyright  Copyright (c) 2026 Jet Station. All rights reserved.
+ *****************************************************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "stm32f1xx.h"
+#include "mono_clock.h"
+#include "rt_kernel.h"
+
+/* Thread states */
+typedef enum {
+	RT_KERNEL_DORMANT = 0,
+	RT_KERNEL_READY,
+	RT_KERNEL_SLEEPING,
+	RT_KERNEL_WAIT_SEM,
+	RT_KERNEL_WAIT_MUTEX
+} RtKernel_State_en;
+
+/* Thread control block, sp must stay the first member for PendSV */
+typedef struct {
+	uint32_t *sp; /* Saved process stack pointer */
+	RtKernel_Mutex_st *held; /* Mutexes owned by the thread */
+	void *waitObject; /* Semaphore or mutex the thread blocks on */
+	uint32_t wakeTick; /* Tick at which a sleep or a timed wait ends */
+	uint8_t id;
+	uint8_t basePrio; /* Priority given at creation */
+	uint8_t prio; /* Effective priority, raised by priority inheritance */
+	uint8_t state;
+	bool timed; /* The wait ends at wakeTick */
+	bool timedOut;
+} RtKernel_Tcb_st;
+
+/* Words of the initial frame: r4-r11 saved by PendSV, r0-r3, r12, lr, pc
+ * and xPSR stacked by the exception entry */
+#define RT_KERNEL_FRAME_WORDS (16U)
+
+#define RT_KERNEL_XPSR_THUMB (0x01000000UL)
+
+#define RT_KERNEL_BASEPRI (RT_KERNEL_MAX_SYSCALL_PRIO << (8U - __NVIC_PRIO_BITS))
+
+static RtKernel_Tcb_st s_threads[RT_KERNEL_MAX_THREADS];
+static uint32_t s_threadCount_u32 = 0U;
+
+static RtKernel_Tcb_st s_idle;
+static uint32_t s_idleStack_u32[RT_KERNEL_IDLE_STACK_WORDS];
+
+/* Ready threads by effective priority. Priorities are unique, a thread that
+ * inherits a priority takes the slot of the blocked waiter it inherits from */
+static RtKernel_Tcb_st *s_byPrio[RT_KERNEL_PRIORITIES];
+static uint32_t s_ready_u32 = 0U;
+
+static volatile uint32_t s_ticks_u32 = 0U;
+
+/* Running thread and thread selected to run, used by the exception handlers */
+RtKernel_Tcb_st *g_rtKernelCurrent_pst = NULL;
+RtKernel_Tcb_st *g_rtKernelNext_pst = NULL;
+
+/**
+  * @brief  Mask the interrupts allowed to call the kernel
+  * @param  None
+  * @retval Previous BASEPRI, to pass to RtKernel_exitCritical()
+  */
+static inline uint32_t RtKernel_enterCritical(void)
+{
+	uint32_t l_basepri_u32 = __get_BASEPRI();
+
+	__set_BASEPRI(RT_KERNEL_BASEPRI);
+	__ISB();
+
+	return l_basepri_u32;
+}
+
+/**
+  * @brief  Restore the interrupt mask, a pended switch happens right after
+  * @param  basepri: value returned by RtKernel_enterCritical()
+  * @retval None
+  */
+static inline void RtKernel_exitCritical(uint32_t basepri)
+{
+	__set_BASEPRI(basepri);
+}
+
+/**
+  * @brief  Insert a thread into the ready bitmap at its effective priority
+  * @param  thread: thread to make ready
+  * @retval None
+  */
+static void RtKernel_makeReady(RtKernel_Tcb_st *thread)
+{
+	thread->state = RT_KERNEL_READY;
+	thread->waitObject = NULL;
+	thread->timed = false;
+	s_byPrio[thread->prio] = thread;
+	s_ready_u32 |= (1UL << thread->prio);
+}
+
+/**
+  * @brief  Remove a thread from the ready bitmap
+  * @param  thread: ready thread
+  * @param  state: blocking state
+  * @retval None
+  */
+static void RtKernel_block(RtKernel_Tcb_st *thread, RtKernel_State_en state)
+{
+	s_byPrio[thread->prio] = NULL;
+	s_ready_u32 &= ~(1UL << thread->prio);
+	thread->state = (uint8_t)state;
+}
+
+/**
+  * @brief  Highest effective priority among a set of waiting threads
+  * @param  waiters: bit n set for thread n
+  * @retval Index of the thread or RT_KERNEL_INVALID_THREAD if none
+  */
+static uint8_t RtKernel_topWaiter(uint32_t waiters)
+{
+	uint8_t l_top_u8 = RT_KERNEL_INVALID_THREAD;
+	uint32_t l_index_u32 = 0U;
+
+	while (0U != waiters)
+	{
+		l_index_u32 = 31U - __CLZ(waiters);
+		waiters &= ~(1UL << l_index_u32);
+		if ((RT_KERNEL_INVALID_THREAD == l_top_u8) ||
+		    (s_threads[l_index_u32].prio > s_threads[l_top_u8].prio))
+		{
+			l_top_u8 = (uint8_t)l_index_u32;
+		}
+	}
+
+	return l_top_u8;
+}
+
+/**
+  * @brief  Recompute the effective priority of a thread from the waiters of
+  *         its mutexes and propagate it along a chain of blocked owners
+  * @param  thread: thread to update
+  * @retval None
+  */
+static void RtKernel_updatePrio(RtKernel_Tcb_st *thread)
+{
+	RtKernel_Mutex_st *l_mutex_pst = NULL;
+	uint32_t l_depth_u32 = 0U;
+	uint8_t l_prio_u8 = 0U;
+	uint8_t l_waiter_u8 = 0U;
+
+	/* The depth bound stops on a lock cycle, i.e. a deadlock of the threads */
+	for (l_depth_u32 = 0U; (NULL != thread) && (l_depth_u32 < RT_KERNEL_MAX_THREADS); l_depth_u32++)
+	{
+		l_prio_u8 = thread->basePrio;
+		for (l_mutex_pst = thread->held; NULL != l_mutex_pst; l_mutex_pst = l_mutex_pst->nextHeld)
+		{
+			l_waiter_u8 = RtKernel_topWaiter(l_mutex_pst->waiters);
+			if ((RT_KERNEL_INVALID_THREAD != l_waiter_u8) && (s_threads[l_waiter_u8].prio > l_prio_u8))
+			{
+				l_prio_u8 = s_threads[l_waiter_u8].prio;
+			}
+		}
+
+		if (l_prio_u8 == thread->prio)
+		{
+			return;
+		}
+
+		if (RT_KERNEL_READY == thread->state)
+		{
+			RtKernel_block(thread, RT_KERNEL_READY);
+			thread->prio = l_prio_u8;
+			RtKernel_makeReady(thread);
+		}
+		else
+		{
+			thread->prio = l_prio_u8;
+		}
+
+		/* A blocked owner passes the change on to the owner it waits for */
+		if (RT_KERNEL_WAIT_MUTEX == thread->state)
+		{
+			l_mutex_pst = (RtKernel_Mutex_st *)thread->waitObject;
+			thread = &s_threads[l_mutex_pst->owner];
+		}
+		else
+		{
+			thread = NULL;
+		}
+	}
+}
+
+/**
+  * @brief  Select the highest priority ready thread and pend PendSV if it
+  *         is not the running one. Called inside a critical section
+  * @param  None
+  * @retval None
+  */
+static void RtKernel_schedule(void)
+{
+	RtKernel_Tcb_st *l_next_pst = &s_idle;
+
+	if (0U != s_ready_u32)
+	{
+		l_next_pst = s_byPrio[31U - __CLZ(s_ready_u32)];
+	}
+
+	g_rtKernelNext_pst = l_next_pst;
+	if (l_next_pst != g_rtKernelCurrent_pst)
+	{
+		SCB->ICSR = SCB_ICSR_PENDSVSET_Msk;
+	}
+}
+
+/**
+  * @brief  Return address of a thread function, parks the thread for good
+  * @param  None
+  * @retval None
+  */
+static void RtKernel_threadExit(void)
+{
+	uint32_t l_basepri_u32 = RtKernel_enterCritical();
+
+	RtKernel_block(g_rtKernelCurrent_pst, RT_KERNEL_DORMANT);
+	RtKernel_schedule();
+	RtKernel_exitCritical(l_basepri_u32);
+
+	while (1)
+	{
+	}
+}
+
+/**
+  * @brief  Idle thread, runs when no other thread is ready
+  * @param  arg: unused
+  * @retval None
+  */
+static void RtKernel_idleThread(void *arg)
+{
+	(void)arg;
+
+	while (1)
+	{
+		RtKernel_idle();
+	}
+}
+
+/**
+  * @brief  Idle hook, the default implementation executes WFI
+  * @param  None
+  * @retval None
+  */
+__WEAK void RtKernel_idle(void)
+{
+	__WFI();
+}
+
+/**
+  * @brief  Build the initial exception frame of a thread
+  * @param  thread: thread control block
+  * @param  entry: thread function
+  * @param  arg: argument in r0
+  * @param  stack: stack memory
+  * @param  stackWords: stack size in 32-bit words
+  * @retval None
+  */
+static void RtKernel_initStack(RtKernel_Tcb_st *thread, RtKernel_Entry entry, void *arg,
+                               uint32_t *stack, uint32_t stackWords)
+{
+	uint32_t *l_sp_pu32 = &stack[stackWords];
+	uint32_t l_index_u32 = 0U;
+
+	/* AAPCS requires an 8-byte aligned stack at the thread entry */
+	l_sp_pu32 = (uint32_t *)((uintptr_t)l_sp_pu32 & ~(uintptr_t)7U);
+
+	*(--l_sp_pu32) = RT_KERNEL_XPSR_THUMB;
+	*(--l_sp_pu32) = (uint32_t)(uintptr_t)entry & ~1UL; /* pc */
+	*(--l_sp_pu32) = (uint32_t)(uintptr_t)RtKernel_threadExit; /* lr */
+	for (l_index_u32 = 0U; l_index_u32 < 4U; l_index_u32++)
+	{
+		*(--l_sp_pu32) = 0U; /* r12, r3, r2, r1 */
+	}
+	*(--l_sp_pu32) = (uint32_t)(uintptr_t)arg; /* r0 */
+	for (l_index_u32 = 0U; l_index_u32 < 8U; l_index_u32++)
+	{
+		*(--l_sp_pu32) = 0U; /* r11..r4 */
+	}
+
+	thread->sp = l_sp_pu32;
+}
+
+/**
+  * @brief  Reset the kernel and create the idle thread
+  * @param  None
+  * @retval None
+  */
+void RtKernel_init(void)
+{
+	uint32_t l_index_u32 = 0U;
+
+	for (l_index_u32 = 0U; l_index_u32 < RT_KERNEL_PRIORITIES; l_index_u32++)
+	{
+		s_byPrio[l_index_u32] = NULL;
+	}
+	s_ready_u32 = 0U;
+	s_threadCount_u32 = 0U;
+	s_ticks_u32 = 0U;
+
+	s_idle.held = NULL;
+	s_idle.waitObject = NULL;
+	s_idle.id = RT_KERNEL_INVALID_THREAD;
+	s_idle.basePrio = 0U;
+	s_idle.prio = 0U;
+	s_idle.state = RT_KERNEL_READY;
+	s_idle.timed = false;
+	RtKernel_initStack(&s_idle, RtKernel_idleThread, NULL, s_idleStack_u32, RT_KERNEL_IDLE_STACK_WORDS);
+
+	g_rtKernelCurrent_pst = NULL;
+	g_rtKernelNext_pst = NULL;
+}
+
+/**
+  * @brief  Create a thread on a statically allocated stack
+  * @param  entry: thread function, should not return
+  * @param  arg: argument passed to the thread function
+  * @param  stack: stack memory, at least 32 words
+  * @param  stackWords: stack size in 32-bit words
+  * @param  priority: 0..31, unique per thread
+  * @retval Thread id or RT_KERNEL_INVALID_THREAD
+  */
+uint8_t RtKernel_createThread(RtKernel_Entry entry, void *arg, uint32_t *stack,
+                              uint32_t stackWords, uint8_t priority)
+{
+	RtKernel_Tcb_st *l_thread_pst = NULL;
+	uint32_t l_basepri_u32 = 0U;
+	uint32_t l_index_u32 = 0U;
+
+	if ((NULL == entry) || (NULL == stack) || (stackWords < (2U * RT_KERNEL_FRAME_WORDS)) ||
+	    (priority >= RT_KERNEL_PRIORITIES))
+	{
+		return RT_KERNEL_INVALID_THREAD;
+	}
+
+	l_basepri_u32 = RtKernel_enterCritical();
+
+	/* Unique priorities, also against a priority held through inheritance */
+	for (l_index_u32 = 0U; l_index_u32 < s_threadCount_u32; l_index_u32++)
+	{
+		if ((RT_KERNEL_DORMANT != s_threads[l_index_u32].state) &&
+		    ((priority == s_threads[l_index_u32].basePrio) || (priority == s_threads[l_index_u32].prio)))
+		{
+			RtKernel_exitCritical(l_basepri_u32);
+			return RT_KERNEL_INVALID_THREAD;
+		}
+	}
+	if (s_threadCount_u32 >= RT_KERNEL_MAX_THREADS)
+	{
+		RtKernel_exitCritical(l_basepri_u32);
+		return RT_KERNEL_INVALID_THREAD;
+	}
+
+	l_thread_pst = &s_threads[s_threadCount_u32];
+	l_thread_pst->held = NULL;
+	l_thread_pst->id = (uint8_t)s_threadCount_u32;
+	l_thread_pst->basePrio = priority;
+	l_thread_pst->prio = priority;
+	l_thread_pst->timedOut = false;
+	RtKernel_initStack(l_thread_pst, entry, arg, stack, stackWords);
+	RtKernel_makeReady(l_thread_pst);
+	s_threadCount_u32++;
+
+	/* Preempt the creator when the kernel already runs */
+	if (NULL != g_rtKernelCurrent_pst)
+	{
+		RtKernel_schedule();
+	}
+
+	RtKernel_exitCritical(l_basepri_u32);
+
+	return l_thread_pst->id;
+}
+
+/**
+  * @brief  Start the highest priority thread through SVC, never returns
+  * @param  None
+  * @retval None
+  */
+void RtKernel_start(void)
+{
+	/* PendSV switches only once no other handler is active, SVC must never
+	 * be masked by BASEPRI or it escalates to HardFault */
+	NVIC_SetPriority(PendSV_IRQn, (1UL << __NVIC_PRIO_BITS) - 1UL);
+	NVIC_SetPriority(SVCall_IRQn, 0U);
+
+	__disable_irq();
+	RtKernel_schedule();
+	g_rtKernelCurrent_pst = g_rtKernelNext_pst;
+	SCB->ICSR = SCB_ICSR_PENDSVCLR_Msk;
+	__set_BASEPRI(0U);
+	__enable_irq();
+
+#if defined(__arm__)
+	__ASM volatile ("svc 0");
+
+	while (1)
+	{
+	}
+#endif
+}
+
+/**
+  * @brief  Kernel time base, call from SysTick_Handler()
+  * @param  None
+  * @retval None
+  */
+void RtKernel_tick(void)
+{
+	RtKernel_Tcb_st *l_thread_pst = NULL;
+	RtKernel_Sem_st *l_sem_pst = NULL;
+	uint32_t l_basepri_u32 = 0U;
+	uint32_t l_index_u32 = 0U;
+	uint32_t l_now_u32 = 0U;
+
+	if (NULL == g_rtKernelCurrent_pst)
+	{
+		return;
+	}
+
+	l_basepri_u32 = RtKernel_enterCritical();
+
+	l_now_u32 = ++s_ticks_u32;
+	for (l_index_u32 = 0U; l_index_u32 < s_threadCount_u32; l_index_u32++)
+	{
+		l_thread_pst = &s_threads[l_index_u32];
+		if ((false == l_thread_pst->timed) || (false == MonoClock_isDue32(l_now_u32, l_thread_pst->wakeTick)))
+		{
+			continue;
+		}
+
+		if (RT_KERNEL_WAIT_SEM == l_thread_pst->state)
+		{
+			l_sem_pst = (RtKernel_Sem_st *)l_thread_pst->waitObject;
+			l_sem_pst->waiters &= ~(1UL << l_index_u32);
+			l_thread_pst->timedOut = true;
+		}
+		RtKernel_makeReady(l_thread_pst);
+	}
+
+	RtKernel_schedule();
+	RtKernel_exitCritical(l_basepri_u32);
+}
+
+/**
+  * @brief  Kernel ticks since RtKernel_start()
+  * @param  None
+  * @retval uint32_t
+  */
+uint32_t RtKernel_getTicks(void)
+{
+	return s_ticks_u32;
+}
+
+/**
+  * @brief  Id of the running thread
+  * @param  None
+  * @retval uint8_t
+  */
+uint8_t RtKernel_getCurrentThread(void)
+{
+	return (NULL != g_rtKernelCurrent_pst) ? g_rtKernelCurrent_pst->id : RT_KERNEL_INVALID_THREAD;
+}
+
+/**
+  * @brief  Block the calling thread for a number of ticks
+  * @param  ticks: sleep time, at least 1
+  * @retval None
+  */
+void RtKernel_sleep(uint32_t ticks)
+{
+	RtKernel_Tcb_st *l_self_pst = g_rtKernelCurrent_pst;
+	uint32_t l_basepri_u32 = 0U;
+
+	if (0U == ticks)
+	{
+		return;
+	}
+
+	l_basepri_u32 = RtKernel_enterCritical();
+	RtKernel_block(l_self_pst, RT_KERNEL_SLEEPING);
+	l_self_pst->wakeTick = s_ticks_u32 + ticks;
+	l_self_pst->timed = true;
+	RtKernel_schedule();
+	RtKernel_exitCritical(l_basepri_u32);
+}
+
+/**
+  * @brief  Initialize a mutex
+  * @param  mutex: mutex object
+  * @retval None
+  */
+void RtKernel_mutexInit(RtKernel_Mutex_st *mutex)
+{
+	mutex->nextHeld = NULL;
+	mutex->waiters = 0U;
+	mutex->owner = RT_KERNEL_INVALID_THREAD;
+}
+
+/**
+  * @brief  Lock a mutex, the owner inherits the priority of the waiters
+  * @param  mutex: mutex object
+  * @retval false if the calling thread already owns the mutex
+  */
+bool RtKernel_mutexLock(RtKernel_Mutex_st *mutex)
+{
+	RtKernel_Tcb_st *l_self_pst = g_rtKernelCurrent_pst;
+	uint32_t l_basepri_u32 = RtKernel_enterCritical();
+
+	if (RT_KERNEL_INVALID_THREAD == mutex->owner)
+	{
+		mutex->owner = l_self_pst->id;
+		mutex->nextHeld = l_self_pst->held;
+		l_self_pst->held = mutex;
+		RtKernel_exitCritical(l_basepri_u32);
+		return true;
+	}
+
+	if (mutex->owner == l_self_pst->id)
+	{
+		RtKernel_exitCritical(l_basepri_u32);
+		return false;
+	}
+
+	/* Leave the priority slot first, the owner may inherit it */
+	RtKernel_block(l_self_pst, RT_KERNEL_WAIT_MUTEX);
+	l_self_pst->waitObject = mutex;
+	mutex->waiters |= (1UL << l_self_pst->id);
+	RtKernel_updatePrio(&s_threads[mutex->owner]);
+
+	RtKernel_schedule();
+	RtKernel_exitCritical(l_basepri_u32);
+
+	/* Resumed by RtKernel_mutexUnlock() as the new owner */
+	return true;
+}
+
+/**
+  * @brief  Unlock a mutex and hand it to the highest priority waiter
+  * @param  mutex: mutex object owned by the calling thread
+  * @retval false if the calling thread is not the owner
+  */
+bool RtKernel_mutexUnlock(RtKernel_Mutex_st *mutex)
+{
+	RtKernel_Tcb_st *l_self_pst = g_rtKernelCurrent_pst;
+	RtKernel_Tcb_st *l_waiter_pst = NULL;
+	RtKernel_Mutex_st **l_link_ppst = NULL;
+	uint32_t l_basepri_u32 = RtKernel_enterCritical();
+	uint8_t l_waiter_u8 = 0U;
+
+	if (mutex->owner != l_self_pst->id)
+	{
+		RtKernel_exitCritical(l_basepri_u32);
+		return false;
+	}
+
+	for (l_link_ppst = &l_self_pst->held; *l_link_ppst != mutex; l_link_ppst = &(*l_link_ppst)->nextHeld)
+	{
+	}
+	*l_link_ppst = mutex->nextHeld;
+	mutex->nextHeld = NULL;
+
+	l_waiter_u8 = RtKernel_topWaiter(mutex->waiters);
+	if (RT_KERNEL_INVALID_THREAD == l_waiter_u8)
+	{
+		mutex->owner = RT_KERNEL_INVALID_THREAD;
+		RtKernel_updatePrio(l_self_pst);
+	}
+	else
+	{
+		l_waiter_pst = &s_threads[l_waiter_u8];
+		mutex->waiters &= ~(1UL << l_waiter_u8);
+		mutex->owner = l_waiter_u8;
+		mutex->nextHeld = l_waiter_pst->held;
+		l_waiter_pst->held = mutex;
+
+		/* Drop the inherited priority before the waiter takes its slot back,
+		 * the new owner then inherits from the remaining waiters */
+		RtKernel_updatePrio(l_self_pst);
+		RtKernel_makeReady(l_waiter_pst);
+		RtKernel_updatePrio(l_waiter_pst);
+	}
+
+	RtKernel_schedule();
+	RtKernel_exitCritical(l_basepri_u32);
+
+	return true;
+}
+
+/**
+  * @brief  Initialize a counting semaphore
+  * @param  sem: semaphore object
+  * @param  count: initial count
+  * @param  maxCount: count limit
+  * @retval None
+  */
+void RtKernel_semInit(RtKernel_Sem_st *sem, uint16_t count, uint16_t maxCount)
+{
+	sem->waiters = 0U;
+	sem->maxCount = maxCount;
+	sem->count = (count > maxCount) ? maxCount : count;
+}
+
+/**
+  * @brief  Take a semaphore, blocking up to timeout ticks
+  * @param  sem: semaphore object
+  * @param  timeout: ticks or RT_KERNEL_WAIT_FOREVER
+  * @retval true if the semaphore was taken
+  */
+bool RtKernel_semTake(RtKernel_Sem_st *sem, uint32_t timeout)
+{
+	RtKernel_Tcb_st *l_self_pst = g_rtKernelCurrent_pst;
+	uint32_t l_basepri_u32 = RtKernel_enterCritical();
+
+	if (0U != sem->count)
+	{
+		sem->count--;
+		RtKernel_exitCritical(l_basepri_u32);
+		return true;
+	}
+
+	if (0U == timeout)
+	{
+		RtKernel_exitCritical(l_basepri_u32);
+		return false;
+	}
+
+	RtKernel_block(l_self_pst, RT_KERNEL_WAIT_SEM);
+	l_self_pst->waitObject = sem;
+	l_self_pst->timedOut = false;
+	l_self_pst->timed = (RT_KERNEL_WAIT_FOREVER != timeout);
+	l_self_pst->wakeTick = s_ticks_u32 + timeout;
+	sem->waiters |= (1UL << l_self_pst->id);
+
+	RtKernel_schedule();
+	RtKernel_exitCritical(l_basepri_u32);
+
+	/* Resumed by RtKernel_semGive() or by the timeout in RtKernel_tick() */
+	return (false == l_self_pst->timedOut);
+}
+
+/**
+  * @brief  Give a semaphore, wakes the highest priority waiter
+  * @param  sem: semaphore object
+  * @retval None
+  */
+void RtKernel_semGive(RtKernel_Sem_st *sem)
+{
+	uint32_t l_basepri_u32 = RtKernel_enterCritical();
+	uint8_t l_waiter_u8 = RtKernel_topWaiter(sem->waiters);
+
+	if (RT_KERNEL_INVALID_THREAD != l_waiter_u8)
+	{
+		/* The count goes straight to the waiter */
+		sem->waiters &= ~(1UL << l_waiter_u8);
+		RtKernel_makeReady(&s_threads[l_waiter_u8]);
+		RtKernel_schedule();
+	}
+	else if (sem->count < sem->maxCount)
+	{
+		sem->count++;
+	}
+
+	RtKernel_exitCritical(l_basepri_u32);
+}
+
+/* The kernel owns SVC and PendSV once RT_KERNEL is defined, the generated
+ * stubs in stm32f1xx_it.c are left out then. Without it, the file links
+ * no handler and the unused kernel functions are removed by the linker */
+#if defined(__arm__)
+#if defined(RT_KERNEL)
+
+/**
+  * @brief  Start the first thread, entered from RtKernel_start()
+  * @note   Owned by the kernel: disable the generated SVC handler in CubeMX
+  * @param  None
+  * @retval None
+  */
+__attribute__((naked)) void SVC_Handler(void)
+{
+	__ASM volatile (
+		"	ldr   r3, =g_rtKernelCurrent_pst \n"
+		"	ldr   r1, [r3]                   \n"
+		"	ldr   r0, [r1]                   \n" /* sp of the first thread */
+		"	ldmia r0!, {r4-r11}              \n"
+		"	msr   psp, r0                    \n"
+		"	isb                              \n"
+		"	mvn   lr, #2                     \n" /* EXC_RETURN 0xFFFFFFFD: thread mode, PSP */
+		"	bx    lr                         \n"
+		"	.ltorg                           \n"
+	);
+}
+
+/**
+  * @brief  Context switch at the lowest exception priority
+  * @note   Owned by the kernel: disable the generated PendSV handler in CubeMX
+  * @param  None
+  * @retval None
+  */
+__attribute__((naked)) void PendSV_Handler(void)
+{
+	__ASM volatile (
+		"	mrs   r0, psp                    \n"
+		"	isb                              \n"
+		"	stmdb r0!, {r4-r11}              \n" /* r0-r3, r12, lr, pc, xPSR already stacked */
+		"	ldr   r3, =g_rtKernelCurrent_pst \n"
+		"	ldr   r2, =g_rtKernelNext_pst    \n"
+		"	cpsid i                          \n"
+		"	ldr   r1, [r3]                   \n"
+		"	str   r0, [r1]                   \n" /* current->sp */
+		"	ldr   r1, [r2]                   \n"
+		"	str   r1, [r3]                   \n" /* current = next */
+		"	cpsie i                          \n"
+		"	ldr   r0, [r1]                   \n"
+		"	ldmia r0!, {r4-r11}              \n"
+		"	msr   psp, r0                    \n"
+		"	isb                              \n"
+		"	bx    lr                         \n"
+		"	.ltorg                           \n"
+	);
+}
+
+#endif /* RT_KERNEL */
+#else
+
+/**
+  * @brief  Host build: the bookkeeping of the switch without the registers,
+  *         run by the simulation when PendSV is pending and unmasked
+  * @param  None
+  * @retval None
+  */
+void PendSV_Handler(void)
+{
+	g_rtKernelCurrent_pst = g_rtKernelNext_pst;
+}
+
+#endif
@@ -0,0 +1,176 @@
+/*****************************************************************************
+ * @file      rt_kernel.h
+ * @author    Jet Station
+ * @brief     Minimal fixed-priority preemptive kernel for Cortex-M3
+ * @date      [2026-10-17]
+ *
+ * Contact:
+ *   @website   https://jet-station.github.io/
+ *   @github    https://github.com/jet-station
+ *   @linkedin  https://www.linkedin.com/in/thien-ai-ho/
+ *   @email     thienaiho95@gmail.com
+ *
+ * @copyright  Copyright (c) 2026 Jet Station. All rights reserved.
+ *****************************************************************************/
+
+#ifndef __RT_KERNEL_H__
+#define __RT_KERNEL_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Number of thread control blocks, 24 bytes each, the idle thread is extra */
+#ifndef RT_KERNEL_MAX_THREADS
+#define RT_KERNEL_MAX_THREADS (8U)
+#endif
+
+/* Stack of the internal idle thread in 32-bit words */
+#ifndef RT_KERNEL_IDLE_STACK_WORDS
+#define RT_KERNEL_IDLE_STACK_WORDS (64U)
+#endif
+
+/* Highest NVIC priority (numerically lowest) of an ISR that calls the
+ * kernel. Kernel critical sections mask only priorities from this value
+ * down, ISRs above it are never delayed by the kernel but must not call it */
+#ifndef RT_KERNEL_MAX_SYSCALL_PRIO
+#define RT_KERNEL_MAX_SYSCALL_PRIO (5U)
+#endif
+
+/* Thread priorities, unique per thread, 31 is the highest */
+#define RT_KERNEL_PRIORITIES (32U)
+
+/* Timeout value to wait without limit */
+#define RT_KERNEL_WAIT_FOREVER (0xFFFFFFFFU)
+
+/* Returned by RtKernel_createThread() on failure */
+#define RT_KERNEL_INVALID_THREAD (0xFFU)
+
+typedef void (*RtKernel_Entry)(void *arg);
+
+/* Priority-inheritance mutex, owned by one thread at a time */
+typedef struct RtKernel_Mutex_st_tag {
+	struct RtKernel_Mutex_st_tag *nextHeld; /* Next mutex held by the owner */
+	uint32_t waiters; /* Bit n set: thread n waits for the mutex */
+	uint8_t owner; /* Owner thread, RT_KERNEL_INVALID_THREAD when free */
+} RtKernel_Mutex_st;
+
+/* Counting semaphore */
+typedef struct {
+	uint32_t waiters; /* Bit n set: thread n waits for the semaphore */
+	uint16_t count;
+	uint16_t maxCount;
+} RtKernel_Sem_st;
+
+/**
+  * @brief  Reset the kernel and create the idle thread
+  * @param  None
+  * @retval None
+  */
+void RtKernel_init(void);
+
+/**
+  * @brief  Create a thread on a statically allocated stack
+  * @param  entry: thread function, should not return
+  * @param  arg: argument passed to the thread function
+  * @param  stack: stack memory, at least 32 words
+  * @param  stackWords: stack size in 32-bit words
+  * @param  priority: 0..31, unique per thread
+  * @retval Thread id or RT_KERNEL_INVALID_THREAD
+  */
+uint8_t RtKernel_createThread(RtKernel_Entry entry, void *arg, uint32_t *stack,
+                              uint32_t stackWords, uint8_t priority);
+
+/**
+  * @brief  Start the highest priority thread through SVC, never returns
+  * @note   The host build returns with that thread as the current one
+  * @param  None
+  * @retval None
+  */
+void RtKernel_start(void);
+
+/**
+  * @brief  Kernel time base, call from SysTick_Handler()
+  * @param  None
+  * @retval None
+  */
+void RtKernel_tick(void);
+
+/**
+  * @brief  Kernel ticks since RtKernel_start()
+  * @param  None
+  * @retval uint32_t
+  */
+uint32_t RtKernel_getTicks(void);
+
+/**
+  * @brief  Id of the running thread
+  * @param  None
+  * @retval uint8_t
+  */
+uint8_t RtKernel_getCurrentThread(void);
+
+/**
+  * @brief  Block the calling thread for a number of ticks
+  * @param  ticks: sleep time, at least 1
+  * @retval None
+  */
+void RtKernel_sleep(uint32_t ticks);
+
+/**
+  * @brief  Initialize a mutex
+  * @param  mutex: mutex object
+  * @retval None
+  */
+void RtKernel_mutexInit(RtKernel_Mutex_st *mutex);
+
+/**
+  * @brief  Lock a mutex, the owner inherits the priority of the waiters
+  * @note   Thread context only, not recursive
+  * @param  mutex: mutex object
+  * @retval false if the calling thread already owns the mutex
+  */
+bool RtKernel_mutexLock(RtKernel_Mutex_st *mutex);
+
+/**
+  * @brief  Unlock a mutex and hand it to the highest priority waiter
+  * @param  mutex: mutex object owned by the calling thread
+  * @retval false if the calling thread is not the owner
+  */
+bool RtKernel_mutexUnlock(RtKernel_Mutex_st *mutex);
+
+/**
+  * @brief  Initialize a counting semaphore
+  * @param  sem: semaphore object
+  * @param  count: initial count
+  * @param  maxCount: count limit
+  * @retval None
+  */
+void RtKernel_semInit(RtKernel_Sem_st *sem, uint16_t count, uint16_t maxCount);
+
+/**
+  * @brief  Take a semaphore, blocking up to timeout ticks
+  * @note   Thread context only, a timeout of 0 never blocks
+  * @param  sem: semaphore object
+  * @param  timeout: ticks or RT_KERNEL_WAIT_FOREVER
+  * @retval true if the semaphore was taken
+  */
+bool RtKernel_semTake(RtKernel_Sem_st *sem, uint32_t timeout);
+
+/**
+  * @brief  Give a semaphore, wakes the highest priority waiter
+  * @note   Safe from threads and from ISRs up to RT_KERNEL_MAX_SYSCALL_PRIO
+  * @param  sem: semaphore object
+  * @retval None
+  */
+void RtKernel_semGive(RtKernel_Sem_st *sem);
+
+/**
+  * @brief  Idle hook, the default implementation executes WFI
+  * @note   Called in a loop by the idle thread with interrupts enabled, it
+  *         must not block. Override for idle-time work
+  * @param  None
+  * @retval None
+  */
+void RtKernel_idle(void);
+
+#endif
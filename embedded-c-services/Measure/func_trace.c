@@ -0,0 +1,129 @@
+/*****************************************************************************
+ * @file      func_trace.c
+ * @author    Jet Station
+ * @brief     Function entry/exit trace into a RAM ring, -finstrument-functions
+ * @date      [2026-10-17]
+ *
+ * Contact:
+ *   @website   https://jet-station.github.io/
+ *   @github    https://github.com/jet-station
+ *   @linkedin  https://www.linkedin.com/in/thien-ai-ho/
+ *   @email     thienaiho95@gmail.com
+ *
+ * @copyright  Copyright (c) 2026 Jet Station. All rights reserved.
+ *****************************************************************************/
+
+#include <stdint.h>
+#include <string.h>
+#include "stm32f1xx.h"
+#include "func_trace.h"
+
+#define FUNC_TRACE_MASK (FUNC_TRACE_ENTRIES - 1U)
+
+/* Records in call order, converted by Tools/trace_dump.py */
+FuncTrace_Table_st g_funcTrace;
+
+/**
+  * @brief  Append one record, lock-free against ISRs that are traced too
+  * @note   CYCCNT is read inside the exclusive sequence: an interrupt in
+  *         between clears the monitor, STREX fails and both the slot and
+  *         the timestamp are taken again, so the ring is in time order
+  * @param  addr: function address with the event flag in bit 0
+  * @retval None
+  */
+FUNC_TRACE_NO_INSTRUMENT
+static __INLINE void FuncTrace_record(uint32_t addr)
+{
+	FuncTrace_Record_st *l_record_pst = NULL;
+	uint32_t l_head_u32 = 0U;
+	uint32_t l_cycles_u32 = 0U;
+
+	if (0U == g_funcTrace.enabled)
+	{
+		return;
+	}
+
+	do
+	{
+		l_head_u32 = __LDREXW(&g_funcTrace.head);
+		l_cycles_u32 = DWT->CYCCNT;
+	} while (0U != __STREXW(l_head_u32 + 1U, &g_funcTrace.head));
+
+	l_record_pst = &g_funcTrace.record[l_head_u32 & FUNC_TRACE_MASK];
+	l_record_pst->addr = addr;
+	l_record_pst->cycles = l_cycles_u32;
+}
+
+/**
+  * @brief  Entry hook called by code built with -finstrument-functions
+  * @param  fn: address of the entered function
+  * @param  callSite: unused
+  * @retval None
+  */
+FUNC_TRACE_NO_INSTRUMENT __attribute__((noinline))
+void __cyg_profile_func_enter(void *fn, void *callSite)
+{
+	(void)callSite;
+	FuncTrace_record((uint32_t)fn | FUNC_TRACE_ENTRY_FLAG);
+}
+
+/**
+  * @brief  Exit hook called by code built with -finstrument-functions
+  * @param  fn: address of the function being left
+  * @param  callSite: unused
+  * @retval None
+  */
+FUNC_TRACE_NO_INSTRUMENT __attribute__((noinline))
+void __cyg_profile_func_exit(void *fn, void *callSite)
+{
+	(void)callSite;
+	FuncTrace_record((uint32_t)fn & ~FUNC_TRACE_ENTRY_FLAG);
+}
+
+/**
+  * @brief  Clear the ring, measure the hook cost and start recording
+  * @param  None
+  * @retval None
+  */
+FUNC_TRACE_NO_INSTRUMENT
+void FuncTrace_start(void)
+{
+	uint32_t l_primask_u32 = 0U;
+
+	g_funcTrace.enabled = 0U;
+	(void)memset(&g_funcTrace, 0, sizeof(g_funcTrace));
+
+	g_funcTrace.magic = FUNC_TRACE_MAGIC;
+	g_funcTrace.version = FUNC_TRACE_VERSION;
+	g_funcTrace.entries = FUNC_TRACE_ENTRIES;
+	g_funcTrace.cyclesPerUs = SystemCoreClock / 1000000U;
+
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+	/* Two back-to-back hooks: the timestamp difference is one complete hook
+	 * call, the figure to subtract from short functions in the trace */
+	l_primask_u32 = __get_PRIMASK();
+	__disable_irq();
+	g_funcTrace.enabled = 1U;
+	__cyg_profile_func_enter((void *)FuncTrace_start, (void *)0);
+	__cyg_profile_func_exit((void *)FuncTrace_start, (void *)0);
+	g_funcTrace.enabled = 0U;
+	__set_PRIMASK(l_primask_u32);
+	g_funcTrace.hookCycles = g_funcTrace.record[1].cycles - g_funcTrace.record[0].cycles;
+
+	g_funcTrace.head = 0U;
+	g_funcTrace.startCycles = DWT->CYCCNT;
+	g_funcTrace.enabled = 1U;
+}
+
+/**
+  * @brief  Freeze the ring
+  * @param  None
+  * @retval None
+  */
+FUNC_TRACE_NO_INSTRUMENT
+void FuncTrace_stop(void)
+{
+	g_funcTrace.enabled = 0U;
+}
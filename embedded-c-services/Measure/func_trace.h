@@ -0,0 +1,95 @@
+/*****************************************************************************
+ * @file      func_trace.h
+ * @author    Jet Station
+ * @brief     Function entry/exit trace into a RAM ring, -finstrument-functions
+ * @date      [2026-10-17]
+ *
+ * Contact:
+ *   @website   https://jet-station.github.io/
+ *   @github    https://github.com/jet-station
+ *   @linkedin  https://www.linkedin.com/in/thien-ai-ho/
+ *   @email     thienaiho95@gmail.com
+ *
+ * @copyright  Copyright (c) 2026 Jet Station. All rights reserved.
+ *****************************************************************************/
+
+#ifndef __FUNC_TRACE_H__
+#define __FUNC_TRACE_H__
+
+#include <stdint.h>
+
+/* Ring size in records of 8 bytes, a power of two. The oldest records are
+ * overwritten, the ring always holds the latest history */
+#ifndef FUNC_TRACE_ENTRIES
+#define FUNC_TRACE_ENTRIES (128U)
+#endif
+
+#if (0U != (FUNC_TRACE_ENTRIES & (FUNC_TRACE_ENTRIES - 1U)))
+#error "FUNC_TRACE_ENTRIES must be a power of two"
+#endif
+
+/* trace_dump.py finds the ring by its magic and reports the version */
+#define FUNC_TRACE_MAGIC (0x43525446U) /* "FTRC" */
+#define FUNC_TRACE_VERSION (1U)
+
+/* Bit 0 of FuncTrace_Record_st.addr, Thumb function addresses are odd in
+ * the map file anyway, so the bit is free for the event type */
+#define FUNC_TRACE_ENTRY_FLAG (1UL)
+
+/* Keeps a function out of the instrumentation, for code that runs before
+ * FuncTrace_start() or that the trace must not see */
+#define FUNC_TRACE_NO_INSTRUMENT __attribute__((no_instrument_function))
+
+/* One function entry or exit */
+typedef struct {
+	uint32_t addr; /* Function address, bit 0 set on entry, clear on exit */
+	uint32_t cycles; /* DWT->CYCCNT at the event */
+} FuncTrace_Record_st;
+
+/* RAM ring read by Tools/trace_dump.py through the symbol g_funcTrace */
+typedef struct {
+	uint32_t magic;
+	uint16_t version;
+	uint16_t entries;
+	volatile uint32_t head; /* Records written since the start, free running */
+	volatile uint32_t enabled;
+	uint32_t startCycles; /* CYCCNT at FuncTrace_start() */
+	uint32_t cyclesPerUs;
+	uint32_t hookCycles; /* Measured cost of one hook call including the call */
+	FuncTrace_Record_st record[FUNC_TRACE_ENTRIES];
+} FuncTrace_Table_st;
+
+extern FuncTrace_Table_st g_funcTrace;
+
+/**
+  * @brief  Clear the ring, enable the DWT cycle counter, measure the hook
+  *         cost and start recording
+  * @param  None
+  * @retval None
+  */
+void FuncTrace_start(void);
+
+/**
+  * @brief  Freeze the ring, e.g. when the event of interest happened
+  * @param  None
+  * @retval None
+  */
+void FuncTrace_stop(void);
+
+/**
+  * @brief  Entry hook called by code built with -finstrument-functions
+  * @param  fn: address of the entered function
+  * @param  callSite: return address in the caller, unused
+  * @retval None
+  */
+void __cyg_profile_func_enter(void *fn, void *callSite);
+
+/**
+  * @brief  Exit hook called by code built with -finstrument-functions
+  * @param  fn: address of the function being left
+  * @param  callSite: return address in the caller, unused
+  * @retval None
+  */
+void __cyg_profile_func_exit(void *fn, void *callSite);
+
+#endif
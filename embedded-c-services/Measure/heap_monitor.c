@@ -0,0 +1,388 @@
+/*****************************************************************************
+ * @file      heap_monitor.c
+ * @author    Jet Station
+ * @brief     Heap usage, allocation sites and fragmentation of the C library heap
+ * @date      [2026-10-17]
+ *
+ * Contact:
+ *   @website   https://jet-station.github.io/
+ *   @github    https://github.com/jet-station
+ *   @linkedin  https://www.linkedin.com/in/thien-ai-ho/
+ *   @email     thienaiho95@gmail.com
+ *
+ * @copyright  Copyright (c) 2026 Jet Station. All rights reserved.
+ *****************************************************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+#include "stm32f1xx.h"
+#include "heap_monitor.h"
+
+/* Every allocation of the image goes through the wrappers once the file
+ * is linked, it only compiles with HEAP_MONITOR defined */
+#if defined(HEAP_MONITOR)
+
+/* The allocator calls are intercepted at link time, the blocks keep the
+ * layout of the C library so realloc and the library internals still work */
+#if defined(__ARMCC_VERSION)
+/* armlink: every reference to malloc resolves to $Sub$$malloc, the library
+ * function itself stays reachable as $Super$$malloc */
+#define HEAP_MON_MALLOC $Sub$$malloc
+#define HEAP_MON_CALLOC $Sub$$calloc
+#define HEAP_MON_REALLOC $Sub$$realloc
+#define HEAP_MON_FREE $Sub$$free
+#define HEAP_MON_REAL_MALLOC $Super$$malloc
+#define HEAP_MON_REAL_CALLOC $Super$$calloc
+#define HEAP_MON_REAL_REALLOC $Super$$realloc
+#define HEAP_MON_REAL_FREE $Super$$free
+#else
+/* GNU ld: link with -Wl,--wrap=malloc,--wrap=calloc,--wrap=realloc,--wrap=free.
+ * newlib internals calling _malloc_r directly are only seen by _sbrk() */
+#define HEAP_MON_MALLOC __wrap_malloc
+#define HEAP_MON_CALLOC __wrap_calloc
+#define HEAP_MON_REALLOC __wrap_realloc
+#define HEAP_MON_FREE __wrap_free
+#define HEAP_MON_REAL_MALLOC __real_malloc
+#define HEAP_MON_REAL_CALLOC __real_calloc
+#define HEAP_MON_REAL_REALLOC __real_realloc
+#define HEAP_MON_REAL_FREE __real_free
+#endif
+
+extern void *HEAP_MON_REAL_MALLOC(size_t size);
+extern void *HEAP_MON_REAL_CALLOC(size_t count, size_t size);
+extern void *HEAP_MON_REAL_REALLOC(void *ptr, size_t size);
+extern void HEAP_MON_REAL_FREE(void *ptr);
+
+void *HEAP_MON_MALLOC(size_t size);
+void *HEAP_MON_CALLOC(size_t count, size_t size);
+void *HEAP_MON_REALLOC(void *ptr, size_t size);
+void HEAP_MON_FREE(void *ptr);
+
+/* Totals, size histogram, call sites and live blocks for Tools/heap_dump.py */
+HeapMon_Table_st g_heapMon;
+
+/* Set while HeapMon_update() searches, _sbrk() must not grow the heap */
+static volatile bool s_probing_b = false;
+
+/* Nesting of the wrappers: a library calloc built on malloc is counted once */
+static uint32_t s_depth_u32 = 0U;
+
+/**
+  * @brief  Size histogram bin of an allocation
+  * @param  size: requested bytes
+  * @retval Bin index
+  */
+static uint32_t HeapMon_getBin(uint32_t size)
+{
+	uint32_t l_bin_u32 = 0U;
+	uint32_t l_limit_u32 = 8U;
+
+	while ((size > l_limit_u32) && (l_bin_u32 < (HEAP_MON_BINS - 1U)))
+	{
+		l_limit_u32 <<= 1;
+		l_bin_u32++;
+	}
+
+	return l_bin_u32;
+}
+
+/**
+  * @brief  Entry of a call site, a new one if there is room
+  * @param  addr: return address into the caller
+  * @retval Site entry, the shared last entry when the table is full
+  */
+static HeapMon_Site_st *HeapMon_getSite(uint32_t addr)
+{
+	uint32_t l_index_u32 = 0U;
+
+	for (l_index_u32 = 0U; l_index_u32 < (HEAP_MON_SITES - 1U); l_index_u32++)
+	{
+		if (g_heapMon.site[l_index_u32].addr == addr)
+		{
+			return &g_heapMon.site[l_index_u32];
+		}
+		if (0U == g_heapMon.site[l_index_u32].addr)
+		{
+			g_heapMon.site[l_index_u32].addr = addr;
+			return &g_heapMon.site[l_index_u32];
+		}
+	}
+
+	return &g_heapMon.site[HEAP_MON_SITES - 1U];
+}
+
+/**
+  * @brief  Account a new block
+  * @param  ptr: block returned by the allocator
+  * @param  size: requested bytes
+  * @param  site: return address into the caller
+  * @retval None
+  */
+static void HeapMon_track(void *ptr, uint32_t size, uint32_t site)
+{
+	HeapMon_Site_st *l_site_pst = NULL;
+	uint32_t l_index_u32 = 0U;
+
+	g_heapMon.histogram[HeapMon_getBin(size)]++;
+
+	if (NULL == ptr)
+	{
+		g_heapMon.failures++;
+		return;
+	}
+
+	g_heapMon.allocs++;
+	g_heapMon.currentBytes += size;
+	if (g_heapMon.currentBytes > g_heapMon.peakBytes)
+	{
+		g_heapMon.peakBytes = g_heapMon.currentBytes;
+	}
+
+	l_site_pst = HeapMon_getSite(site);
+	l_site_pst->allocs++;
+	l_site_pst->liveBytes += size;
+	if (l_site_pst->liveBytes > l_site_pst->peakLiveBytes)
+	{
+		l_site_pst->peakLiveBytes = l_site_pst->liveBytes;
+	}
+
+	for (l_index_u32 = 0U; l_index_u32 < HEAP_MON_BLOCKS; l_index_u32++)
+	{
+		if (0U == g_heapMon.block[l_index_u32].ptr)
+		{
+			g_heapMon.block[l_index_u32].ptr = (uint32_t)ptr;
+			g_heapMon.block[l_index_u32].size = size;
+			g_heapMon.block[l_index_u32].site = l_site_pst->addr;
+			return;
+		}
+	}
+	g_heapMon.untracked++;
+}
+
+/**
+  * @brief  Account a freed block
+  * @param  ptr: block given back to the allocator, NULL is ignored
+  * @retval None
+  */
+static void HeapMon_untrack(void *ptr)
+{
+	HeapMon_Block_st *l_block_pst = NULL;
+	HeapMon_Site_st *l_site_pst = NULL;
+	uint32_t l_index_u32 = 0U;
+
+	if (NULL == ptr)
+	{
+		return;
+	}
+
+	g_heapMon.frees++;
+	for (l_index_u32 = 0U; l_index_u32 < HEAP_MON_BLOCKS; l_index_u32++)
+	{
+		l_block_pst = &g_heapMon.block[l_index_u32];
+		if (l_block_pst->ptr == (uint32_t)ptr)
+		{
+			l_site_pst = HeapMon_getSite(l_block_pst->site);
+			l_site_pst->frees++;
+			l_site_pst->liveBytes -= l_block_pst->size;
+			g_heapMon.currentBytes -= l_block_pst->size;
+			l_block_pst->ptr = 0U;
+			return;
+		}
+	}
+
+	/* Size and site unknown, currentBytes keeps the block */
+	if (g_heapMon.untracked > 0U)
+	{
+		g_heapMon.untracked--;
+	}
+}
+
+/**
+  * @brief  Clear the table, call before the first allocation
+  * @param  None
+  * @retval None
+  */
+void HeapMon_init(void)
+{
+	(void)memset(&g_heapMon, 0, sizeof(g_heapMon));
+
+	g_heapMon.magic = HEAP_MON_MAGIC;
+	g_heapMon.version = HEAP_MON_VERSION;
+	g_heapMon.sites = HEAP_MON_SITES;
+	g_heapMon.blocks = HEAP_MON_BLOCKS;
+	g_heapMon.bins = HEAP_MON_BINS;
+}
+
+/**
+  * @brief  Search the largest block the allocator can return from its free
+  *         memory, stored in largestFree
+  * @param  None
+  * @retval Largest free block in bytes
+  */
+uint32_t HeapMon_update(void)
+{
+	uint32_t l_low_u32 = 0U; /* Known to fit */
+	uint32_t l_high_u32 = HEAP_MON_PROBE_MAX + 1U; /* Assumed not to fit */
+	uint32_t l_mid_u32 = 0U;
+	void *l_probe_pv = NULL;
+
+	/* Straight to the library: the probes are not allocations of the
+	 * application, and the newlib heap end stays where it is */
+	s_probing_b = true;
+	while ((l_high_u32 - l_low_u32) > 8U)
+	{
+		l_mid_u32 = l_low_u32 + ((l_high_u32 - l_low_u32) / 2U);
+		l_probe_pv = HEAP_MON_REAL_MALLOC(l_mid_u32);
+		if (NULL != l_probe_pv)
+		{
+			HEAP_MON_REAL_FREE(l_probe_pv);
+			l_low_u32 = l_mid_u32;
+		}
+		else
+		{
+			l_high_u32 = l_mid_u32;
+		}
+	}
+	s_probing_b = false;
+
+	g_heapMon.largestFree = l_low_u32;
+
+	return l_low_u32;
+}
+
+/**
+  * @brief  Account a move of the newlib heap end, called by _sbrk()
+  * @param  heapEnd: current heap end
+  * @param  incr: requested increment
+  * @param  maxHeap: lowest address of the reserved stack
+  * @retval false if the increment must be refused
+  */
+bool HeapMon_onSbrk(const uint8_t *heapEnd, ptrdiff_t incr, const uint8_t *maxHeap)
+{
+	const uint8_t *l_newEnd_pu8 = heapEnd + incr;
+
+	if ((true == s_probing_b) && (incr > 0))
+	{
+		return false;
+	}
+	if (l_newEnd_pu8 > maxHeap)
+	{
+		g_heapMon.sbrkFailures++;
+		return false;
+	}
+
+	g_heapMon.sbrkTop = (uint32_t)l_newEnd_pu8;
+	if (g_heapMon.sbrkTop > g_heapMon.sbrkPeak)
+	{
+		g_heapMon.sbrkPeak = g_heapMon.sbrkTop;
+	}
+	g_heapMon.sbrkSpace = (uint32_t)(maxHeap - l_newEnd_pu8);
+
+	return true;
+}
+
+/**
+  * @brief  malloc() of the application
+  * @param  size: requested bytes
+  * @retval Block or NULL
+  */
+void *HEAP_MON_MALLOC(size_t size)
+{
+	uint32_t l_site_u32 = (uint32_t)__builtin_return_address(0);
+	uint32_t l_primask_u32 = __get_PRIMASK();
+	void *l_ptr_pv = NULL;
+
+	__disable_irq();
+	s_depth_u32++;
+	l_ptr_pv = HEAP_MON_REAL_MALLOC(size);
+	if (1U == s_depth_u32)
+	{
+		HeapMon_track(l_ptr_pv, (uint32_t)size, l_site_u32);
+	}
+	s_depth_u32--;
+	__set_PRIMASK(l_primask_u32);
+
+	return l_ptr_pv;
+}
+
+/**
+  * @brief  calloc() of the application
+  * @param  count: number of elements
+  * @param  size: bytes per element
+  * @retval Zeroed block or NULL
+  */
+void *HEAP_MON_CALLOC(size_t count, size_t size)
+{
+	uint32_t l_site_u32 = (uint32_t)__builtin_return_address(0);
+	uint32_t l_primask_u32 = __get_PRIMASK();
+	void *l_ptr_pv = NULL;
+
+	__disable_irq();
+	s_depth_u32++;
+	l_ptr_pv = HEAP_MON_REAL_CALLOC(count, size);
+	if (1U == s_depth_u32)
+	{
+		HeapMon_track(l_ptr_pv, (uint32_t)(count * size), l_site_u32);
+	}
+	s_depth_u32--;
+	__set_PRIMASK(l_primask_u32);
+
+	return l_ptr_pv;
+}
+
+/**
+  * @brief  realloc() of the application, the block moves to the new site
+  * @param  ptr: block to resize, NULL allocates
+  * @param  size: new size in bytes, 0 frees
+  * @retval Resized block or NULL
+  */
+void *HEAP_MON_REALLOC(void *ptr, size_t size)
+{
+	uint32_t l_site_u32 = (uint32_t)__builtin_return_address(0);
+	uint32_t l_primask_u32 = __get_PRIMASK();
+	void *l_ptr_pv = NULL;
+
+	__disable_irq();
+	s_depth_u32++;
+	l_ptr_pv = HEAP_MON_REAL_REALLOC(ptr, size);
+	if (1U == s_depth_u32)
+	{
+		if ((NULL != l_ptr_pv) || (0U == size))
+		{
+			HeapMon_untrack(ptr);
+		}
+		if (0U != size)
+		{
+			/* A failed realloc keeps the old block and counts as a failure */
+			HeapMon_track(l_ptr_pv, (uint32_t)size, l_site_u32);
+		}
+	}
+	s_depth_u32--;
+	__set_PRIMASK(l_primask_u32);
+
+	return l_ptr_pv;
+}
+
+/**
+  * @brief  free() of the application
+  * @param  ptr: block to free, NULL is ignored
+  * @retval None
+  */
+void HEAP_MON_FREE(void *ptr)
+{
+	uint32_t l_primask_u32 = __get_PRIMASK();
+
+	__disable_irq();
+	s_depth_u32++;
+	if (1U == s_depth_u32)
+	{
+		HeapMon_untrack(ptr);
+	}
+	HEAP_MON_REAL_FREE(ptr);
+	s_depth_u32--;
+	__set_PRIMASK(l_primask_u32);
+}
+
+#endif /* HEAP_MONITOR */
@@ -0,0 +1,116 @@
+/*****************************************************************************
+ * @file      heap_monitor.h
+ * @author    Jet Station
+ * @brief     Heap usage, allocation sites and fragmentation of the C library heap
+ * @date      [2026-10-17]
+ *
+ * Contact:
+ *   @website   https://jet-station.github.io/
+ *   @github    https://github.com/jet-station
+ *   @linkedin  https://www.linkedin.com/in/thien-ai-ho/
+ *   @email     thienaiho95@gmail.com
+ *
+ * @copyright  Copyright (c) 2026 Jet Station. All rights reserved.
+ *****************************************************************************/
+
+#ifndef __HEAP_MONITOR_H__
+#define __HEAP_MONITOR_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/* Distinct call sites of malloc/calloc/realloc, later ones share the last
+ * entry with address 0 */
+#ifndef HEAP_MON_SITES
+#define HEAP_MON_SITES (16U)
+#endif
+
+/* Live blocks tracked with their size and site. Blocks beyond it are still
+ * counted, their free cannot be attributed (see untracked) */
+#ifndef HEAP_MON_BLOCKS
+#define HEAP_MON_BLOCKS (32U)
+#endif
+
+/* Size histogram: bin 0 holds up to 8 bytes, bin i up to 8 << i bytes, the
+ * last bin everything larger */
+#define HEAP_MON_BINS (12U)
+
+/* Upper bound of the largest free block search */
+#ifndef HEAP_MON_PROBE_MAX
+#define HEAP_MON_PROBE_MAX (0x2000U)
+#endif
+
+/* Marks g_heapMon for heap_dump.py, the version changes with the layout */
+#define HEAP_MON_MAGIC (0x4E4F4D48U) /* "HMON" */
+#define HEAP_MON_VERSION (1U)
+
+/* Allocations of one call site */
+typedef struct {
+	uint32_t addr; /* Return address into the caller, 0 for the overflow entry */
+	uint32_t allocs;
+	uint32_t frees;
+	uint32_t liveBytes;
+	uint32_t peakLiveBytes;
+} HeapMon_Site_st;
+
+/* One live block, ptr 0 if the slot is free */
+typedef struct {
+	uint32_t ptr;
+	uint32_t size;
+	uint32_t site;
+} HeapMon_Block_st;
+
+/* RAM table read by Tools/heap_dump.py through the symbol g_heapMon. Only
+ * fixed-size integers, same layout for the target and the host dumper */
+typedef struct {
+	uint32_t magic;
+	uint16_t version;
+	uint16_t sites;
+	uint16_t blocks;
+	uint16_t bins;
+	uint32_t currentBytes; /* Requested bytes of the live blocks */
+	uint32_t peakBytes;
+	uint32_t allocs;
+	uint32_t frees;
+	uint32_t failures; /* Allocations that returned NULL */
+	uint32_t untracked; /* Live blocks not in block[], their free is not attributed */
+	uint32_t largestFree; /* Largest block malloc can return without growing the heap, from HeapMon_update() */
+	uint32_t sbrkTop; /* newlib heap end, 0 with the fixed Keil heap */
+	uint32_t sbrkPeak;
+	uint32_t sbrkSpace; /* Bytes left between the heap end and the reserved stack */
+	uint32_t sbrkFailures;
+	uint32_t histogram[HEAP_MON_BINS];
+	HeapMon_Site_st site[HEAP_MON_SITES];
+	HeapMon_Block_st block[HEAP_MON_BLOCKS];
+} HeapMon_Table_st;
+
+extern HeapMon_Table_st g_heapMon;
+
+/**
+  * @brief  Clear the table, call before the first allocation
+  * @param  None
+  * @retval None
+  */
+void HeapMon_init(void);
+
+/**
+  * @brief  Search the largest block the allocator can return from its free
+  *         memory, stored in largestFree
+  * @note   About log2(HEAP_MON_PROBE_MAX / 8) malloc calls. Call it from
+  *         the idle loop or before reading the table, not from an ISR
+  * @param  None
+  * @retval Largest free block in bytes
+  */
+uint32_t HeapMon_update(void);
+
+/**
+  * @brief  Account a move of the newlib heap end, called by _sbrk()
+  * @param  heapEnd: current heap end
+  * @param  incr: requested increment
+  * @param  maxHeap: lowest address of the reserved stack
+  * @retval false if the increment must be refused
+  */
+bool HeapMon_onSbrk(const uint8_t *heapEnd, ptrdiff_t incr, const uint8_t *maxHeap);
+
+#endif
@@ -0,0 +1,422 @@
+/*****************************************************************************
+ * @file      irq_latency.c
+ * @author    Jet Station
+ * @brief     Interrupt latency harness on software-triggered EXTI lines
+ * @date      [2026-10-17]
+ *
+ * Contact:
+ *   @website   https://jet-station.github.io/
+ *   @github    https://github.com/jet-station
+ *   @linkedin  https://www.linkedin.com/in/thien-ai-ho/
+ *   @email     thienaiho95@gmail.com
+ *
+ * @copyright  Copyright (c) 2026 Jet Station. All rights reserved.
+ *****************************************************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+#include "stm32f1xx_hal.h"
+#include "irq_latency.h"
+
+/* Samples of the trigger overhead measurement, the minimum is kept */
+#define IRQ_LAT_CALIBRATION_RUNS (16U)
+
+/* A sample whose handler did not run within 1/10 s is dropped */
+#define IRQ_LAT_TIMEOUT_DIVIDER (10U)
+
+/* Histograms per load and response kind, read by Tools/irqlat_dump.py */
+IrqLat_Table_st g_irqLat;
+
+static EXTI_HandleTypeDef s_extiA;
+static EXTI_HandleTypeDef s_extiB;
+static DMA_HandleTypeDef s_hdma;
+
+/* DMA load: one flash word copied over a RAM buffer, the burst contends
+ * with the core for the flash interface and the SRAM */
+static const uint32_t s_dmaPattern_u32 = 0xA5A5A5A5U;
+static uint32_t s_dmaBuffer_u32[IRQ_LAT_DMA_WORDS];
+
+/* Flash load: next erased half-word of IRQ_LAT_FLASH_PAGE, 0 to erase first */
+static uint32_t s_flashAddr_u32 = 0U;
+
+/* Sample in progress, shared with the handlers */
+static uint32_t s_load_u32 = IRQ_LAT_LOAD_NONE;
+static volatile uint32_t s_kind_u32 = IRQ_LAT_ENTRY;
+static volatile uint32_t s_start_u32 = 0U;
+static volatile bool s_done_b = false;
+
+/**
+  * @brief  Add one latency to the distribution of the current run
+  * @param  kind: IRQ_LAT_ENTRY, IRQ_LAT_TAIL or IRQ_LAT_PREEMPT
+  * @param  cycles: measured latency
+  * @retval None
+  */
+static void IrqLat_record(uint32_t kind, uint32_t cycles)
+{
+	IrqLat_Dist_st *l_dist_pst = &g_irqLat.dist[s_load_u32][kind];
+	uint32_t l_bin_u32 = cycles / l_dist_pst->binCycles;
+
+	if (l_bin_u32 >= IRQ_LAT_BINS)
+	{
+		l_bin_u32 = IRQ_LAT_BINS - 1U;
+	}
+	if (0xFFFFU != l_dist_pst->histogram[l_bin_u32])
+	{
+		l_dist_pst->histogram[l_bin_u32]++;
+	}
+
+	l_dist_pst->samples++;
+	l_dist_pst->sumCycles += cycles;
+	if (cycles < l_dist_pst->minCycles)
+	{
+		l_dist_pst->minCycles = cycles;
+	}
+	if (cycles > l_dist_pst->maxCycles)
+	{
+		l_dist_pst->maxCycles = cycles;
+	}
+}
+
+/**
+  * @brief  Elapsed cycles since a stamp taken before a trigger, without the
+  *         trigger overhead
+  * @param  now: CYCCNT on handler entry
+  * @retval Latency in cycles
+  */
+static uint32_t IrqLat_sinceTrigger(uint32_t now)
+{
+	uint32_t l_elapsed_u32 = now - s_start_u32;
+
+	return (l_elapsed_u32 > g_irqLat.triggerCycles) ? (l_elapsed_u32 - g_irqLat.triggerCycles) : 0U;
+}
+
+/**
+  * @brief  First part of the load, right before the stamp and the trigger
+  * @param  None
+  * @retval None
+  */
+static void IrqLat_loadBefore(void)
+{
+	if (IRQ_LAT_LOAD_DMA == s_load_u32)
+	{
+		(void)HAL_DMA_Start(&s_hdma, (uint32_t)&s_dmaPattern_u32, (uint32_t)s_dmaBuffer_u32, IRQ_LAT_DMA_WORDS);
+	}
+	else if (IRQ_LAT_LOAD_FLASH == s_load_u32)
+	{
+		/* Hold the interrupt pending until the programming has started */
+		__disable_irq();
+	}
+}
+
+/**
+  * @brief  Second part of the load, right after the stamp and the trigger
+  * @param  None
+  * @retval None
+  */
+static void IrqLat_loadAfter(void)
+{
+	if (IRQ_LAT_LOAD_FLASH == s_load_u32)
+	{
+		/* From here on every fetch from flash stalls until the half-word is
+		 * written, the vector fetch of the pending interrupt included */
+		SET_BIT(FLASH->CR, FLASH_CR_PG);
+		*(volatile uint16_t *)s_flashAddr_u32 = 0x0000U;
+		__enable_irq();
+	}
+}
+
+/**
+  * @brief  Erase the flash load page and start over at its beginning
+  * @param  None
+  * @retval None
+  */
+static void IrqLat_erasePage(void)
+{
+	FLASH_EraseInitTypeDef l_erase_st;
+	uint32_t l_pageError_u32 = 0U;
+
+	l_erase_st.TypeErase = FLASH_TYPEERASE_PAGES;
+	l_erase_st.Banks = FLASH_BANK_1;
+	l_erase_st.PageAddress = IRQ_LAT_FLASH_PAGE;
+	l_erase_st.NbPages = 1U;
+	(void)HAL_FLASHEx_Erase(&l_erase_st, &l_pageError_u32);
+
+	s_flashAddr_u32 = IRQ_LAT_FLASH_PAGE;
+}
+
+/**
+  * @brief  Wait for the load of the last sample to finish
+  * @param  None
+  * @retval None
+  */
+static void IrqLat_loadEnd(void)
+{
+	if (IRQ_LAT_LOAD_DMA == s_load_u32)
+	{
+		(void)HAL_DMA_PollForTransfer(&s_hdma, HAL_DMA_FULL_TRANSFER, HAL_MAX_DELAY);
+	}
+	else if (IRQ_LAT_LOAD_FLASH == s_load_u32)
+	{
+		while (0U != READ_BIT(FLASH->SR, FLASH_SR_BSY))
+		{
+		}
+		CLEAR_BIT(FLASH->CR, FLASH_CR_PG);
+		__HAL_FLASH_CLEAR_FLAG(FLASH_FLAG_EOP | FLASH_FLAG_PGERR | FLASH_FLAG_WRPERR);
+
+		s_flashAddr_u32 += 2U;
+		if (s_flashAddr_u32 >= (IRQ_LAT_FLASH_PAGE + IRQ_LAT_FLASH_PAGE_SIZE))
+		{
+			IrqLat_erasePage();
+		}
+	}
+}
+
+/**
+  * @brief  Set up a software-only EXTI line and its NVIC channel
+  * @param  hexti: handle of the line
+  * @param  line: EXTI_LINE_x
+  * @param  irqn: NVIC channel of the line
+  * @retval false if the line could not be set up
+  */
+static bool IrqLat_setupLine(EXTI_HandleTypeDef *hexti, uint32_t line, IRQn_Type irqn)
+{
+	EXTI_ConfigTypeDef l_config_st;
+
+	/* No edge trigger: the pin mapped to the line cannot fire it */
+	l_config_st.Line = line;
+	l_config_st.Mode = EXTI_MODE_INTERRUPT;
+	l_config_st.Trigger = EXTI_TRIGGER_NONE;
+	l_config_st.GPIOSel = EXTI_GPIOA;
+	if (HAL_OK != HAL_EXTI_SetConfigLine(hexti, &l_config_st))
+	{
+		return false;
+	}
+
+	HAL_NVIC_SetPriority(irqn, IRQ_LAT_IRQ_PRIO, 0U);
+	HAL_NVIC_EnableIRQ(irqn);
+
+	return true;
+}
+
+/**
+  * @brief  Clear the table, set up both EXTI lines, the DMA channel and the
+  *         DWT cycle counter, then measure the trigger overhead
+  * @param  None
+  * @retval false if a peripheral could not be set up
+  */
+bool IrqLat_init(void)
+{
+	uint32_t l_index_u32 = 0U;
+	uint32_t l_start_u32 = 0U;
+	uint32_t l_cycles_u32 = 0U;
+
+	(void)memset(&g_irqLat, 0, sizeof(g_irqLat));
+
+	g_irqLat.magic = IRQ_LAT_MAGIC;
+	g_irqLat.version = IRQ_LAT_VERSION;
+	g_irqLat.loads = IRQ_LAT_LOADS;
+	g_irqLat.kinds = IRQ_LAT_KINDS;
+	g_irqLat.bins = IRQ_LAT_BINS;
+	g_irqLat.cyclesPerUs = SystemCoreClock / 1000000U;
+
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+	__HAL_RCC_AFIO_CLK_ENABLE();
+	if ((false == IrqLat_setupLine(&s_extiA, IRQ_LAT_LINE_A, IRQ_LAT_A_IRQn)) ||
+		(false == IrqLat_setupLine(&s_extiB, IRQ_LAT_LINE_B, IRQ_LAT_B_IRQn)))
+	{
+		return false;
+	}
+
+	__HAL_RCC_DMA1_CLK_ENABLE();
+	s_hdma.Instance = IRQ_LAT_DMA_CHANNEL;
+	s_hdma.Init.Direction = DMA_MEMORY_TO_MEMORY;
+	s_hdma.Init.PeriphInc = DMA_PINC_DISABLE;
+	s_hdma.Init.MemInc = DMA_MINC_ENABLE;
+	s_hdma.Init.PeriphDataAlignment = DMA_PDATAALIGN_WORD;
+	s_hdma.Init.MemDataAlignment = DMA_MDATAALIGN_WORD;
+	s_hdma.Init.Mode = DMA_NORMAL;
+	s_hdma.Init.Priority = DMA_PRIORITY_VERY_HIGH;
+	if (HAL_OK != HAL_DMA_Init(&s_hdma))
+	{
+		return false;
+	}
+
+	/* Trigger overhead: stamp, HAL_EXTI_GenerateSWI() and stamp again with
+	 * the line held off in the NVIC, the same path as a measured sample */
+	HAL_NVIC_DisableIRQ(IRQ_LAT_A_IRQn);
+	g_irqLat.triggerCycles = 0xFFFFFFFFU;
+	for (l_index_u32 = 0U; l_index_u32 < IRQ_LAT_CALIBRATION_RUNS; l_index_u32++)
+	{
+		l_start_u32 = DWT->CYCCNT;
+		HAL_EXTI_GenerateSWI(&s_extiA);
+		l_cycles_u32 = DWT->CYCCNT - l_start_u32;
+
+		if (l_cycles_u32 < g_irqLat.triggerCycles)
+		{
+			g_irqLat.triggerCycles = l_cycles_u32;
+		}
+		HAL_EXTI_ClearPending(&s_extiA, EXTI_TRIGGER_RISING_FALLING);
+		HAL_NVIC_ClearPendingIRQ(IRQ_LAT_A_IRQn);
+	}
+	HAL_NVIC_EnableIRQ(IRQ_LAT_A_IRQn);
+
+	return true;
+}
+
+/**
+  * @brief  Measure entry, tail-chaining and preemption latency under a load
+  * @param  load: IRQ_LAT_LOAD_NONE, IRQ_LAT_LOAD_DMA or IRQ_LAT_LOAD_FLASH
+  * @param  samples: samples per response kind, up to 0xFFFF
+  * @param  binCycles: histogram bin width
+  * @retval None
+  */
+void IrqLat_run(uint32_t load, uint32_t samples, uint32_t binCycles)
+{
+	uint32_t l_basepri_u32 = __get_BASEPRI();
+	uint32_t l_timeout_u32 = SystemCoreClock / IRQ_LAT_TIMEOUT_DIVIDER;
+	uint32_t l_kind_u32 = 0U;
+	uint32_t l_sample_u32 = 0U;
+	uint32_t l_wait_u32 = 0U;
+
+	if ((load >= IRQ_LAT_LOADS) || (0U == binCycles))
+	{
+		return;
+	}
+	if (samples > 0xFFFFU)
+	{
+		samples = 0xFFFFU;
+	}
+
+	s_load_u32 = load;
+	for (l_kind_u32 = 0U; l_kind_u32 < IRQ_LAT_KINDS; l_kind_u32++)
+	{
+		(void)memset(&g_irqLat.dist[load][l_kind_u32], 0, sizeof(IrqLat_Dist_st));
+		g_irqLat.dist[load][l_kind_u32].binCycles = binCycles;
+		g_irqLat.dist[load][l_kind_u32].minCycles = 0xFFFFFFFFU;
+	}
+
+	if (IRQ_LAT_LOAD_FLASH == load)
+	{
+		(void)HAL_FLASH_Unlock();
+		if (0U == s_flashAddr_u32)
+		{
+			IrqLat_erasePage();
+		}
+	}
+
+	/* Mask the levels below line A, BASEPRI blocks its own value and above */
+	__set_BASEPRI((IRQ_LAT_IRQ_PRIO + 1U) << (8U - __NVIC_PRIO_BITS));
+
+	for (l_kind_u32 = 0U; l_kind_u32 < IRQ_LAT_KINDS; l_kind_u32++)
+	{
+		/* Same level tail-chains, one level above preempts line A */
+		HAL_NVIC_SetPriority(IRQ_LAT_B_IRQn,
+			(IRQ_LAT_PREEMPT == l_kind_u32) ? (IRQ_LAT_IRQ_PRIO - 1U) : IRQ_LAT_IRQ_PRIO, 0U);
+		s_kind_u32 = l_kind_u32;
+
+		for (l_sample_u32 = 0U; l_sample_u32 < samples; l_sample_u32++)
+		{
+			s_done_b = false;
+
+			if (IRQ_LAT_ENTRY == l_kind_u32)
+			{
+				IrqLat_loadBefore();
+				s_start_u32 = DWT->CYCCNT;
+				HAL_EXTI_GenerateSWI(&s_extiA);
+				IrqLat_loadAfter();
+			}
+			else
+			{
+				/* The load starts in the handler of line A */
+				HAL_EXTI_GenerateSWI(&s_extiA);
+			}
+
+			l_wait_u32 = DWT->CYCCNT;
+			while ((false == s_done_b) && ((DWT->CYCCNT - l_wait_u32) < l_timeout_u32))
+			{
+			}
+			if (false == s_done_b)
+			{
+				g_irqLat.timeouts++;
+			}
+
+			IrqLat_loadEnd();
+		}
+	}
+
+	__set_BASEPRI(l_basepri_u32);
+
+	if (IRQ_LAT_LOAD_FLASH == load)
+	{
+		(void)HAL_FLASH_Lock();
+	}
+}
+
+/* EXTI3 and EXTI4 are the two harness lines, their handlers are only
+ * built with IRQ_LATENCY, when main() also runs the measurement */
+#if defined(IRQ_LATENCY)
+
+/**
+  * @brief  Line A: records the entry latency or starts the second handler
+  * @note   Owned by the harness: disable the generated handler in CubeMX
+  * @param  None
+  * @retval None
+  */
+void IRQ_LAT_A_IRQHandler(void)
+{
+	uint32_t l_now_u32 = DWT->CYCCNT;
+
+	HAL_EXTI_ClearPending(&s_extiA, EXTI_TRIGGER_RISING_FALLING);
+
+	if (IRQ_LAT_ENTRY == s_kind_u32)
+	{
+		IrqLat_record(IRQ_LAT_ENTRY, IrqLat_sinceTrigger(l_now_u32));
+		s_done_b = true;
+	}
+	else if (IRQ_LAT_TAIL == s_kind_u32)
+	{
+		/* Line B pends at the same level, the stamp is the last thing this
+		 * handler does before the exception return */
+		IrqLat_loadBefore();
+		HAL_EXTI_GenerateSWI(&s_extiB);
+		s_start_u32 = DWT->CYCCNT;
+		IrqLat_loadAfter();
+	}
+	else
+	{
+		/* Line B is one level above and preempts right after the trigger */
+		IrqLat_loadBefore();
+		s_start_u32 = DWT->CYCCNT;
+		HAL_EXTI_GenerateSWI(&s_extiB);
+		IrqLat_loadAfter();
+	}
+}
+
+/**
+  * @brief  Line B: records the tail-chaining or the preemption latency
+  * @note   Owned by the harness: disable the generated handler in CubeMX
+  * @param  None
+  * @retval None
+  */
+void IRQ_LAT_B_IRQHandler(void)
+{
+	uint32_t l_now_u32 = DWT->CYCCNT;
+
+	HAL_EXTI_ClearPending(&s_extiB, EXTI_TRIGGER_RISING_FALLING);
+
+	if (IRQ_LAT_TAIL == s_kind_u32)
+	{
+		IrqLat_record(IRQ_LAT_TAIL, l_now_u32 - s_start_u32);
+	}
+	else
+	{
+		IrqLat_record(IRQ_LAT_PREEMPT, IrqLat_sinceTrigger(l_now_u32));
+	}
+	s_done_b = true;
+}
+
+#endif /* IRQ_LATENCY */
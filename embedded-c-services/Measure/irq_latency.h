@@ -0,0 +1,130 @@
+/*****************************************************************************
+ * @file      irq_latency.h
+ * @author    Jet Station
+ * @brief     Interrupt latency harness on software-triggered EXTI lines
+ * @date      [2026-10-17]
+ *
+ * Contact:
+ *   @website   https://jet-station.github.io/
+ *   @github    https://github.com/jet-station
+ *   @linkedin  https://www.linkedin.com/in/thien-ai-ho/
+ *   @email     thienaiho95@gmail.com
+ *
+ * @copyright  Copyright (c) 2026 Jet Station. All rights reserved.
+ *****************************************************************************/
+
+#ifndef __IRQ_LATENCY_H__
+#define __IRQ_LATENCY_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Two EXTI lines owned by the harness, triggered in software only. The
+ * handlers are defined in irq_latency.c, do not generate them in CubeMX */
+#ifndef IRQ_LAT_LINE_A
+#define IRQ_LAT_LINE_A EXTI_LINE_3
+#define IRQ_LAT_A_IRQn EXTI3_IRQn
+#define IRQ_LAT_A_IRQHandler EXTI3_IRQHandler
+#endif
+#ifndef IRQ_LAT_LINE_B
+#define IRQ_LAT_LINE_B EXTI_LINE_4
+#define IRQ_LAT_B_IRQn EXTI4_IRQn
+#define IRQ_LAT_B_IRQHandler EXTI4_IRQHandler
+#endif
+
+/* NVIC priority of line A. Line B runs one level above it for the
+ * preemption case. During a run BASEPRI masks every level below line A
+ * (numerically above IRQ_LAT_IRQ_PRIO), interrupts at the level of line A
+ * and above still run */
+#ifndef IRQ_LAT_IRQ_PRIO
+#define IRQ_LAT_IRQ_PRIO (1U)
+#endif
+
+#if (IRQ_LAT_IRQ_PRIO < 1U) || (IRQ_LAT_IRQ_PRIO > 14U)
+#error "IRQ_LAT_IRQ_PRIO must leave one level above and one below"
+#endif
+
+/* Memory-to-memory DMA burst of the DMA load, restarted for every sample */
+#ifndef IRQ_LAT_DMA_CHANNEL
+#define IRQ_LAT_DMA_CHANNEL DMA1_Channel1
+#endif
+#ifndef IRQ_LAT_DMA_WORDS
+#define IRQ_LAT_DMA_WORDS (64U)
+#endif
+
+/* Flash page written by the flash load, one half-word per sample. Must be
+ * outside the image, the default is the last 1 KB page of the STM32F103C6 */
+#ifndef IRQ_LAT_FLASH_PAGE
+#define IRQ_LAT_FLASH_PAGE (0x08007C00UL)
+#endif
+#define IRQ_LAT_FLASH_PAGE_SIZE (0x400UL)
+
+/* Histogram bins per distribution, the last bin also collects everything
+ * beyond it */
+#ifndef IRQ_LAT_BINS
+#define IRQ_LAT_BINS (32U)
+#endif
+
+/* Background load during a run */
+#define IRQ_LAT_LOAD_NONE (0U)
+#define IRQ_LAT_LOAD_DMA (1U) /* DMA burst competing for the bus matrix */
+#define IRQ_LAT_LOAD_FLASH (2U) /* Flash programming stalls the fetches */
+#define IRQ_LAT_LOADS (3U)
+
+/* Measured response */
+#define IRQ_LAT_ENTRY (0U) /* Trigger in thread mode to the first handler line */
+#define IRQ_LAT_TAIL (1U) /* End of one handler to the next pending one */
+#define IRQ_LAT_PREEMPT (2U) /* Trigger in a handler to a higher priority one */
+#define IRQ_LAT_KINDS (3U)
+
+/* Checked by irqlat_dump.py before it decodes the histograms */
+#define IRQ_LAT_MAGIC (0x54414C49U) /* "ILAT" */
+#define IRQ_LAT_VERSION (1U)
+
+/* Latency distribution in cycles, the trigger overhead is already
+ * subtracted. Only fixed-size integers, same layout on the host */
+typedef struct {
+	uint32_t samples;
+	uint32_t binCycles; /* Width of a histogram bin, 0 if never run */
+	uint32_t minCycles;
+	uint32_t maxCycles;
+	uint32_t sumCycles;
+	uint16_t histogram[IRQ_LAT_BINS]; /* Bin i is [i, i + 1) * binCycles */
+} IrqLat_Dist_st;
+
+/* RAM table read by Tools/irqlat_dump.py through the symbol g_irqLat */
+typedef struct {
+	uint32_t magic;
+	uint16_t version;
+	uint16_t loads;
+	uint16_t kinds;
+	uint16_t bins;
+	uint32_t cyclesPerUs;
+	uint32_t triggerCycles; /* Stamp plus HAL_EXTI_GenerateSWI(), subtracted */
+	uint32_t timeouts; /* Samples whose handler never ran */
+	IrqLat_Dist_st dist[IRQ_LAT_LOADS][IRQ_LAT_KINDS];
+} IrqLat_Table_st;
+
+extern IrqLat_Table_st g_irqLat;
+
+/**
+  * @brief  Clear the table, set up both EXTI lines, the DMA channel and the
+  *         DWT cycle counter, then measure the trigger overhead
+  * @note   Call after the clock configuration
+  * @param  None
+  * @retval false if a peripheral could not be set up
+  */
+bool IrqLat_init(void);
+
+/**
+  * @brief  Measure entry, tail-chaining and preemption latency under a load
+  * @note   Blocks in thread mode for the whole run. Interrupts at the
+  *         priority of line A and below are masked meanwhile
+  * @param  load: IRQ_LAT_LOAD_NONE, IRQ_LAT_LOAD_DMA or IRQ_LAT_LOAD_FLASH
+  * @param  samples: samples per response kind, up to 0xFFFF
+  * @param  binCycles: histogram bin width
+  * @retval None
+  */
+void IrqLat_run(uint32_t load, uint32_t samples, uint32_t binCycles);
+
+#endif
@@ -0,0 +1,229 @@
+/*****************************************************************************
+ * @file      jitter_monitor.c
+ * @author    Jet Station
+ * @brief     Activation jitter histograms and deadline misses of periodic work
+ * @date      [2026-10-17]
+ *
+ * Contact:
+ *   @website   https://jet-station.github.io/
+ *   @github    https://github.com/jet-station
+ *   @linkedin  https://www.linkedin.com/in/thien-ai-ho/
+ *   @email     thienaiho95@gmail.com
+ *
+ * @copyright  Copyright (c) 2026 Jet Station. All rights reserved.
+ *****************************************************************************/
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include "stm32f1xx_hal.h"
+#include "jitter_monitor.h"
+
+/* Per-channel jitter, response and miss counts for Tools/jitter_dump.py */
+JitterMon_Table_st g_jitterMon;
+
+/**
+  * @brief  Histogram bin of a jitter value
+  * @param  jitter: activation - release in cycles
+  * @param  binCycles: bin width
+  * @retval Bin index
+  */
+static uint32_t JitterMon_bin(int32_t jitter, uint32_t binCycles)
+{
+	int32_t l_bin_i32 = 0;
+
+	/* Round towards minus infinity so that [-binCycles, 0) is one bin */
+	if (jitter >= 0)
+	{
+		l_bin_i32 = (int32_t)((uint32_t)jitter / binCycles);
+	}
+	else
+	{
+		l_bin_i32 = -(int32_t)(((uint32_t)(-jitter) + binCycles - 1U) / binCycles);
+	}
+	l_bin_i32 += (int32_t)(JITTER_MON_BINS / 2U);
+
+	if (l_bin_i32 < 0)
+	{
+		l_bin_i32 = 0;
+	}
+	if (l_bin_i32 >= (int32_t)JITTER_MON_BINS)
+	{
+		l_bin_i32 = (int32_t)JITTER_MON_BINS - 1;
+	}
+
+	return (uint32_t)l_bin_i32;
+}
+
+/**
+  * @brief  Clear the table and enable the DWT cycle counter
+  * @param  None
+  * @retval None
+  */
+void JitterMon_init(void)
+{
+	(void)memset(&g_jitterMon, 0, sizeof(g_jitterMon));
+
+	g_jitterMon.magic = JITTER_MON_MAGIC;
+	g_jitterMon.version = JITTER_MON_VERSION;
+	g_jitterMon.channels = JITTER_MON_CHANNELS;
+	g_jitterMon.bins = JITTER_MON_BINS;
+	g_jitterMon.cyclesPerUs = SystemCoreClock / 1000000U;
+
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+/**
+  * @brief  Set up a channel for a periodic activity
+  * @param  channel: 0..JITTER_MON_CHANNELS-1
+  * @param  periodUs: nominal period
+  * @param  deadlineUs: relative deadline, 0 for the period
+  * @param  binUs: histogram bin width
+  * @retval None
+  */
+void JitterMon_setup(uint32_t channel, uint32_t periodUs, uint32_t deadlineUs, uint32_t binUs)
+{
+	JitterMon_Channel_st *l_channel_pst = NULL;
+	uint32_t l_index_u32 = 0U;
+
+	if ((channel >= JITTER_MON_CHANNELS) || (0U == periodUs) || (0U == binUs))
+	{
+		return;
+	}
+
+	l_channel_pst = &g_jitterMon.channel[channel];
+	l_channel_pst->periodCycles = periodUs * g_jitterMon.cyclesPerUs;
+	l_channel_pst->deadlineCycles = ((0U != deadlineUs) ? deadlineUs : periodUs) * g_jitterMon.cyclesPerUs;
+	l_channel_pst->binCycles = binUs * g_jitterMon.cyclesPerUs;
+	l_channel_pst->activations = 0U;
+	l_channel_pst->deadlineMisses = 0U;
+	l_channel_pst->minJitter = INT32_MAX;
+	l_channel_pst->maxJitter = INT32_MIN;
+	l_channel_pst->maxResponse = 0U;
+	for (l_index_u32 = 0U; l_index_u32 < JITTER_MON_BINS; l_index_u32++)
+	{
+		l_channel_pst->histogram[l_index_u32] = 0U;
+	}
+}
+
+/**
+  * @brief  Record the release jitter of an activation
+  * @param  channel: channel table entry
+  * @param  release: CYCCNT of the nominal release
+  * @param  now: CYCCNT of the activation
+  * @retval None
+  */
+static void JitterMon_record(JitterMon_Channel_st *channel, uint32_t release, uint32_t now)
+{
+	int32_t l_jitter_i32 = (int32_t)(now - release);
+
+	if (l_jitter_i32 < channel->minJitter)
+	{
+		channel->minJitter = l_jitter_i32;
+	}
+	if (l_jitter_i32 > channel->maxJitter)
+	{
+		channel->maxJitter = l_jitter_i32;
+	}
+	channel->histogram[JitterMon_bin(l_jitter_i32, channel->binCycles)]++;
+
+	channel->release = release;
+	channel->activations++;
+}
+
+/**
+  * @brief  Record an activation at the start of the periodic work
+  * @param  channel: channel set up with JitterMon_setup()
+  * @retval None
+  */
+void JitterMon_activate(uint32_t channel)
+{
+	uint32_t l_now_u32 = DWT->CYCCNT;
+	JitterMon_Channel_st *l_channel_pst = NULL;
+
+	if ((channel >= JITTER_MON_CHANNELS) || (0U == g_jitterMon.channel[channel].periodCycles))
+	{
+		return;
+	}
+
+	l_channel_pst = &g_jitterMon.channel[channel];
+
+	/* The first activation only places the release grid */
+	if (0U == l_channel_pst->activations)
+	{
+		l_channel_pst->release = l_now_u32;
+		l_channel_pst->activations++;
+		return;
+	}
+
+	JitterMon_record(l_channel_pst, l_channel_pst->release + l_channel_pst->periodCycles, l_now_u32);
+}
+
+/**
+  * @brief  Record an activation released by a scheduler on the HAL tick
+  * @param  channel: channel set up with JitterMon_setup()
+  * @param  releaseTick: HAL_GetTick() value the activation was due at
+  * @retval None
+  */
+void JitterMon_activateTick(uint32_t channel, uint32_t releaseTick)
+{
+	uint32_t l_tick_u32 = 0U;
+	uint32_t l_now_u32 = 0U;
+	uint32_t l_val_u32 = 0U;
+	uint32_t l_intoTick_u32 = 0U;
+
+	if ((channel >= JITTER_MON_CHANNELS) || (0U == g_jitterMon.channel[channel].periodCycles))
+	{
+		return;
+	}
+
+	/* Tick, cycle counter and SysTick counter of one tick, retried if the
+	 * SysTick interrupt ends the tick in between */
+	do
+	{
+		l_tick_u32 = HAL_GetTick();
+		l_now_u32 = DWT->CYCCNT;
+		l_val_u32 = SysTick->VAL;
+	} while (l_tick_u32 != HAL_GetTick());
+
+	/* uwTick moves by the tick frequency when VAL reaches 0, VAL reloads on
+	 * the next clock */
+	if (0U != l_val_u32)
+	{
+		l_intoTick_u32 = ((uint32_t)HAL_GetTickFreq() * g_jitterMon.cyclesPerUs * 1000U) - l_val_u32;
+	}
+
+	JitterMon_record(&g_jitterMon.channel[channel],
+	                 l_now_u32 - l_intoTick_u32 - ((l_tick_u32 - releaseTick) * g_jitterMon.cyclesPerUs * 1000U),
+	                 l_now_u32);
+}
+
+/**
+  * @brief  Record the completion of the current activation
+  * @param  channel: channel set up with JitterMon_setup()
+  * @retval None
+  */
+void JitterMon_complete(uint32_t channel)
+{
+	uint32_t l_now_u32 = DWT->CYCCNT;
+	JitterMon_Channel_st *l_channel_pst = NULL;
+	uint32_t l_response_u32 = 0U;
+
+	if ((channel >= JITTER_MON_CHANNELS) || (0U == g_jitterMon.channel[channel].periodCycles))
+	{
+		return;
+	}
+
+	l_channel_pst = &g_jitterMon.channel[channel];
+	l_response_u32 = l_now_u32 - l_channel_pst->release;
+
+	if (l_response_u32 > l_channel_pst->maxResponse)
+	{
+		l_channel_pst->maxResponse = l_response_u32;
+	}
+	if (l_response_u32 > l_channel_pst->deadlineCycles)
+	{
+		l_channel_pst->deadlineMisses++;
+	}
+}
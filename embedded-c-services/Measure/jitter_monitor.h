@@ -0,0 +1,109 @@
+/*****************************************************************************
+ * @file      jitter_monitor.h
+ * @author    Jet Station
+ * @brief     Activation jitter histograms and deadline misses of periodic work
+ * @date      [2026-10-17]
+ *
+ * Contact:
+ *   @website   https://jet-station.github.io/
+ *   @github    https://github.com/jet-station
+ *   @linkedin  https://www.linkedin.com/in/thien-ai-ho/
+ *   @email     thienaiho95@gmail.com
+ *
+ * @copyright  Copyright (c) 2026 Jet Station. All rights reserved.
+ *****************************************************************************/
+
+#ifndef __JITTER_MONITOR_H__
+#define __JITTER_MONITOR_H__
+
+#include <stdint.h>
+
+/* Number of monitored activities */
+#ifndef JITTER_MON_CHANNELS
+#define JITTER_MON_CHANNELS (8U)
+#endif
+
+/* Histogram bins per channel, the first and the last bin also collect
+ * everything beyond them */
+#ifndef JITTER_MON_BINS
+#define JITTER_MON_BINS (16U)
+#endif
+
+/* jitter_dump.py looks for the magic, version 2 measures from the release */
+#define JITTER_MON_MAGIC (0x4E4F4D4AU) /* "JMON" */
+#define JITTER_MON_VERSION (2U)
+
+/* One periodic activity. Only fixed-size integers, the layout is the same
+ * for the target and the host dumper */
+typedef struct {
+	uint32_t periodCycles; /* Nominal activation period, 0 if unused */
+	uint32_t deadlineCycles; /* Relative deadline from the release */
+	uint32_t binCycles; /* Width of a histogram bin */
+	uint32_t release; /* CYCCNT of the nominal release of the last activation */
+	uint32_t activations;
+	uint32_t deadlineMisses;
+	int32_t minJitter; /* Activation - release, in cycles */
+	int32_t maxJitter;
+	uint32_t maxResponse; /* Longest release to completion, in cycles */
+	uint32_t histogram[JITTER_MON_BINS]; /* Bin JITTER_MON_BINS / 2 is [0, binCycles) */
+} JitterMon_Channel_st;
+
+/* RAM table read by Tools/jitter_dump.py through the symbol g_jitterMon */
+typedef struct {
+	uint32_t magic;
+	uint16_t version;
+	uint16_t channels;
+	uint16_t bins;
+	uint16_t reserved;
+	uint32_t cyclesPerUs;
+	JitterMon_Channel_st channel[JITTER_MON_CHANNELS];
+} JitterMon_Table_st;
+
+extern JitterMon_Table_st g_jitterMon;
+
+/**
+  * @brief  Clear the table and enable the DWT cycle counter
+  * @param  None
+  * @retval None
+  */
+void JitterMon_init(void);
+
+/**
+  * @brief  Set up a channel for a periodic activity
+  * @param  channel: 0..JITTER_MON_CHANNELS-1
+  * @param  periodUs: nominal period
+  * @param  deadlineUs: relative deadline, 0 for the period
+  * @param  binUs: histogram bin width
+  * @retval None
+  */
+void JitterMon_setup(uint32_t channel, uint32_t periodUs, uint32_t deadlineUs, uint32_t binUs);
+
+/**
+  * @brief  Record an activation at the start of the periodic work
+  * @note   Releases are nominal: the first activation sets release 0,
+  *         release n follows n periods later. Every release must activate
+  *         once. Safe from ISRs, one channel must have one caller only
+  * @param  channel: channel set up with JitterMon_setup()
+  * @retval None
+  */
+void JitterMon_activate(uint32_t channel);
+
+/**
+  * @brief  Record an activation released by a scheduler on the HAL tick
+  * @note   The release is the start of the tick, taken from SysTick->VAL.
+  *         Call it with interrupts enabled, a pending SysTick interrupt
+  *         would leave the tick one behind
+  * @param  channel: channel set up with JitterMon_setup()
+  * @param  releaseTick: HAL_GetTick() value the activation was due at
+  * @retval None
+  */
+void JitterMon_activateTick(uint32_t channel, uint32_t releaseTick);
+
+/**
+  * @brief  Record the completion of the current activation
+  * @param  channel: channel set up with JitterMon_setup()
+  * @retval None
+  */
+void JitterMon_complete(uint32_t channel);
+
+#endif
@@ -0,0 +1,267 @@
+/*****************************************************************************
+ * @file      micro_bench.c
+ * @author    Jet Station
+ * @brief     Micro-benchmark framework on the DWT cycle counter
+ * @date      [2026-10-17]
+ *
+ * Contact:
+ *   @website   https://jet-station.github.io/
+ *   @github    https://github.com/jet-station
+ *   @linkedin  https://www.linkedin.com/in/thien-ai-ho/
+ *   @email     thienaiho95@gmail.com
+ *
+ * @copyright  Copyright (c) 2026 Jet Station. All rights reserved.
+ *****************************************************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+#include "stm32f1xx.h"
+#include "micro_bench.h"
+
+/* Cycle source, a host build can supply its own counter */
+#ifndef BENCH_READ_CYCLES
+#define BENCH_READ_CYCLES() (DWT->CYCCNT)
+#endif
+
+/* Cases of Bench_add() */
+static Bench_Case_st s_cases[BENCH_MAX_CASES];
+static uint32_t s_caseCount_u32 = 0U;
+static uint32_t s_addSkipped_u32 = 0U;
+
+/* Samples of the case being measured */
+static uint32_t s_samples_u32[BENCH_MAX_SAMPLES];
+
+/* Statistics per case, printed by Tools/bench_dump.py */
+Bench_Table_st g_benchResults;
+
+/**
+  * @brief  Empty case, its cost is the measurement overhead
+  * @param  None
+  * @retval None
+  */
+static void Bench_empty(void)
+{
+}
+
+/**
+  * @brief  Integer square root
+  * @param  value: radicand
+  * @retval floor(sqrt(value))
+  */
+static uint32_t Bench_sqrt(uint64_t value)
+{
+	uint64_t l_root_u64 = 0U;
+	uint64_t l_bit_u64 = 1ULL << 62;
+
+	while (l_bit_u64 > value)
+	{
+		l_bit_u64 >>= 2;
+	}
+	while (0U != l_bit_u64)
+	{
+		if (value >= (l_root_u64 + l_bit_u64))
+		{
+			value -= l_root_u64 + l_bit_u64;
+			l_root_u64 = (l_root_u64 >> 1) + l_bit_u64;
+		}
+		else
+		{
+			l_root_u64 >>= 1;
+		}
+		l_bit_u64 >>= 2;
+	}
+
+	return (uint32_t)l_root_u64;
+}
+
+/**
+  * @brief  Take the samples of one function, sorted ascending
+  * @param  fn: function under test
+  * @param  warmup: untimed calls
+  * @param  iterations: samples, up to BENCH_MAX_SAMPLES
+  * @retval None
+  */
+static void Bench_sample(Bench_Fn fn, uint32_t warmup, uint32_t iterations)
+{
+	uint32_t l_primask_u32 = 0U;
+	uint32_t l_start_u32 = 0U;
+	uint32_t l_end_u32 = 0U;
+	uint32_t l_value_u32 = 0U;
+	uint32_t l_index_u32 = 0U;
+	uint32_t l_pos_u32 = 0U;
+
+	for (l_index_u32 = 0U; l_index_u32 < warmup; l_index_u32++)
+	{
+		fn();
+	}
+
+	for (l_index_u32 = 0U; l_index_u32 < iterations; l_index_u32++)
+	{
+		/* A tick interrupt inside a sample would dominate a short case */
+		l_primask_u32 = __get_PRIMASK();
+		__disable_irq();
+		l_start_u32 = BENCH_READ_CYCLES();
+		fn();
+		l_end_u32 = BENCH_READ_CYCLES();
+		__set_PRIMASK(l_primask_u32);
+
+		/* Insertion sort while sampling, the median is then the middle */
+		l_value_u32 = l_end_u32 - l_start_u32;
+		for (l_pos_u32 = l_index_u32; (l_pos_u32 > 0U) && (s_samples_u32[l_pos_u32 - 1U] > l_value_u32); l_pos_u32--)
+		{
+			s_samples_u32[l_pos_u32] = s_samples_u32[l_pos_u32 - 1U];
+		}
+		s_samples_u32[l_pos_u32] = l_value_u32;
+	}
+}
+
+/**
+  * @brief  Sample one case and store its statistics
+  * @param  result: entry of the results table
+  * @param  benchCase: case to measure
+  * @param  baseline: median cycles of an empty measurement
+  * @param  warmup: untimed calls
+  * @param  iterations: samples, 1 up to BENCH_MAX_SAMPLES
+  * @retval None
+  */
+static void Bench_measure(Bench_Result_st *result, const Bench_Case_st *benchCase, uint32_t baseline,
+                          uint32_t warmup, uint32_t iterations)
+{
+	uint64_t l_sum_u64 = 0U;
+	uint64_t l_sumSq_u64 = 0U;
+	uint64_t l_mean_u64 = 0U;
+	uint32_t l_value_u32 = 0U;
+	uint32_t l_index_u32 = 0U;
+
+	Bench_sample(benchCase->fn, warmup, iterations);
+
+	for (l_index_u32 = 0U; l_index_u32 < iterations; l_index_u32++)
+	{
+		l_value_u32 = s_samples_u32[l_index_u32];
+		l_value_u32 = (l_value_u32 > baseline) ? (l_value_u32 - baseline) : 0U;
+		s_samples_u32[l_index_u32] = l_value_u32;
+		l_sum_u64 += l_value_u32;
+		l_sumSq_u64 += (uint64_t)l_value_u32 * l_value_u32;
+	}
+
+	for (l_index_u32 = 0U; (l_index_u32 < (BENCH_NAME_LEN - 1U)) && ('\0' != benchCase->name[l_index_u32]); l_index_u32++)
+	{
+		result->name[l_index_u32] = benchCase->name[l_index_u32];
+	}
+	result->name[l_index_u32] = '\0';
+
+	/* Variance in 1/10000 cycle^2 so that the root is in 1/100 cycle */
+	l_mean_u64 = l_sum_u64 / iterations;
+	result->iterations = iterations;
+	result->min = s_samples_u32[0];
+	result->median = s_samples_u32[iterations / 2U];
+	result->max = s_samples_u32[iterations - 1U];
+	result->mean = (uint32_t)l_mean_u64;
+	result->stddevCenti = Bench_sqrt(((l_sumSq_u64 * 10000U) / iterations) -
+	                                 (((l_sum_u64 * 100U) / iterations) * ((l_sum_u64 * 100U) / iterations)));
+}
+
+/**
+  * @brief  Clear the cases and the results, enable the DWT cycle counter
+  * @param  None
+  * @retval None
+  */
+void Bench_init(void)
+{
+	(void)memset(&g_benchResults, 0, sizeof(g_benchResults));
+
+	g_benchResults.magic = BENCH_MAGIC;
+	g_benchResults.version = BENCH_VERSION;
+	g_benchResults.maxCases = BENCH_MAX_CASES;
+	g_benchResults.nameLen = BENCH_NAME_LEN;
+	g_benchResults.cyclesPerUs = SystemCoreClock / 1000000U;
+	s_caseCount_u32 = 0U;
+	s_addSkipped_u32 = 0U;
+
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+/**
+  * @brief  Register a benchmark case at runtime
+  * @param  name: short name
+  * @param  fn: function under test
+  * @retval false if the case table is full, the case is counted as skipped
+  */
+bool Bench_add(const char *name, Bench_Fn fn)
+{
+	if ((NULL == name) || (NULL == fn))
+	{
+		return false;
+	}
+	if (s_caseCount_u32 >= BENCH_MAX_CASES)
+	{
+		s_addSkipped_u32++;
+		return false;
+	}
+
+	s_cases[s_caseCount_u32].name = name;
+	s_cases[s_caseCount_u32].fn = fn;
+	s_caseCount_u32++;
+
+	return true;
+}
+
+/**
+  * @brief  Run the setup hooks, measure the baseline, then warm up and
+  *         sample every case
+  * @param  warmup: untimed calls before the samples
+  * @param  iterations: samples per case, up to BENCH_MAX_SAMPLES
+  * @retval Number of skipped cases
+  */
+uint32_t Bench_runAll(uint32_t warmup, uint32_t iterations)
+{
+	uint32_t l_baseline_u32 = 0U;
+	uint32_t l_case_u32 = 0U;
+	uint32_t l_count_u32 = 0U;
+	uint32_t l_skipped_u32 = s_addSkipped_u32;
+
+	if (0U == iterations)
+	{
+		return 0U;
+	}
+	if (iterations > BENCH_MAX_SAMPLES)
+	{
+		iterations = BENCH_MAX_SAMPLES;
+	}
+
+	REGISTRY_FOREACH(benchSetup, Bench_Fn, l_setup_pfn)
+	{
+		(*l_setup_pfn)();
+	}
+
+	/* Same call path with an empty body: counter reads and indirect call */
+	Bench_sample(Bench_empty, warmup, iterations);
+	l_baseline_u32 = s_samples_u32[iterations / 2U];
+	g_benchResults.baseline = l_baseline_u32;
+
+	/* Runtime cases first, then the registry */
+	for (l_case_u32 = 0U; l_case_u32 < s_caseCount_u32; l_case_u32++)
+	{
+		Bench_measure(&g_benchResults.result[l_count_u32], &s_cases[l_case_u32], l_baseline_u32, warmup, iterations);
+		l_count_u32++;
+	}
+	REGISTRY_FOREACH(bench, Bench_Case_st, l_case_pst)
+	{
+		if (l_count_u32 >= BENCH_MAX_CASES)
+		{
+			/* No room in the results table, counted for the dumper */
+			l_skipped_u32++;
+			continue;
+		}
+		Bench_measure(&g_benchResults.result[l_count_u32], l_case_pst, l_baseline_u32, warmup, iterations);
+		l_count_u32++;
+	}
+
+	g_benchResults.count = (uint16_t)l_count_u32;
+	g_benchResults.skipped = l_skipped_u32;
+
+	return l_skipped_u32;
+}
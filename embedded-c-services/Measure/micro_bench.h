@@ -0,0 +1,120 @@
+/*****************************************************************************
+ * @file      micro_bench.h
+ * @author    Jet Station
+ * @brief     Micro-benchmark framework on the DWT cycle counter
+ * @date      [2026-10-17]
+ *
+ * Contact:
+ *   @website   https://jet-station.github.io/
+ *   @github    https://github.com/jet-station
+ *   @linkedin  https://www.linkedin.com/in/thien-ai-ho/
+ *   @email     thienaiho95@gmail.com
+ *
+ * @copyright  Copyright (c) 2026 Jet Station. All rights reserved.
+ *****************************************************************************/
+
+#ifndef __MICRO_BENCH_H__
+#define __MICRO_BENCH_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "registry.h"
+
+/* Number of benchmark cases in the results table */
+#ifndef BENCH_MAX_CASES
+#define BENCH_MAX_CASES (8U)
+#endif
+
+/* Samples kept per case for the median, more iterations are clamped */
+#ifndef BENCH_MAX_SAMPLES
+#define BENCH_MAX_SAMPLES (64U)
+#endif
+
+/* Case name length in the results table, including the terminator */
+#define BENCH_NAME_LEN (16U)
+
+/* Identifies the results for bench_dump.py, version 2 added skipped */
+#define BENCH_MAGIC (0x48434E42U) /* "BNCH" */
+#define BENCH_VERSION (2U)
+
+typedef void (*Bench_Fn)(void);
+
+/* Benchmark case */
+typedef struct {
+	const char *name;
+	Bench_Fn fn;
+} Bench_Case_st;
+
+/* Cases registered at link time with BENCH_CASE(), in flash */
+REGISTRY_DECLARE(bench, Bench_Case_st);
+
+/* Register a case from any module without a call at startup:
+ *   BENCH_CASE(s_macroCase, "macro", Test_callMacroFunc);
+ * Bench_runAll() runs them after the cases of Bench_add() */
+#define BENCH_CASE(id, name, fn) REGISTRY_ADD(bench, Bench_Case_st, id) = { (name), (fn) }
+
+/* Setup hooks, in flash like the cases */
+REGISTRY_DECLARE(benchSetup, Bench_Fn);
+
+/* Prepare the inputs of a module's cases, run once by Bench_runAll()
+ * before the baseline, untimed:
+ *   BENCH_SETUP(s_kernelSetup, KernelSuite_setup); */
+#define BENCH_SETUP(id, fn) REGISTRY_ADD(benchSetup, Bench_Fn, id) = (fn)
+
+/* Statistics of one case in cycles, the empty-measurement baseline is
+ * already subtracted. Fixed-size integers only, same layout on the host */
+typedef struct {
+	char name[BENCH_NAME_LEN];
+	uint32_t iterations;
+	uint32_t min;
+	uint32_t median;
+	uint32_t max;
+	uint32_t mean;
+	uint32_t stddevCenti; /* Standard deviation in 1/100 cycle */
+} Bench_Result_st;
+
+/* RAM table read by Tools/bench_dump.py through the symbol g_benchResults */
+typedef struct {
+	uint32_t magic;
+	uint16_t version;
+	uint16_t maxCases;
+	uint16_t count; /* Valid entries of result[] */
+	uint16_t nameLen;
+	uint32_t cyclesPerUs;
+	uint32_t baseline; /* Median cycles of an empty measurement */
+	uint32_t skipped; /* Cases not run, beyond BENCH_MAX_CASES */
+	Bench_Result_st result[BENCH_MAX_CASES];
+} Bench_Table_st;
+
+extern Bench_Table_st g_benchResults;
+
+/**
+  * @brief  Clear the cases and the results, enable the DWT cycle counter
+  * @param  None
+  * @retval None
+  */
+void Bench_init(void);
+
+/**
+  * @brief  Register a benchmark case at runtime, e.g. one that needs its
+  *         inputs prepared first
+  * @param  name: short name, truncated to BENCH_NAME_LEN - 1 characters
+  * @param  fn: function under test, called once per sample
+  * @retval false if the case table is full, the case is counted as skipped
+  */
+bool Bench_add(const char *name, Bench_Fn fn);
+
+/**
+  * @brief  Run the setup hooks, measure the baseline, then warm up and
+  *         sample every case
+  * @note   Interrupts are masked around each sample. Cases beyond
+  *         BENCH_MAX_CASES are not run, they are counted in
+  *         g_benchResults.skipped
+  * @param  warmup: untimed calls before the samples, fills caches and
+  *         flash prefetch buffers
+  * @param  iterations: samples per case, up to BENCH_MAX_SAMPLES
+  * @retval Number of skipped cases, 0 if every case was run
+  */
+uint32_t Bench_runAll(uint32_t warmup, uint32_t iterations);
+
+#endif
@@ -0,0 +1,184 @@
+/*****************************************************************************
+ * @file      pc_profiler.c
+ * @author    Jet Station
+ * @brief     Statistical PC-sampling profiler on a TIM interrupt
+ * @date      [2026-10-17]
+ *
+ * Contact:
+ *   @website   https://jet-station.github.io/
+ *   @github    https://github.com/jet-station
+ *   @linkedin  https://www.linkedin.com/in/thien-ai-ho/
+ *   @email     thienaiho95@gmail.com
+ *
+ * @copyright  Copyright (c) 2026 Jet Station. All rights reserved.
+ *****************************************************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+#include "stm32f1xx_hal.h"
+#include "pc_profiler.h"
+
+/* Index of the stacked registers in the exception frame */
+#define PC_PROF_FRAME_LR (5U)
+#define PC_PROF_FRAME_PC (6U)
+
+/* PC and caller bins, symbolized by Tools/prof_dump.py with the map file */
+PcProf_Table_st g_pcProf;
+
+static TIM_HandleTypeDef s_htim;
+
+/* Auto-reload for the shortest dithered period */
+static uint32_t s_reloadBase_u32 = 0U;
+
+/* xorshift32 state of the dither */
+static uint32_t s_dither_u32 = 0x2545F491U;
+
+/**
+  * @brief  Clear the histogram and start sampling
+  * @param  None
+  * @retval false if the timer could not be set up
+  */
+bool PcProf_start(void)
+{
+	uint32_t l_timClock_u32 = HAL_RCC_GetPCLK1Freq();
+
+	PcProf_stop();
+
+	(void)memset(&g_pcProf, 0, sizeof(g_pcProf));
+
+	g_pcProf.magic = PC_PROF_MAGIC;
+	g_pcProf.version = PC_PROF_VERSION;
+	g_pcProf.bins = (uint16_t)PC_PROF_BINS;
+	g_pcProf.binShift = PC_PROF_BIN_SHIFT;
+	g_pcProf.callerBins = (uint16_t)PC_PROF_CALLER_BINS;
+	g_pcProf.callerShift = PC_PROF_CALLER_SHIFT;
+	g_pcProf.periodUs = PC_PROF_PERIOD_US;
+	g_pcProf.codeBase = PC_PROF_CODE_BASE;
+
+	/* APB1 timers run at twice PCLK1 when the APB1 prescaler is not 1 */
+	if ((RCC->CFGR & RCC_CFGR_PPRE1) != RCC_CFGR_PPRE1_DIV1)
+	{
+		l_timClock_u32 *= 2U;
+	}
+
+	/* Mean period PC_PROF_PERIOD_US: base reload plus half the dither range */
+	s_reloadBase_u32 = PC_PROF_PERIOD_US - (PC_PROF_DITHER_MASK / 2U) - 1U;
+
+	PC_PROF_TIM_CLK_ENABLE();
+	s_htim.Instance = PC_PROF_TIM;
+	s_htim.Init.Prescaler = (l_timClock_u32 / 1000000U) - 1U;
+	s_htim.Init.CounterMode = TIM_COUNTERMODE_UP;
+	s_htim.Init.Period = s_reloadBase_u32;
+	s_htim.Init.ClockDivision = TIM_CLOCKDIVISION_DIV1;
+	s_htim.Init.RepetitionCounter = 0U;
+	/* A new reload written in the handler applies from the next period on */
+	s_htim.Init.AutoReloadPreload = TIM_AUTORELOAD_PRELOAD_ENABLE;
+	if (HAL_OK != HAL_TIM_Base_Init(&s_htim))
+	{
+		return false;
+	}
+
+	HAL_NVIC_SetPriority(PC_PROF_TIM_IRQn, PC_PROF_IRQ_PRIO, 0U);
+	HAL_NVIC_EnableIRQ(PC_PROF_TIM_IRQn);
+
+	if (HAL_OK != HAL_TIM_Base_Start_IT(&s_htim))
+	{
+		return false;
+	}
+	g_pcProf.state = PC_PROF_RUNNING;
+
+	return true;
+}
+
+/**
+  * @brief  Stop sampling, the histogram is kept
+  * @param  None
+  * @retval None
+  */
+void PcProf_stop(void)
+{
+	if (NULL != s_htim.Instance)
+	{
+		(void)HAL_TIM_Base_Stop_IT(&s_htim);
+	}
+	if (PC_PROF_RUNNING == g_pcProf.state)
+	{
+		g_pcProf.state = PC_PROF_STOPPED;
+	}
+}
+
+/**
+  * @brief  Record one sample from an exception frame
+  * @param  frame: stacked r0-r3, r12, lr, pc, xPSR
+  * @retval None
+  */
+void PcProf_sample(const uint32_t *frame)
+{
+	/* Offsets wrap to large values below the base, one compare per range */
+	uint32_t l_pc_u32 = frame[PC_PROF_FRAME_PC] - PC_PROF_CODE_BASE;
+	uint32_t l_lr_u32 = (frame[PC_PROF_FRAME_LR] & ~1UL) - PC_PROF_CODE_BASE;
+	uint16_t *l_bin_pu16 = NULL;
+
+	/* Same as HAL_TIM_IRQHandler() for the update event, without the
+	 * dispatch through every interrupt source */
+	__HAL_TIM_CLEAR_IT(&s_htim, TIM_IT_UPDATE);
+
+	s_dither_u32 ^= s_dither_u32 << 13;
+	s_dither_u32 ^= s_dither_u32 >> 17;
+	s_dither_u32 ^= s_dither_u32 << 5;
+	PC_PROF_TIM->ARR = s_reloadBase_u32 + (s_dither_u32 & PC_PROF_DITHER_MASK);
+
+	g_pcProf.samples++;
+
+	if (l_pc_u32 < PC_PROF_CODE_SIZE)
+	{
+		l_bin_pu16 = &g_pcProf.pc[l_pc_u32 >> PC_PROF_BIN_SHIFT];
+		(*l_bin_pu16)++;
+		if (0xFFFFU == *l_bin_pu16)
+		{
+			/* Stop before a bin wraps, the ratios stay valid */
+			__HAL_TIM_DISABLE_IT(&s_htim, TIM_IT_UPDATE);
+			g_pcProf.state = PC_PROF_FULL;
+		}
+	}
+	else
+	{
+		g_pcProf.outside++;
+	}
+
+	/* The stacked LR is the caller only until the interrupted function
+	 * reuses it, bins of an unrelated LR value just stay sparse */
+	if (l_lr_u32 < PC_PROF_CODE_SIZE)
+	{
+		l_bin_pu16 = &g_pcProf.caller[l_lr_u32 >> PC_PROF_CALLER_SHIFT];
+		if (0xFFFFU != *l_bin_pu16)
+		{
+			(*l_bin_pu16)++;
+		}
+	}
+}
+
+/* PC_PROF_TIM_IRQHandler samples the stacked PC, it is only built with
+ * PC_PROFILER so that TIM3 stays free for the application otherwise */
+#if defined(PC_PROFILER)
+
+/**
+  * @brief  Sampling interrupt, passes the stacked frame to PcProf_sample()
+  * @note   Owned by the profiler: disable the generated handler in CubeMX
+  * @param  None
+  * @retval None
+  */
+__attribute__((naked)) void PC_PROF_TIM_IRQHandler(void)
+{
+	__ASM volatile (
+		"	tst   lr, #4                     \n" /* EXC_RETURN bit 2: frame on PSP */
+		"	ite   eq                         \n"
+		"	mrseq r0, msp                    \n"
+		"	mrsne r0, psp                    \n"
+		"	b     PcProf_sample              \n"
+	);
+}
+
+#endif /* PC_PROFILER */
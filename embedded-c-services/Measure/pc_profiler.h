@@ -0,0 +1,119 @@
+/*****************************************************************************
+ * @file      pc_profiler.h
+ * @author    Jet Station
+ * @brief     Statistical PC-sampling profiler on a TIM interrupt
+ * @date      [2026-10-17]
+ *
+ * Contact:
+ *   @website   https://jet-station.github.io/
+ *   @github    https://github.com/jet-station
+ *   @linkedin  https://www.linkedin.com/in/thien-ai-ho/
+ *   @email     thienaiho95@gmail.com
+ *
+ * @copyright  Copyright (c) 2026 Jet Station. All rights reserved.
+ *****************************************************************************/
+
+#ifndef __PC_PROFILER_H__
+#define __PC_PROFILER_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Sampling timer, a spare APB1 timer owned by the profiler. The handler is
+ * defined in pc_profiler.c, do not generate it in CubeMX */
+#ifndef PC_PROF_TIM
+#define PC_PROF_TIM TIM3
+#define PC_PROF_TIM_IRQn TIM3_IRQn
+#define PC_PROF_TIM_IRQHandler TIM3_IRQHandler
+#define PC_PROF_TIM_CLK_ENABLE() __HAL_RCC_TIM3_CLK_ENABLE()
+#endif
+
+/* NVIC priority of the sampling interrupt. 0 also samples the other ISRs,
+ * code running with PRIMASK set is seen at the point it unmasks */
+#ifndef PC_PROF_IRQ_PRIO
+#define PC_PROF_IRQ_PRIO (0U)
+#endif
+
+/* Mean sampling period. The period is dithered so that the samples do not
+ * lock onto the phase of periodic tasks on the 1 ms tick */
+#ifndef PC_PROF_PERIOD_US
+#define PC_PROF_PERIOD_US (2000U)
+#endif
+#define PC_PROF_DITHER_MASK (0xFFU)
+
+#if (PC_PROF_PERIOD_US <= PC_PROF_DITHER_MASK) || (PC_PROF_PERIOD_US > 0xFFFFU)
+#error "PC_PROF_PERIOD_US must be above the dither range and fit the 16-bit timer"
+#endif
+
+/* Profiled code range, the whole flash of the STM32F103C6 */
+#ifndef PC_PROF_CODE_BASE
+#define PC_PROF_CODE_BASE (0x08000000UL)
+#endif
+#ifndef PC_PROF_CODE_SIZE
+#define PC_PROF_CODE_SIZE (0x8000UL)
+#endif
+
+/* Histogram resolution: 64-byte bins for the PC, 256-byte bins for the
+ * caller (stacked LR), 1.25 KB of RAM for 32 KB of flash */
+#ifndef PC_PROF_BIN_SHIFT
+#define PC_PROF_BIN_SHIFT (6U)
+#endif
+#ifndef PC_PROF_CALLER_SHIFT
+#define PC_PROF_CALLER_SHIFT (8U)
+#endif
+
+#define PC_PROF_BINS (PC_PROF_CODE_SIZE >> PC_PROF_BIN_SHIFT)
+#define PC_PROF_CALLER_BINS (PC_PROF_CODE_SIZE >> PC_PROF_CALLER_SHIFT)
+
+/* Magic checked by prof_dump.py, the version is printed with the profile */
+#define PC_PROF_MAGIC (0x46525050U) /* "PPRF" */
+#define PC_PROF_VERSION (1U)
+
+/* Profiler state in the table */
+#define PC_PROF_STOPPED (0U)
+#define PC_PROF_RUNNING (1U)
+#define PC_PROF_FULL (2U) /* A PC bin reached 0xFFFF, sampling stopped */
+
+/* RAM table read by Tools/prof_dump.py through the symbol g_pcProf */
+typedef struct {
+	uint32_t magic;
+	uint16_t version;
+	uint16_t bins;
+	uint16_t binShift;
+	uint16_t callerBins;
+	uint16_t callerShift;
+	uint16_t periodUs;
+	uint32_t codeBase;
+	uint32_t samples; /* All samples, including the ones outside the code range */
+	uint32_t outside; /* PC outside the code range, e.g. code in RAM */
+	volatile uint32_t state;
+	uint16_t pc[PC_PROF_BINS]; /* Samples per PC bin */
+	uint16_t caller[PC_PROF_CALLER_BINS]; /* Samples per return address bin */
+} PcProf_Table_st;
+
+extern PcProf_Table_st g_pcProf;
+
+/**
+  * @brief  Clear the histogram and start sampling
+  * @note   Call after the clock configuration, the timer runs at 1 MHz
+  * @param  None
+  * @retval false if the timer could not be set up
+  */
+bool PcProf_start(void);
+
+/**
+  * @brief  Stop sampling, the histogram is kept
+  * @param  None
+  * @retval None
+  */
+void PcProf_stop(void);
+
+/**
+  * @brief  Record one sample from an exception frame
+  * @note   Called by the sampling interrupt handler only
+  * @param  frame: stacked r0-r3, r12, lr, pc, xPSR
+  * @retval None
+  */
+void PcProf_sample(const uint32_t *frame);
+
+#endif
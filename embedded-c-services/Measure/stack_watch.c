@@ -0,0 +1,102 @@
+/*****************************************************************************
+ * @file      stack_watch.c
+ * @author    Jet Station
+ * @brief     Stack painting and high-water-mark measurement
+ * @date      [2026-10-17]
+ *
+ * Contact:
+ *   @website   https://jet-station.github.io/
+ *   @github    https://github.com/jet-station
+ *   @linkedin  https://www.linkedin.com/in/thien-ai-ho/
+ *   @email     thienaiho95@gmail.com
+ *
+ * @copyright  Copyright (c) 2026 Jet Station. All rights reserved.
+ *****************************************************************************/
+
+#include <stdint.h>
+#include "stm32f1xx.h"
+#include "stack_watch.h"
+
+/* Bottom of the MSP stack: Stack_Mem of the Keil startup file (exported
+ * there), the stack reserved by _Min_Stack_Size under _estack for GCC. The
+ * top is the initial SP, word 0 of the vector table */
+#if defined(__ARMCC_VERSION)
+extern uint32_t Stack_Mem[];
+#define STACK_WATCH_MSP_BASE ((uint32_t)Stack_Mem)
+#else
+extern uint8_t _estack;
+extern uint8_t _Min_Stack_Size;
+#define STACK_WATCH_MSP_BASE ((uint32_t)&_estack - (uint32_t)&_Min_Stack_Size)
+#endif
+#define STACK_WATCH_MSP_TOP (*(const uint32_t *)SCB->VTOR)
+
+/**
+  * @brief  Fill a task stack with STACK_WATCH_PATTERN
+  * @param  stack: lowest word of the stack
+  * @param  words: stack size in 32-bit words
+  * @retval None
+  */
+void StackWatch_paint(uint32_t *stack, uint32_t words)
+{
+	uint32_t l_index_u32 = 0U;
+
+	for (l_index_u32 = 0U; l_index_u32 < words; l_index_u32++)
+	{
+		stack[l_index_u32] = STACK_WATCH_PATTERN;
+	}
+}
+
+/**
+  * @brief  High-water mark of a painted stack
+  * @param  stack: lowest word of the stack
+  * @param  words: stack size in 32-bit words
+  * @retval Bytes ever used
+  */
+uint32_t StackWatch_getUsed(const uint32_t *stack, uint32_t words)
+{
+	uint32_t l_free_u32 = 0U;
+
+	while ((l_free_u32 < words) && (STACK_WATCH_PATTERN == stack[l_free_u32]))
+	{
+		l_free_u32++;
+	}
+
+	return (words - l_free_u32) * 4U;
+}
+
+/**
+  * @brief  Paint the free part of the MSP stack below the current frame
+  * @param  None
+  * @retval None
+  */
+void StackWatch_paintMsp(void)
+{
+	uint32_t *l_word_pu32 = (uint32_t *)STACK_WATCH_MSP_BASE;
+	uint32_t *l_end_pu32 = (uint32_t *)__get_MSP() - STACK_WATCH_GUARD_WORDS;
+
+	while (l_word_pu32 < l_end_pu32)
+	{
+		*l_word_pu32 = STACK_WATCH_PATTERN;
+		l_word_pu32++;
+	}
+}
+
+/**
+  * @brief  Size of the MSP stack
+  * @param  None
+  * @retval Bytes
+  */
+uint32_t StackWatch_getMspSize(void)
+{
+	return STACK_WATCH_MSP_TOP - STACK_WATCH_MSP_BASE;
+}
+
+/**
+  * @brief  High-water mark of the MSP stack
+  * @param  None
+  * @retval Bytes ever used
+  */
+uint32_t StackWatch_getMspUsed(void)
+{
+	return StackWatch_getUsed((const uint32_t *)STACK_WATCH_MSP_BASE, StackWatch_getMspSize() / 4U);
+}
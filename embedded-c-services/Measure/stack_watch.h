@@ -0,0 +1,72 @@
+/*****************************************************************************
+ * @file      stack_watch.h
+ * @author    Jet Station
+ * @brief     Stack painting and high-water-mark measurement
+ * @date      [2026-10-17]
+ *
+ * Contact:
+ *   @website   https://jet-station.github.io/
+ *   @github    https://github.com/jet-station
+ *   @linkedin  https://www.linkedin.com/in/thien-ai-ho/
+ *   @email     thienaiho95@gmail.com
+ *
+ * @copyright  Copyright (c) 2026 Jet Station. All rights reserved.
+ *****************************************************************************/
+
+#ifndef __STACK_WATCH_H__
+#define __STACK_WATCH_H__
+
+#include <stdint.h>
+
+/* Fill value of unused stack, the Keil startup files paint the MSP stack
+ * with the same value in Reset_Handler */
+#define STACK_WATCH_PATTERN (0xCDCDCDCDU)
+
+/* Words below the current MSP left alone by StackWatch_paintMsp(), covers
+ * its own frame and an interrupt arriving during the paint */
+#ifndef STACK_WATCH_GUARD_WORDS
+#define STACK_WATCH_GUARD_WORDS (16U)
+#endif
+
+/**
+  * @brief  Fill a task stack with STACK_WATCH_PATTERN
+  * @note   Call before the stack is handed to RtKernel_createThread()
+  * @param  stack: lowest word of the stack
+  * @param  words: stack size in 32-bit words
+  * @retval None
+  */
+void StackWatch_paint(uint32_t *stack, uint32_t words);
+
+/**
+  * @brief  High-water mark of a painted stack
+  * @note   Stacks grow down: counts the untouched words from the low end
+  * @param  stack: lowest word of the stack
+  * @param  words: stack size in 32-bit words
+  * @retval Bytes ever used
+  */
+uint32_t StackWatch_getUsed(const uint32_t *stack, uint32_t words);
+
+/**
+  * @brief  Paint the free part of the MSP stack below the current frame
+  * @note   For startup files that do not paint in Reset_Handler, call it
+  *         first thing in main()
+  * @param  None
+  * @retval None
+  */
+void StackWatch_paintMsp(void);
+
+/**
+  * @brief  Size of the MSP stack reserved by the startup file or linker script
+  * @param  None
+  * @retval Bytes
+  */
+uint32_t StackWatch_getMspSize(void);
+
+/**
+  * @brief  High-water mark of the MSP stack, main() and all handlers
+  * @param  None
+  * @retval Bytes ever used
+  */
+uint32_t StackWatch_getMspUsed(void);
+
+#endif
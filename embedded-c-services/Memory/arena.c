@@ -0,0 +1,199 @@
+/*****************************************************************************
+ * @file      arena.c
+ * @author    Jet Station
+ * @brief     Bump-pointer arena for scratch memory released by mark/reset
+ * @date      [2026-10-17]
+ *
+ * Contact:
+ *   @website   https://jet-station.github.io/
+ *   @github    https://github.com/jet-station
+ *   @linkedin  https://www.linkedin.com/in/thien-ai-ho/
+ *   @email     thienaiho95@gmail.com
+ *
+ * @copyright  Copyright (c) 2026 Jet Station. All rights reserved.
+ *****************************************************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "arena.h"
+
+/* Guard trailer behind a block: the guard word, then the rounded size of
+ * the block. Arena_reset() walks the trailers down from the top */
+#define ARENA_TRAILER (8U)
+
+Arena_st g_arena;
+
+/**
+  * @brief  Round up to ARENA_ALIGN
+  * @param  value: address or size
+  * @retval uintptr_t
+  */
+static inline uintptr_t Arena_alignUp(uintptr_t value)
+{
+	return (value + (ARENA_ALIGN - 1U)) & ~(uintptr_t)(ARENA_ALIGN - 1U);
+}
+
+#if (0U != ARENA_GUARDS)
+/**
+  * @brief  Check the guards of the blocks between a mark and the top
+  * @param  arena: arena object
+  * @param  bottom: address of the mark
+  * @retval false if a guard or a size is broken
+  */
+static bool Arena_checkGuards(const Arena_st *arena, const uint8_t *bottom)
+{
+	const uint8_t *l_end_pu8 = arena->top;
+	const uint32_t *l_trailer_pu32 = NULL;
+
+	while (l_end_pu8 > bottom)
+	{
+		if ((uint32_t)(l_end_pu8 - bottom) < ARENA_TRAILER)
+		{
+			return false;
+		}
+		l_trailer_pu32 = (const uint32_t *)(const void *)(l_end_pu8 - ARENA_TRAILER);
+		if ((ARENA_GUARD_WORD != l_trailer_pu32[0]) ||
+		    (l_trailer_pu32[1] > (uint32_t)((const uint8_t *)l_trailer_pu32 - bottom)))
+		{
+			return false;
+		}
+		l_end_pu8 = (const uint8_t *)l_trailer_pu32 - l_trailer_pu32[1];
+	}
+
+	return true;
+}
+#endif
+
+/**
+  * @brief  Initialize an arena over caller-provided storage
+  * @param  arena: arena object
+  * @param  storage: memory of the arena, trimmed to ARENA_ALIGN
+  * @param  size: bytes of storage
+  * @retval false if less than one aligned allocation fits
+  */
+bool Arena_create(Arena_st *arena, void *storage, uint32_t size)
+{
+	uintptr_t l_base_u = 0U;
+	uintptr_t l_limit_u = 0U;
+
+	if ((NULL == arena) || (NULL == storage))
+	{
+		return false;
+	}
+
+	l_base_u = Arena_alignUp((uintptr_t)storage);
+	l_limit_u = ((uintptr_t)storage + size) & ~(uintptr_t)(ARENA_ALIGN - 1U);
+	if (l_limit_u <= l_base_u)
+	{
+		return false;
+	}
+
+	arena->base = (uint8_t *)l_base_u;
+	arena->limit = (uint8_t *)l_limit_u;
+	arena->top = arena->base;
+	arena->peak = 0U;
+	arena->failures = 0U;
+	arena->corruptions = 0U;
+
+	return true;
+}
+
+#if defined(ARENA_REGION_START)
+/**
+  * @brief  Create g_arena over the region of the linker configuration
+  * @param  None
+  * @retval None
+  */
+void Arena_init(void)
+{
+	(void)Arena_create(&g_arena, ARENA_REGION_START, (uint32_t)(ARENA_REGION_END - ARENA_REGION_START));
+}
+#endif
+
+/**
+  * @brief  Count an allocation that does not fit
+  * @param  arena: arena object
+  * @retval NULL
+  */
+void *Arena_fail(Arena_st *arena)
+{
+	arena->failures++;
+
+	return NULL;
+}
+
+/**
+  * @brief  Allocate with a guard behind the block
+  * @param  arena: arena object
+  * @param  size: requested bytes
+  * @retval Block, NULL if it does not fit
+  */
+void *Arena_allocGuarded(Arena_st *arena, uint32_t size)
+{
+	uint8_t *l_block_pu8 = arena->top;
+	uint32_t *l_trailer_pu32 = NULL;
+	uint32_t l_free_u32 = (uint32_t)(arena->limit - l_block_pu8);
+	uint32_t l_size_u32 = 0U;
+
+	if ((l_free_u32 < ARENA_TRAILER) || (size > (l_free_u32 - ARENA_TRAILER)))
+	{
+		return Arena_fail(arena);
+	}
+
+	l_size_u32 = (uint32_t)Arena_alignUp(size);
+	l_trailer_pu32 = (uint32_t *)(void *)(l_block_pu8 + l_size_u32);
+	l_trailer_pu32[0] = ARENA_GUARD_WORD;
+	l_trailer_pu32[1] = l_size_u32;
+	arena->top = l_block_pu8 + l_size_u32 + ARENA_TRAILER;
+
+	return l_block_pu8;
+}
+
+/**
+  * @brief  Release every allocation made after a mark, check their guards
+  * @param  arena: arena object
+  * @param  mark: value of Arena_mark(), 0 releases everything
+  * @retval false if the mark is above the top or a guard is broken
+  */
+bool Arena_reset(Arena_st *arena, uint32_t mark)
+{
+	uint32_t l_used_u32 = Arena_mark(arena);
+	bool l_ok_b = true;
+
+	if (mark > l_used_u32)
+	{
+		/* Scopes reset out of order, the inner one is already gone */
+		arena->corruptions++;
+		return false;
+	}
+
+	if (l_used_u32 > arena->peak)
+	{
+		arena->peak = l_used_u32;
+	}
+
+#if (0U != ARENA_GUARDS)
+	if (false == Arena_checkGuards(arena, arena->base + mark))
+	{
+		arena->corruptions++;
+		l_ok_b = false;
+	}
+#endif
+
+	arena->top = arena->base + mark;
+
+	return l_ok_b;
+}
+
+/**
+  * @brief  Highest usage so far, including the current one
+  * @param  arena: arena object
+  * @retval Bytes
+  */
+uint32_t Arena_getPeak(const Arena_st *arena)
+{
+	uint32_t l_used_u32 = Arena_mark(arena);
+
+	return (l_used_u32 > arena->peak) ? l_used_u32 : arena->peak;
+}
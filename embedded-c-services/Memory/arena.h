@@ -0,0 +1,157 @@
+/*****************************************************************************
+ * @file      arena.h
+ * @author    Jet Station
+ * @brief     Bump-pointer arena for scratch memory released by mark/reset
+ * @date      [2026-10-17]
+ *
+ * Contact:
+ *   @website   https://jet-station.github.io/
+ *   @github    https://github.com/jet-station
+ *   @linkedin  https://www.linkedin.com/in/thien-ai-ho/
+ *   @email     thienaiho95@gmail.com
+ *
+ * @copyright  Copyright (c) 2026 Jet Station. All rights reserved.
+ *****************************************************************************/
+
+#ifndef __ARENA_H__
+#define __ARENA_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/* Alignment of every allocation, enough for uint64_t and double */
+#define ARENA_ALIGN (8U)
+
+/* 1: every allocation is followed by a guard word and its size, checked by
+ * Arena_reset(). Costs 8 bytes per allocation and a call instead of the
+ * inline bump */
+#ifndef ARENA_GUARDS
+#define ARENA_GUARDS (0U)
+#endif
+
+#define ARENA_GUARD_WORD (0xA5E1A5E1U)
+
+/* Region of the default arena, reserved in the linker configuration: the
+ * ARENA area of the Keil startup file, the .arena section of a GNU linker
+ * script. Hosts without one create their arenas over their own buffers */
+#if defined(__ARMCC_VERSION)
+extern uint8_t Arena_Mem[];
+extern uint8_t Arena_Limit[];
+#define ARENA_REGION_START (Arena_Mem)
+#define ARENA_REGION_END (Arena_Limit)
+#elif defined(__arm__)
+extern uint8_t __arena_start__[];
+extern uint8_t __arena_end__[];
+#define ARENA_REGION_START (__arena_start__)
+#define ARENA_REGION_END (__arena_end__)
+#endif
+
+/* One arena, used from a single context: the main loop or one task */
+typedef struct {
+	uint8_t *base;
+	uint8_t *limit; /* First byte after the arena */
+	uint8_t *top; /* Next allocation */
+	uint32_t peak; /* Highest usage in bytes, updated by Arena_reset() */
+	uint32_t failures; /* Allocations that did not fit */
+	uint32_t corruptions; /* Broken guards found by Arena_reset() */
+} Arena_st;
+
+/* Default arena over the linker region, see Arena_init() */
+extern Arena_st g_arena;
+
+/**
+  * @brief  Initialize an arena over caller-provided storage
+  * @param  arena: arena object
+  * @param  storage: memory of the arena, trimmed to ARENA_ALIGN
+  * @param  size: bytes of storage
+  * @retval false if less than one aligned allocation fits
+  */
+bool Arena_create(Arena_st *arena, void *storage, uint32_t size);
+
+#if defined(ARENA_REGION_START)
+/**
+  * @brief  Create g_arena over the region of the linker configuration
+  * @param  None
+  * @retval None
+  */
+void Arena_init(void);
+#endif
+
+/**
+  * @brief  Count an allocation that does not fit
+  * @param  arena: arena object
+  * @retval NULL
+  */
+void *Arena_fail(Arena_st *arena);
+
+/**
+  * @brief  Allocate with a guard behind the block
+  * @param  arena: arena object
+  * @param  size: requested bytes
+  * @retval Block, NULL if it does not fit
+  */
+void *Arena_allocGuarded(Arena_st *arena, uint32_t size);
+
+/**
+  * @brief  Allocate from the top of the arena
+  * @note   A compare and an add without guards, never blocks or fragments
+  * @param  arena: arena object
+  * @param  size: requested bytes
+  * @retval Block aligned to ARENA_ALIGN, NULL if it does not fit
+  */
+static inline void *Arena_alloc(Arena_st *arena, uint32_t size)
+{
+#if (0U != ARENA_GUARDS)
+	return Arena_allocGuarded(arena, size);
+#else
+	uint8_t *l_block_pu8 = arena->top;
+
+	/* top and limit are aligned, a size that fits still fits rounded up */
+	if (size > (uint32_t)(arena->limit - l_block_pu8))
+	{
+		return Arena_fail(arena);
+	}
+	arena->top = l_block_pu8 + ((size + (ARENA_ALIGN - 1U)) & ~(ARENA_ALIGN - 1U));
+
+	return l_block_pu8;
+#endif
+}
+
+/**
+  * @brief  Current usage, to release everything allocated after it later
+  * @param  arena: arena object
+  * @retval Mark for Arena_reset()
+  */
+static inline uint32_t Arena_mark(const Arena_st *arena)
+{
+	return (uint32_t)(arena->top - arena->base);
+}
+
+/**
+  * @brief  Release every allocation made after a mark, check their guards
+  * @param  arena: arena object
+  * @param  mark: value of Arena_mark(), 0 releases everything
+  * @retval false if the mark is above the top or a guard is broken
+  */
+bool Arena_reset(Arena_st *arena, uint32_t mark);
+
+/**
+  * @brief  Highest usage so far, including the current one
+  * @param  arena: arena object
+  * @retval Bytes
+  */
+uint32_t Arena_getPeak(const Arena_st *arena);
+
+/* Scope that releases its allocations at the closing brace, scopes nest:
+ *   ARENA_SCOPE(&g_arena)
+ *   {
+ *       char *l_line_pc = Arena_alloc(&g_arena, 64U);
+ *   }
+ * Leave it only at the closing brace or with continue, a break or return
+ * skips the reset and the memory stays allocated until an outer reset */
+#define ARENA_SCOPE(arena) \
+	for (uint32_t l_arenaMark_u32 = Arena_mark(arena), l_arenaOnce_u32 = 1U; 0U != l_arenaOnce_u32; \
+	     l_arenaOnce_u32 = 0U, (void)Arena_reset((arena), l_arenaMark_u32))
+
+#endif
@@ -0,0 +1,116 @@
+/*****************************************************************************
+ * @file      bit_band.h
+ * @author    Jet Station
+ * @brief     Single-bit access to SRAM and peripherals through the bit-band alias
+ * @date      [2026-10-17]
+ *
+ * Contact:
+ *   @website   https://jet-station.github.io/
+ *   @github    https://github.com/jet-station
+ *   @linkedin  https://www.linkedin.com/in/thien-ai-ho/
+ *   @email     thienaiho95@gmail.com
+ *
+ * @copyright  Copyright (c) 2026 Jet Station. All rights reserved.
+ *****************************************************************************/
+
+#ifndef __BIT_BAND_H__
+#define __BIT_BAND_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "stm32f1xx.h"
+
+/* The Cortex-M3 maps every bit of the first MB of SRAM and of the
+ * peripherals to one word of an alias region:
+ *   alias = region alias base + (byte offset in the region * 32) + (bit * 4)
+ * A store to the alias word writes that bit only, the bus does the
+ * read-modify-write without the core: an interrupt between the read and
+ * the write cannot happen, so ISR and main loop share flag words without
+ * a critical section. A load returns 0 or 1.
+ * Caution: the bus still writes the whole word back. Registers with bits
+ * cleared by writing 1 (rc_w1) or 0 (rc_w0), e.g. TIMx_SR or USART_SR,
+ * lose the other pending flags, use their plain write instead */
+#define BITBAND_REGION_SIZE (0x00100000U)
+
+#define BITBAND_IS_SRAM(addr) \
+	(((uint32_t)(addr) - SRAM_BASE) < BITBAND_REGION_SIZE)
+#define BITBAND_IS_PERIPH(addr) \
+	(((uint32_t)(addr) - PERIPH_BASE) < BITBAND_REGION_SIZE)
+
+/* Alias address of a bit, for an address in either region: the region
+ * base bits are kept, 0x02000000 selects its alias. A constant address,
+ * e.g. &GPIOC->ODR, gives a constant alias folded by the compiler */
+#define BITBAND_ALIAS(addr, bit) \
+	(((uint32_t)(addr) & 0xF0000000U) + 0x02000000U + \
+	 (((uint32_t)(addr) & (BITBAND_REGION_SIZE - 1U)) << 5) + ((uint32_t)(bit) << 2))
+
+/* Bit of a peripheral register as an lvalue, resolved at compile time:
+ *   BITBAND_PERIPH(RCC->APB2ENR, RCC_APB2ENR_IOPCEN_Pos) = 1U; */
+#define BITBAND_PERIPH(reg, bit) \
+	(*(volatile uint32_t *)(PERIPH_BB_BASE + (((uint32_t)&(reg) - PERIPH_BASE) << 5) + ((uint32_t)(bit) << 2)))
+
+/* Bit of a variable in SRAM as an lvalue. The address of a variable is only
+ * known at link time: the alias costs a shift and an add per access, keep
+ * it in a pointer from BitBand_sram() for loops */
+#define BITBAND_SRAM(var, bit) \
+	(*(volatile uint32_t *)(SRAM_BB_BASE + (((uint32_t)&(var) - SRAM_BASE) << 5) + ((uint32_t)(bit) << 2)))
+
+/**
+  * @brief  Alias word of a bit in SRAM or in a peripheral register
+  * @note   The word must be in the first MB of either region, see
+  *         BITBAND_IS_SRAM() and BITBAND_IS_PERIPH()
+  * @param  addr: address of the word holding the bit
+  * @param  bit: bit number, 0 to 31
+  * @retval Alias word, reads 0 or 1, writes the bit
+  */
+static inline volatile uint32_t *BitBand_alias(volatile const void *addr, uint32_t bit)
+{
+	return (volatile uint32_t *)BITBAND_ALIAS(addr, bit);
+}
+
+/**
+  * @brief  Alias word of a bit of an SRAM word, e.g. a flag word shared
+  *         between an ISR and the main loop
+  * @param  word: flag word
+  * @param  bit: bit number, 0 to 31
+  * @retval Alias word
+  */
+static inline volatile uint32_t *BitBand_sram(volatile uint32_t *word, uint32_t bit)
+{
+	return (volatile uint32_t *)(SRAM_BB_BASE + (((uint32_t)word - SRAM_BASE) << 5) + (bit << 2));
+}
+
+/**
+  * @brief  Set one bit with a single store, atomic against interrupts
+  * @param  addr: address of the word holding the bit
+  * @param  bit: bit number, 0 to 31
+  * @retval None
+  */
+static inline void BitBand_set(volatile const void *addr, uint32_t bit)
+{
+	*BitBand_alias(addr, bit) = 1U;
+}
+
+/**
+  * @brief  Clear one bit with a single store, atomic against interrupts
+  * @param  addr: address of the word holding the bit
+  * @param  bit: bit number, 0 to 31
+  * @retval None
+  */
+static inline void BitBand_clear(volatile const void *addr, uint32_t bit)
+{
+	*BitBand_alias(addr, bit) = 0U;
+}
+
+/**
+  * @brief  Read one bit with a single load
+  * @param  addr: address of the word holding the bit
+  * @param  bit: bit number, 0 to 31
+  * @retval Bit value
+  */
+static inline bool BitBand_read(volatile const void *addr, uint32_t bit)
+{
+	return (0U != *BitBand_alias(addr, bit));
+}
+
+#endif
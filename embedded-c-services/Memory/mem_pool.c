@@ -0,0 +1,268 @@
+/*****************************************************************************
+ * @file      mem_pool.c
+ * @author    Jet Station
+ * @brief     Constant-time fixed-block memory pools, safe from any ISR
+ * @date      [2026-10-17]
+ *
+ * Contact:
+ *   @website   https://jet-station.github.io/
+ *   @github    https://github.com/jet-station
+ *   @linkedin  https://www.linkedin.com/in/thien-ai-ho/
+ *   @email     thienaiho95@gmail.com
+ *
+ * @copyright  Copyright (c) 2026 Jet Station. All rights reserved.
+ *****************************************************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "stm32f1xx.h"
+#include "mem_pool.h"
+
+/* The free list links block indexes instead of addresses, the same code
+ * then runs in the host simulation with 64-bit pointers. Exception entry
+ * and return clear the exclusive monitor, so an ISR that takes and returns
+ * blocks between LDREX and STREX makes the STREX fail: no ABA problem */
+#define MEM_POOL_NONE (0xFFFFFFFFU)
+
+#define MEM_POOL_BYTES(size, count) + ((size) * (count))
+#define MEM_POOL_CLASS(size, count) { (size), (count) },
+
+/* Block size and count of every size class */
+static const uint32_t s_classes_u32[][2] = {
+	MEM_POOL_CLASSES(MEM_POOL_CLASS)
+};
+
+#define MEM_POOL_CLASS_COUNT (sizeof(s_classes_u32) / sizeof(s_classes_u32[0]))
+
+/* Storage of all size classes, one after the other */
+static uint32_t s_storage_u32[(0U MEM_POOL_CLASSES(MEM_POOL_BYTES)) / 4U];
+
+static MemPool_Pool_st s_pools_st[MEM_POOL_CLASS_COUNT];
+
+/**
+  * @brief  Add to a counter that ISRs of any priority update as well
+  * @param  counter: counter
+  * @param  delta: value to add, two's complement to subtract
+  * @retval New value
+  */
+static inline uint32_t MemPool_add(volatile uint32_t *counter, uint32_t delta)
+{
+	uint32_t l_value_u32 = 0U;
+
+	do
+	{
+		l_value_u32 = __LDREXW(counter) + delta;
+	} while (0U != __STREXW(l_value_u32, counter));
+
+	return l_value_u32;
+}
+
+/**
+  * @brief  Raise the peak to a new usage
+  * @param  pool: pool object
+  * @param  used: usage after an allocation
+  * @retval None
+  */
+static inline void MemPool_updatePeak(MemPool_Pool_st *pool, uint32_t used)
+{
+	do
+	{
+		if (__LDREXW(&pool->peakUsed) >= used)
+		{
+			__CLREX();
+			break;
+		}
+	} while (0U != __STREXW(used, &pool->peakUsed));
+}
+
+/**
+  * @brief  Link word of a free block
+  * @param  pool: pool object
+  * @param  index: block index
+  * @retval Pointer to the first word of the block
+  */
+static inline uint32_t *MemPool_getLink(const MemPool_Pool_st *pool, uint32_t index)
+{
+	return (uint32_t *)(void *)(pool->start + (index * pool->blockSize));
+}
+
+/**
+  * @brief  Initialize a pool over caller-provided storage
+  * @param  pool: pool object
+  * @param  storage: blockSize * blockCount bytes, 4-byte aligned
+  * @param  blockSize: bytes per block, multiple of 4
+  * @param  blockCount: number of blocks
+  * @retval false if a parameter is invalid
+  */
+bool MemPool_create(MemPool_Pool_st *pool, void *storage, uint32_t blockSize, uint32_t blockCount)
+{
+	uint32_t l_index_u32 = 0U;
+
+	if ((NULL == pool) || (NULL == storage) || (0U != ((uintptr_t)storage & 3U)) ||
+	    (0U == blockSize) || (0U != (blockSize & 3U)) || (0U == blockCount) ||
+	    (blockCount >= MEM_POOL_NONE))
+	{
+		return false;
+	}
+
+	pool->start = (uint8_t *)storage;
+	pool->end = pool->start + (blockSize * blockCount);
+	pool->blockSize = blockSize;
+	pool->blockCount = blockCount;
+
+	/* Every block links to the next one, the last ends the list */
+	for (l_index_u32 = 0U; l_index_u32 < blockCount; l_index_u32++)
+	{
+		*MemPool_getLink(pool, l_index_u32) = ((l_index_u32 + 1U) < blockCount) ? (l_index_u32 + 1U) : MEM_POOL_NONE;
+	}
+
+	pool->freeList = 0U;
+	pool->used = 0U;
+	pool->peakUsed = 0U;
+	pool->allocs = 0U;
+	pool->empty = 0U;
+
+	return true;
+}
+
+/**
+  * @brief  Take a block, constant time, safe from any ISR
+  * @param  pool: pool object
+  * @retval Block, NULL if the pool is empty
+  */
+void *MemPool_get(MemPool_Pool_st *pool)
+{
+	uint32_t l_index_u32 = 0U;
+	uint32_t l_next_u32 = 0U;
+
+	/* Pop the head, a nested get or put in between makes STREX fail */
+	do
+	{
+		l_index_u32 = __LDREXW(&pool->freeList);
+		if (MEM_POOL_NONE == l_index_u32)
+		{
+			__CLREX();
+			(void)MemPool_add(&pool->empty, 1U);
+			return NULL;
+		}
+		l_next_u32 = *MemPool_getLink(pool, l_index_u32);
+	} while (0U != __STREXW(l_next_u32, &pool->freeList));
+
+	(void)MemPool_add(&pool->allocs, 1U);
+	MemPool_updatePeak(pool, MemPool_add(&pool->used, 1U));
+
+	return MemPool_getLink(pool, l_index_u32);
+}
+
+/**
+  * @brief  Return a block, constant time, safe from any ISR
+  * @param  pool: pool object
+  * @param  block: block taken from this pool
+  * @retval false if block does not belong to the pool
+  */
+bool MemPool_put(MemPool_Pool_st *pool, void *block)
+{
+	uint32_t l_index_u32 = 0U;
+	uint32_t *l_link_pu32 = (uint32_t *)block;
+
+	if (false == MemPool_contains(pool, block))
+	{
+		return false;
+	}
+
+	l_index_u32 = (uint32_t)((uint8_t *)block - pool->start) / pool->blockSize;
+
+	/* Push as the new head, the link is rewritten if STREX fails */
+	do
+	{
+		*l_link_pu32 = __LDREXW(&pool->freeList);
+	} while (0U != __STREXW(l_index_u32, &pool->freeList));
+
+	(void)MemPool_add(&pool->used, 0U - 1U);
+
+	return true;
+}
+
+/**
+  * @brief  Create the pools of MEM_POOL_CLASSES from static storage
+  * @param  None
+  * @retval None
+  */
+void MemPool_init(void)
+{
+	uint8_t *l_storage_pu8 = (uint8_t *)s_storage_u32;
+	uint32_t l_index_u32 = 0U;
+
+	for (l_index_u32 = 0U; l_index_u32 < MEM_POOL_CLASS_COUNT; l_index_u32++)
+	{
+		(void)MemPool_create(&s_pools_st[l_index_u32], l_storage_pu8, s_classes_u32[l_index_u32][0],
+		                     s_classes_u32[l_index_u32][1]);
+		l_storage_pu8 += s_classes_u32[l_index_u32][0] * s_classes_u32[l_index_u32][1];
+	}
+}
+
+/**
+  * @brief  Allocate from the smallest size class that fits, a larger class
+  *         when that one is empty
+  * @note   Bounded by the number of classes, safe from any ISR
+  * @param  size: requested bytes
+  * @retval Block, NULL if no class has a free block of that size
+  */
+void *MemPool_alloc(size_t size)
+{
+	void *l_block_pv = NULL;
+	uint32_t l_index_u32 = 0U;
+
+	for (l_index_u32 = 0U; l_index_u32 < MEM_POOL_CLASS_COUNT; l_index_u32++)
+	{
+		if (size <= s_pools_st[l_index_u32].blockSize)
+		{
+			l_block_pv = MemPool_get(&s_pools_st[l_index_u32]);
+			if (NULL != l_block_pv)
+			{
+				break;
+			}
+		}
+	}
+
+	return l_block_pv;
+}
+
+/**
+  * @brief  Return a block of MemPool_alloc() to its size class
+  * @param  ptr: block, NULL is ignored
+  * @retval None
+  */
+void MemPool_free(void *ptr)
+{
+	uint32_t l_index_u32 = 0U;
+
+	for (l_index_u32 = 0U; l_index_u32 < MEM_POOL_CLASS_COUNT; l_index_u32++)
+	{
+		if (true == MemPool_put(&s_pools_st[l_index_u32], ptr))
+		{
+			break;
+		}
+	}
+}
+
+/**
+  * @brief  Number of size classes
+  * @param  None
+  * @retval uint32_t
+  */
+uint32_t MemPool_getClassCount(void)
+{
+	return MEM_POOL_CLASS_COUNT;
+}
+
+/**
+  * @brief  Pool of a size class, for its statistics
+  * @param  index: class index, ascending block size
+  * @retval Pool, NULL if index is out of range
+  */
+const MemPool_Pool_st *MemPool_getClass(uint32_t index)
+{
+	return (index < MEM_POOL_CLASS_COUNT) ? &s_pools_st[index] : NULL;
+}
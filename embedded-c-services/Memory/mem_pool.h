@@ -0,0 +1,125 @@
+/*****************************************************************************
+ * @file      mem_pool.h
+ * @author    Jet Station
+ * @brief     Constant-time fixed-block memory pools, safe from any ISR
+ * @date      [2026-10-17]
+ *
+ * Contact:
+ *   @website   https://jet-station.github.io/
+ *   @github    https://github.com/jet-station
+ *   @linkedin  https://www.linkedin.com/in/thien-ai-ho/
+ *   @email     thienaiho95@gmail.com
+ *
+ * @copyright  Copyright (c) 2026 Jet Station. All rights reserved.
+ *****************************************************************************/
+
+#ifndef __MEM_POOL_H__
+#define __MEM_POOL_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/* Size classes of MemPool_alloc(), X(blockSize, blockCount) in ascending
+ * block size. Block sizes are multiples of 4 bytes. Override the list in the
+ * project defines to fit the RAM of the application */
+#ifndef MEM_POOL_CLASSES
+#define MEM_POOL_CLASSES(X) \
+	X(16U, 16U) \
+	X(32U, 16U) \
+	X(64U, 8U) \
+	X(128U, 4U)
+#endif
+
+/* One pool of equal blocks. The free blocks are a singly linked list
+ * through their first word, which holds the index of the next free block.
+ * freeList is the index of the first one, 0xFFFFFFFF ends the list */
+typedef struct {
+	uint8_t *start;
+	uint8_t *end; /* First byte after the storage */
+	uint32_t blockSize;
+	uint32_t blockCount;
+	volatile uint32_t freeList; /* Popped and pushed with LDREX/STREX */
+	volatile uint32_t used; /* Blocks handed out */
+	volatile uint32_t peakUsed;
+	volatile uint32_t allocs;
+	volatile uint32_t empty; /* Gets that found no free block */
+} MemPool_Pool_st;
+
+/**
+  * @brief  Initialize a pool over caller-provided storage
+  * @param  pool: pool object
+  * @param  storage: blockSize * blockCount bytes, 4-byte aligned
+  * @param  blockSize: bytes per block, multiple of 4
+  * @param  blockCount: number of blocks
+  * @retval false if a parameter is invalid
+  */
+bool MemPool_create(MemPool_Pool_st *pool, void *storage, uint32_t blockSize, uint32_t blockCount);
+
+/**
+  * @brief  Take a block, constant time, safe from any ISR
+  * @param  pool: pool object
+  * @retval Block, NULL if the pool is empty
+  */
+void *MemPool_get(MemPool_Pool_st *pool);
+
+/**
+  * @brief  Return a block, constant time, safe from any ISR
+  * @param  pool: pool object
+  * @param  block: block taken from this pool
+  * @retval false if block does not belong to the pool
+  */
+bool MemPool_put(MemPool_Pool_st *pool, void *block);
+
+/**
+  * @brief  Check whether a pointer is a block of a pool
+  * @param  pool: pool object
+  * @param  block: pointer to check
+  * @retval bool
+  */
+static inline bool MemPool_contains(const MemPool_Pool_st *pool, const void *block)
+{
+	const uint8_t *l_block_pu8 = (const uint8_t *)block;
+
+	return (l_block_pu8 >= pool->start) && (l_block_pu8 < pool->end) &&
+	       (0U == ((uint32_t)(l_block_pu8 - pool->start) % pool->blockSize));
+}
+
+/**
+  * @brief  Create the pools of MEM_POOL_CLASSES from static storage
+  * @param  None
+  * @retval None
+  */
+void MemPool_init(void);
+
+/**
+  * @brief  Allocate from the smallest size class that fits, a larger class
+  *         when that one is empty
+  * @note   Bounded by the number of classes, safe from any ISR
+  * @param  size: requested bytes
+  * @retval Block, NULL if no class has a free block of that size
+  */
+void *MemPool_alloc(size_t size);
+
+/**
+  * @brief  Return a block of MemPool_alloc() to its size class
+  * @param  ptr: block, NULL is ignored
+  * @retval None
+  */
+void MemPool_free(void *ptr);
+
+/**
+  * @brief  Number of size classes
+  * @param  None
+  * @retval uint32_t
+  */
+uint32_t MemPool_getClassCount(void);
+
+/**
+  * @brief  Pool of a size class, for its statistics
+  * @param  index: class index, ascending block size
+  * @retval Pool, NULL if index is out of range
+  */
+const MemPool_Pool_st *MemPool_getClass(uint32_t index);
+
+#endif
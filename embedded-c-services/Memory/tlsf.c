@@ -0,0 +1,857 @@
+/*****************************************************************************
+ * @file      tlsf.c
+ * @author    Jet Station
+ * @brief     Two-level segregated fit allocator with constant-time malloc/free
+ * @date      [2026-10-17]
+ *
+ * Contact:
+ *   @website   https://jet-station.github.io/
+ *   @github    https://github.com/jet-station
+ *   @linkedin  https://www.linkedin.com/in/thien-ai-ho/
+ *   @email     thienaiho95@gmail.com
+ *
+ * @copyright  Copyright (c) 2026 Jet Station. All rights reserved.
+ *****************************************************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include "stm32f1xx.h"
+#include "tlsf.h"
+
+#if (0U != TLSF_MALLOC) && defined(__NEWLIB__)
+#include <reent.h>
+#endif
+
+/* Flags in the low bits of the size, sizes are multiples of TLSF_ALIGN */
+#define TLSF_FREE (1U)
+#define TLSF_PREV_FREE (2U)
+#define TLSF_FLAGS (TLSF_FREE | TLSF_PREV_FREE)
+
+/* Bytes in front of the payload, 8 on the target */
+#define TLSF_HEADER ((uint32_t)offsetof(Tlsf_Block_st, nextFree))
+
+/* A free block must hold its list links */
+#define TLSF_MIN_PAYLOAD \
+	((uint32_t)((sizeof(Tlsf_Block_st) - offsetof(Tlsf_Block_st, nextFree) + TLSF_ALIGN - 1U) & ~(TLSF_ALIGN - 1U)))
+
+/**
+  * @brief  Payload bytes of a block
+  * @param  block: block
+  * @retval uint32_t
+  */
+static inline uint32_t Tlsf_getSize(const Tlsf_Block_st *block)
+{
+	return block->size & ~TLSF_FLAGS;
+}
+
+/**
+  * @brief  Check the free flag
+  * @param  block: block
+  * @retval bool
+  */
+static inline bool Tlsf_isFree(const Tlsf_Block_st *block)
+{
+	return (0U != (block->size & TLSF_FREE));
+}
+
+/**
+  * @brief  Neighbour above, the sentinel for the topmost block
+  * @param  block: block
+  * @retval Tlsf_Block_st
+  */
+static inline Tlsf_Block_st *Tlsf_getNext(const Tlsf_Block_st *block)
+{
+	return (Tlsf_Block_st *)(void *)((uint8_t *)block + TLSF_HEADER + Tlsf_getSize(block));
+}
+
+/**
+  * @brief  Block of a payload pointer
+  * @param  ptr: payload
+  * @retval Tlsf_Block_st
+  */
+static inline Tlsf_Block_st *Tlsf_fromPtr(void *ptr)
+{
+	return (Tlsf_Block_st *)(void *)((uint8_t *)ptr - TLSF_HEADER);
+}
+
+/**
+  * @brief  Payload pointer of a block
+  * @param  block: block
+  * @retval void
+  */
+static inline void *Tlsf_toPtr(Tlsf_Block_st *block)
+{
+	return (uint8_t *)block + TLSF_HEADER;
+}
+
+/**
+  * @brief  Lowest set bit
+  * @param  value: non-zero bitmap
+  * @retval Bit index
+  */
+static inline uint32_t Tlsf_ffs(uint32_t value)
+{
+	return __CLZ(__RBIT(value));
+}
+
+/**
+  * @brief  Highest set bit
+  * @param  value: non-zero value
+  * @retval Bit index
+  */
+static inline uint32_t Tlsf_fls(uint32_t value)
+{
+	return 31U - __CLZ(value);
+}
+
+/**
+  * @brief  Lists of a block size: small sizes in steps of TLSF_ALIGN, larger
+  *         ones by their highest bit and the TLSF_SL_LOG2 bits below it
+  * @param  size: payload bytes
+  * @param  fl: first level index
+  * @param  sl: second level index
+  * @retval None
+  */
+static inline void Tlsf_mapInsert(uint32_t size, uint32_t *fl, uint32_t *sl)
+{
+	uint32_t l_bit_u32 = 0U;
+
+	if (size < TLSF_SMALL_BLOCK)
+	{
+		*fl = 0U;
+		*sl = size >> TLSF_ALIGN_LOG2;
+	}
+	else
+	{
+		l_bit_u32 = Tlsf_fls(size);
+		*sl = (size >> (l_bit_u32 - TLSF_SL_LOG2)) ^ TLSF_SL_COUNT;
+		*fl = l_bit_u32 - (TLSF_FL_SHIFT - 1U);
+	}
+}
+
+/**
+  * @brief  Lists to search for a request: the size is rounded up to the next
+  *         list, so every block found there is large enough
+  * @param  size: payload bytes
+  * @param  fl: first level index
+  * @param  sl: second level index
+  * @retval None
+  */
+static inline void Tlsf_mapSearch(uint32_t size, uint32_t *fl, uint32_t *sl)
+{
+	if (size >= TLSF_SMALL_BLOCK)
+	{
+		size += (1U << (Tlsf_fls(size) - TLSF_SL_LOG2)) - 1U;
+	}
+	Tlsf_mapInsert(size, fl, sl);
+}
+
+/**
+  * @brief  Unlink a free block from its list
+  * @param  tlsf: heap object
+  * @param  block: free block
+  * @param  fl: first level index of the block
+  * @param  sl: second level index of the block
+  * @retval None
+  */
+static void Tlsf_removeFree(Tlsf_st *tlsf, Tlsf_Block_st *block, uint32_t fl, uint32_t sl)
+{
+	if (NULL != block->nextFree)
+	{
+		block->nextFree->prevFree = block->prevFree;
+	}
+
+	if (NULL != block->prevFree)
+	{
+		block->prevFree->nextFree = block->nextFree;
+	}
+	else
+	{
+		tlsf->lists[fl][sl] = block->nextFree;
+		if (NULL == block->nextFree)
+		{
+			/* List empty, clear its bits */
+			tlsf->slBitmap[fl] &= ~(1U << sl);
+			if (0U == tlsf->slBitmap[fl])
+			{
+				tlsf->flBitmap &= ~(1U << fl);
+			}
+		}
+	}
+}
+
+/**
+  * @brief  Put a free block at the head of the list of its size
+  * @param  tlsf: heap object
+  * @param  block: free block
+  * @retval None
+  */
+static void Tlsf_insertBlock(Tlsf_st *tlsf, Tlsf_Block_st *block)
+{
+	uint32_t l_fl_u32 = 0U;
+	uint32_t l_sl_u32 = 0U;
+
+	Tlsf_mapInsert(Tlsf_getSize(block), &l_fl_u32, &l_sl_u32);
+
+	block->prevFree = NULL;
+	block->nextFree = tlsf->lists[l_fl_u32][l_sl_u32];
+	if (NULL != block->nextFree)
+	{
+		block->nextFree->prevFree = block;
+	}
+	tlsf->lists[l_fl_u32][l_sl_u32] = block;
+	tlsf->flBitmap |= (1U << l_fl_u32);
+	tlsf->slBitmap[l_fl_u32] |= (1U << l_sl_u32);
+}
+
+/**
+  * @brief  Unlink a free block, its lists come from its size
+  * @param  tlsf: heap object
+  * @param  block: free block
+  * @retval None
+  */
+static void Tlsf_removeBlock(Tlsf_st *tlsf, Tlsf_Block_st *block)
+{
+	uint32_t l_fl_u32 = 0U;
+	uint32_t l_sl_u32 = 0U;
+
+	Tlsf_mapInsert(Tlsf_getSize(block), &l_fl_u32, &l_sl_u32);
+	Tlsf_removeFree(tlsf, block, l_fl_u32, l_sl_u32);
+}
+
+/**
+  * @brief  Turn the tail of a used block beyond size into a free block,
+  *         merged with the neighbour above if that one is free
+  * @param  tlsf: heap object
+  * @param  block: used block
+  * @param  size: payload to keep, multiple of TLSF_ALIGN
+  * @retval None
+  */
+static void Tlsf_trimUsed(Tlsf_st *tlsf, Tlsf_Block_st *block, uint32_t size)
+{
+	Tlsf_Block_st *l_rest_pst = NULL;
+	Tlsf_Block_st *l_next_pst = NULL;
+	uint32_t l_size_u32 = Tlsf_getSize(block);
+
+	if (l_size_u32 < (size + TLSF_HEADER + TLSF_MIN_PAYLOAD))
+	{
+		/* The tail is too small to be a block, it stays in the used one */
+		return;
+	}
+
+	l_rest_pst = (Tlsf_Block_st *)(void *)((uint8_t *)Tlsf_toPtr(block) + size);
+	l_rest_pst->prevPhys = block;
+	l_rest_pst->size = (l_size_u32 - size - TLSF_HEADER) | TLSF_FREE;
+	block->size = size | (block->size & TLSF_FLAGS);
+
+	l_next_pst = Tlsf_getNext(l_rest_pst);
+	if (true == Tlsf_isFree(l_next_pst))
+	{
+		Tlsf_removeBlock(tlsf, l_next_pst);
+		l_rest_pst->size += TLSF_HEADER + Tlsf_getSize(l_next_pst);
+		l_next_pst = Tlsf_getNext(l_rest_pst);
+	}
+	l_next_pst->prevPhys = l_rest_pst;
+	l_next_pst->size |= TLSF_PREV_FREE;
+
+	Tlsf_insertBlock(tlsf, l_rest_pst);
+}
+
+/**
+  * @brief  Request size as a payload size
+  * @param  size: requested bytes
+  * @retval Payload bytes, 0 if the request can never fit
+  */
+static inline uint32_t Tlsf_adjustSize(uint32_t size)
+{
+	if ((0U == size) || (size >= (1U << TLSF_FL_MAX)))
+	{
+		return 0U;
+	}
+	size = (size + (TLSF_ALIGN - 1U)) & ~(TLSF_ALIGN - 1U);
+
+	return (size < TLSF_MIN_PAYLOAD) ? TLSF_MIN_PAYLOAD : size;
+}
+
+/**
+  * @brief  Add to the used bytes and the peak
+  * @param  tlsf: heap object
+  * @param  bytes: payload that became used
+  * @retval None
+  */
+static inline void Tlsf_addUsed(Tlsf_st *tlsf, uint32_t bytes)
+{
+	tlsf->usedBytes += bytes;
+	if (tlsf->usedBytes > tlsf->peakUsedBytes)
+	{
+		tlsf->peakUsedBytes = tlsf->usedBytes;
+	}
+}
+
+/**
+  * @brief  Create a heap over caller-provided memory
+  * @param  tlsf: heap object
+  * @param  memory: pool, trimmed to TLSF_ALIGN
+  * @param  bytes: size of the pool
+  * @retval false if the pool is too small or too large for TLSF_FL_MAX
+  */
+bool Tlsf_create(Tlsf_st *tlsf, void *memory, uint32_t bytes)
+{
+	uint8_t *l_byte_pu8 = (uint8_t *)tlsf;
+	uintptr_t l_start_u = 0U;
+	uintptr_t l_end_u = 0U;
+	uint32_t l_payload_u32 = 0U;
+	Tlsf_Block_st *l_sentinel_pst = NULL;
+	uint32_t l_index_u32 = 0U;
+
+	if ((NULL == tlsf) || (NULL == memory))
+	{
+		return false;
+	}
+
+	l_start_u = ((uintptr_t)memory + (TLSF_ALIGN - 1U)) & ~(uintptr_t)(TLSF_ALIGN - 1U);
+	l_end_u = ((uintptr_t)memory + bytes) & ~(uintptr_t)(TLSF_ALIGN - 1U);
+	if ((l_end_u <= l_start_u) || ((l_end_u - l_start_u) < ((2U * TLSF_HEADER) + TLSF_MIN_PAYLOAD)))
+	{
+		return false;
+	}
+
+	/* One free block over the pool, a used sentinel of size 0 on top so that
+	 * merging never runs past the end */
+	l_payload_u32 = (uint32_t)(l_end_u - l_start_u) - (2U * TLSF_HEADER);
+	if (l_payload_u32 >= (1U << TLSF_FL_MAX))
+	{
+		return false;
+	}
+
+	for (l_index_u32 = 0U; l_index_u32 < sizeof(Tlsf_st); l_index_u32++)
+	{
+		l_byte_pu8[l_index_u32] = 0U;
+	}
+
+	tlsf->first = (Tlsf_Block_st *)l_start_u;
+	tlsf->first->prevPhys = NULL;
+	tlsf->first->size = l_payload_u32 | TLSF_FREE;
+
+	l_sentinel_pst = Tlsf_getNext(tlsf->first);
+	l_sentinel_pst->prevPhys = tlsf->first;
+	l_sentinel_pst->size = TLSF_PREV_FREE;
+	tlsf->end = (uint8_t *)l_sentinel_pst;
+
+	Tlsf_insertBlock(tlsf, tlsf->first);
+
+	return true;
+}
+
+/**
+  * @brief  Allocate a block, constant time
+  * @note   Not reentrant, callers from several contexts lock around it
+  * @param  tlsf: heap object
+  * @param  size: requested bytes
+  * @retval Block aligned to TLSF_ALIGN, NULL if no free block fits
+  */
+void *Tlsf_malloc(Tlsf_st *tlsf, uint32_t size)
+{
+	Tlsf_Block_st *l_block_pst = NULL;
+	uint32_t l_size_u32 = Tlsf_adjustSize(size);
+	uint32_t l_fl_u32 = 0U;
+	uint32_t l_sl_u32 = 0U;
+	uint32_t l_map_u32 = 0U;
+
+	if (0U == l_size_u32)
+	{
+		if (0U != size)
+		{
+			tlsf->failures++;
+		}
+		return NULL;
+	}
+
+	Tlsf_mapSearch(l_size_u32, &l_fl_u32, &l_sl_u32);
+
+	/* A list of the same first level at or above sl, else the smallest
+	 * non-empty first level above */
+	l_map_u32 = (l_fl_u32 < TLSF_FL_COUNT) ? (tlsf->slBitmap[l_fl_u32] & (~0U << l_sl_u32)) : 0U;
+	if (0U == l_map_u32)
+	{
+		l_map_u32 = (l_fl_u32 < (TLSF_FL_COUNT - 1U)) ? (tlsf->flBitmap & (~0U << (l_fl_u32 + 1U))) : 0U;
+		if (0U == l_map_u32)
+		{
+			tlsf->failures++;
+			return NULL;
+		}
+		l_fl_u32 = Tlsf_ffs(l_map_u32);
+		l_map_u32 = tlsf->slBitmap[l_fl_u32];
+	}
+	l_sl_u32 = Tlsf_ffs(l_map_u32);
+
+	l_block_pst = tlsf->lists[l_fl_u32][l_sl_u32];
+	Tlsf_removeFree(tlsf, l_block_pst, l_fl_u32, l_sl_u32);
+
+	/* Used from now on, the remainder goes back as a free block */
+	l_block_pst->size &= ~TLSF_FREE;
+	Tlsf_getNext(l_block_pst)->size &= ~TLSF_PREV_FREE;
+	Tlsf_trimUsed(tlsf, l_block_pst, l_size_u32);
+
+	tlsf->allocs++;
+	Tlsf_addUsed(tlsf, Tlsf_getSize(l_block_pst));
+
+	return Tlsf_toPtr(l_block_pst);
+}
+
+/**
+  * @brief  Return a block and merge it with free neighbours, constant time
+  * @param  tlsf: heap object
+  * @param  ptr: block, NULL is ignored
+  * @retval None
+  */
+void Tlsf_free(Tlsf_st *tlsf, void *ptr)
+{
+	Tlsf_Block_st *l_block_pst = NULL;
+	Tlsf_Block_st *l_next_pst = NULL;
+
+	if (NULL == ptr)
+	{
+		return;
+	}
+
+	l_block_pst = Tlsf_fromPtr(ptr);
+	tlsf->frees++;
+	tlsf->usedBytes -= Tlsf_getSize(l_block_pst);
+	l_block_pst->size |= TLSF_FREE;
+
+	/* Merge with the free neighbour below, it keeps its header */
+	if (0U != (l_block_pst->size & TLSF_PREV_FREE))
+	{
+		Tlsf_Block_st *l_prev_pst = l_block_pst->prevPhys;
+
+		Tlsf_removeBlock(tlsf, l_prev_pst);
+		l_prev_pst->size += TLSF_HEADER + Tlsf_getSize(l_block_pst);
+		l_block_pst = l_prev_pst;
+	}
+
+	/* Merge with the free neighbour above */
+	l_next_pst = Tlsf_getNext(l_block_pst);
+	if (true == Tlsf_isFree(l_next_pst))
+	{
+		Tlsf_removeBlock(tlsf, l_next_pst);
+		l_block_pst->size += TLSF_HEADER + Tlsf_getSize(l_next_pst);
+		l_next_pst = Tlsf_getNext(l_block_pst);
+	}
+
+	l_next_pst->prevPhys = l_block_pst;
+	l_next_pst->size |= TLSF_PREV_FREE;
+	Tlsf_insertBlock(tlsf, l_block_pst);
+}
+
+/**
+  * @brief  Resize a block in place, when it shrinks or the neighbour above
+  *         is free and large enough, constant time
+  * @param  tlsf: heap object
+  * @param  ptr: block, not NULL
+  * @param  size: new size, not 0
+  * @retval false if the block has to move, it is left unchanged then
+  */
+bool Tlsf_resize(Tlsf_st *tlsf, void *ptr, uint32_t size)
+{
+	Tlsf_Block_st *l_block_pst = Tlsf_fromPtr(ptr);
+	Tlsf_Block_st *l_next_pst = Tlsf_getNext(l_block_pst);
+	uint32_t l_size_u32 = Tlsf_adjustSize(size);
+	uint32_t l_current_u32 = Tlsf_getSize(l_block_pst);
+
+	if (0U == l_size_u32)
+	{
+		return false;
+	}
+
+	if (l_size_u32 > l_current_u32)
+	{
+		if ((false == Tlsf_isFree(l_next_pst)) ||
+		    ((l_current_u32 + TLSF_HEADER + Tlsf_getSize(l_next_pst)) < l_size_u32))
+		{
+			return false;
+		}
+
+		/* Grow into the free neighbour above */
+		Tlsf_removeBlock(tlsf, l_next_pst);
+		l_block_pst->size += TLSF_HEADER + Tlsf_getSize(l_next_pst);
+		l_next_pst = Tlsf_getNext(l_block_pst);
+		l_next_pst->prevPhys = l_block_pst;
+		l_next_pst->size &= ~TLSF_PREV_FREE;
+	}
+
+	Tlsf_trimUsed(tlsf, l_block_pst, l_size_u32);
+	if (Tlsf_getSize(l_block_pst) >= l_current_u32)
+	{
+		Tlsf_addUsed(tlsf, Tlsf_getSize(l_block_pst) - l_current_u32);
+	}
+	else
+	{
+		tlsf->usedBytes -= l_current_u32 - Tlsf_getSize(l_block_pst);
+	}
+
+	return true;
+}
+
+/**
+  * @brief  Payload bytes of a block, at least the requested size
+  * @param  ptr: block, not NULL
+  * @retval Usable bytes
+  */
+uint32_t Tlsf_getUsableSize(const void *ptr)
+{
+	return Tlsf_getSize(Tlsf_fromPtr((void *)ptr));
+}
+
+/**
+  * @brief  Resize a block, in place with Tlsf_resize() if possible, else by
+  *         allocate, copy and free
+  * @param  tlsf: heap object
+  * @param  ptr: block, NULL allocates
+  * @param  size: new size, 0 frees
+  * @retval Block, NULL if no free block fits (ptr stays valid)
+  */
+void *Tlsf_realloc(Tlsf_st *tlsf, void *ptr, uint32_t size)
+{
+	void *l_new_pv = NULL;
+
+	if (NULL == ptr)
+	{
+		return Tlsf_malloc(tlsf, size);
+	}
+	if (0U == size)
+	{
+		Tlsf_free(tlsf, ptr);
+		return NULL;
+	}
+	if (true == Tlsf_resize(tlsf, ptr, size))
+	{
+		return ptr;
+	}
+
+	/* Only moves to a larger block, the whole old payload fits */
+	l_new_pv = Tlsf_malloc(tlsf, size);
+	if (NULL != l_new_pv)
+	{
+		(void)memcpy(l_new_pv, ptr, Tlsf_getUsableSize(ptr));
+		Tlsf_free(tlsf, ptr);
+	}
+
+	return l_new_pv;
+}
+
+/**
+  * @brief  Check one free list: links, flags, sizes and its bitmap bits
+  * @param  tlsf: heap object
+  * @param  fl: first level index
+  * @param  sl: second level index
+  * @param  count: incremented per block in the list
+  * @retval Number of inconsistencies
+  */
+static uint32_t Tlsf_checkList(const Tlsf_st *tlsf, uint32_t fl, uint32_t sl, uint32_t *count)
+{
+	const Tlsf_Block_st *l_block_pst = tlsf->lists[fl][sl];
+	const Tlsf_Block_st *l_prev_pst = NULL;
+	uint32_t l_fl_u32 = 0U;
+	uint32_t l_sl_u32 = 0U;
+	uint32_t l_errors_u32 = 0U;
+	bool l_bit_b = (0U != (tlsf->slBitmap[fl] & (1U << sl)));
+
+	if (l_bit_b != (NULL != l_block_pst))
+	{
+		l_errors_u32++;
+	}
+
+	while ((NULL != l_block_pst) && (0U == l_errors_u32))
+	{
+		if (((const uint8_t *)l_block_pst < (const uint8_t *)tlsf->first) ||
+		    ((const uint8_t *)l_block_pst >= tlsf->end) || (0U != ((uintptr_t)l_block_pst & (TLSF_ALIGN - 1U))))
+		{
+			/* Overwritten link, the list cannot be followed */
+			return 1U;
+		}
+		Tlsf_mapInsert(Tlsf_getSize(l_block_pst), &l_fl_u32, &l_sl_u32);
+		if ((false == Tlsf_isFree(l_block_pst)) || (l_fl_u32 != fl) || (l_sl_u32 != sl) ||
+		    (l_block_pst->prevFree != l_prev_pst))
+		{
+			l_errors_u32++;
+		}
+		(*count)++;
+		l_prev_pst = l_block_pst;
+		l_block_pst = l_block_pst->nextFree;
+	}
+
+	return l_errors_u32;
+}
+
+/**
+  * @brief  Check the heap: block chain, flags, free lists and bitmaps
+  * @note   Walks all blocks, for tests and debug builds
+  * @param  tlsf: heap object
+  * @retval Number of inconsistencies, 0 for a sound heap
+  */
+uint32_t Tlsf_check(const Tlsf_st *tlsf)
+{
+	const Tlsf_Block_st *l_block_pst = tlsf->first;
+	const Tlsf_Block_st *l_prev_pst = NULL;
+	const Tlsf_Block_st *l_next_pst = NULL;
+	uint32_t l_walkFree_u32 = 0U;
+	uint32_t l_listFree_u32 = 0U;
+	uint32_t l_errors_u32 = 0U;
+	uint32_t l_fl_u32 = 0U;
+	uint32_t l_sl_u32 = 0U;
+	bool l_prevFree_b = false;
+
+	/* Physical chain from the first block up to the sentinel */
+	while ((uint8_t *)l_block_pst < tlsf->end)
+	{
+		l_prevFree_b = (NULL != l_prev_pst) && Tlsf_isFree(l_prev_pst);
+		if ((0U != (Tlsf_getSize(l_block_pst) & (TLSF_ALIGN - 1U))) ||
+		    (Tlsf_getSize(l_block_pst) < TLSF_MIN_PAYLOAD) ||
+		    (l_prevFree_b != (0U != (l_block_pst->size & TLSF_PREV_FREE))) ||
+		    ((true == l_prevFree_b) && (l_block_pst->prevPhys != l_prev_pst)) ||
+		    ((true == l_prevFree_b) && (true == Tlsf_isFree(l_block_pst))))
+		{
+			/* Bad size, stale flag, bad back link or two free neighbours */
+			l_errors_u32++;
+		}
+		if (true == Tlsf_isFree(l_block_pst))
+		{
+			l_walkFree_u32++;
+		}
+
+		l_next_pst = Tlsf_getNext(l_block_pst);
+		if (((uint8_t *)l_next_pst <= (const uint8_t *)l_block_pst) || ((uint8_t *)l_next_pst > tlsf->end))
+		{
+			/* Overwritten size, the walk cannot go on */
+			return l_errors_u32 + 1U;
+		}
+		l_prev_pst = l_block_pst;
+		l_block_pst = l_next_pst;
+	}
+
+	/* The sentinel is used and knows whether the topmost block is free */
+	if ((0U != (l_block_pst->size & ~TLSF_PREV_FREE)) ||
+	    ((NULL != l_prev_pst) && (Tlsf_isFree(l_prev_pst) != (0U != (l_block_pst->size & TLSF_PREV_FREE)))))
+	{
+		l_errors_u32++;
+	}
+
+	/* Every free block is in exactly the list of its size */
+	for (l_fl_u32 = 0U; l_fl_u32 < TLSF_FL_COUNT; l_fl_u32++)
+	{
+		if ((0U != (tlsf->flBitmap & (1U << l_fl_u32))) != (0U != tlsf->slBitmap[l_fl_u32]))
+		{
+			l_errors_u32++;
+		}
+		for (l_sl_u32 = 0U; l_sl_u32 < TLSF_SL_COUNT; l_sl_u32++)
+		{
+			l_errors_u32 += Tlsf_checkList(tlsf, l_fl_u32, l_sl_u32, &l_listFree_u32);
+		}
+	}
+	if (l_walkFree_u32 != l_listFree_u32)
+	{
+		l_errors_u32++;
+	}
+
+	return l_errors_u32;
+}
+
+/**
+  * @brief  Used and free bytes, block counts and fragmentation
+  * @note   Walks all blocks
+  * @param  tlsf: heap object
+  * @param  stats: result
+  * @retval None
+  */
+void Tlsf_getStats(const Tlsf_st *tlsf, Tlsf_Stats_st *stats)
+{
+	const Tlsf_Block_st *l_block_pst = tlsf->first;
+	uint32_t l_size_u32 = 0U;
+
+	stats->usedBytes = 0U;
+	stats->freeBytes = 0U;
+	stats->usedBlocks = 0U;
+	stats->freeBlocks = 0U;
+	stats->largestFree = 0U;
+	stats->fragmentation = 0U;
+
+	while ((uint8_t *)l_block_pst < tlsf->end)
+	{
+		l_size_u32 = Tlsf_getSize(l_block_pst);
+		if (true == Tlsf_isFree(l_block_pst))
+		{
+			stats->freeBytes += l_size_u32;
+			stats->freeBlocks++;
+			if (l_size_u32 > stats->largestFree)
+			{
+				stats->largestFree = l_size_u32;
+			}
+		}
+		else
+		{
+			stats->usedBytes += l_size_u32;
+			stats->usedBlocks++;
+		}
+		l_block_pst = Tlsf_getNext(l_block_pst);
+	}
+
+	if (0U != stats->freeBytes)
+	{
+		stats->fragmentation = 100U - (uint32_t)(((uint64_t)stats->largestFree * 100U) / stats->freeBytes);
+	}
+}
+
+#if (0U != TLSF_MALLOC)
+/* The C library allocator resolves to the functions below: armlink and
+ * GNU ld take malloc from the application before the library. With the
+ * heap monitor, its $Sub$$/__wrap_ functions wrap these in turn */
+Tlsf_st g_tlsfHeap;
+
+static uint64_t s_heap_u64[TLSF_HEAP_SIZE / 8U];
+static bool s_heapReady_b = false;
+
+/**
+  * @brief  Mask interrupts, create the heap on the first call
+  * @param  None
+  * @retval PRIMASK to restore
+  */
+static inline uint32_t Tlsf_lock(void)
+{
+	uint32_t l_primask_u32 = __get_PRIMASK();
+
+	__disable_irq();
+	if (false == s_heapReady_b)
+	{
+		s_heapReady_b = Tlsf_create(&g_tlsfHeap, s_heap_u64, sizeof(s_heap_u64));
+	}
+
+	return l_primask_u32;
+}
+
+/**
+  * @brief  C library malloc from g_tlsfHeap, constant time with interrupts masked
+  * @param  size: requested bytes
+  * @retval Block, NULL if no free block fits
+  */
+void *malloc(size_t size)
+{
+	uint32_t l_primask_u32 = Tlsf_lock();
+	void *l_ptr_pv = Tlsf_malloc(&g_tlsfHeap, (uint32_t)size);
+
+	__set_PRIMASK(l_primask_u32);
+
+	return l_ptr_pv;
+}
+
+/**
+  * @brief  C library calloc, the clearing runs with interrupts enabled
+  * @param  count: number of elements
+  * @param  size: bytes per element
+  * @retval Zeroed block, NULL if no free block fits
+  */
+void *calloc(size_t count, size_t size)
+{
+	void *l_ptr_pv = NULL;
+
+	if ((0U != count) && (size > (0xFFFFFFFFU / count)))
+	{
+		return NULL;
+	}
+
+	l_ptr_pv = malloc(count * size);
+	if (NULL != l_ptr_pv)
+	{
+		(void)memset(l_ptr_pv, 0, count * size);
+	}
+
+	return l_ptr_pv;
+}
+
+/**
+  * @brief  C library realloc, a move copies the block with interrupts enabled
+  * @param  ptr: block, NULL allocates
+  * @param  size: new size, 0 frees
+  * @retval Block, NULL if no free block fits
+  */
+void *realloc(void *ptr, size_t size)
+{
+	uint32_t l_primask_u32 = 0U;
+	void *l_new_pv = NULL;
+
+	if ((NULL == ptr) || (0U == size))
+	{
+		/* Plain allocation or free, constant time */
+		l_primask_u32 = Tlsf_lock();
+		l_new_pv = Tlsf_realloc(&g_tlsfHeap, ptr, (uint32_t)size);
+		__set_PRIMASK(l_primask_u32);
+		return l_new_pv;
+	}
+
+	l_primask_u32 = Tlsf_lock();
+	if (true == Tlsf_resize(&g_tlsfHeap, ptr, (uint32_t)size))
+	{
+		__set_PRIMASK(l_primask_u32);
+		return ptr;
+	}
+
+	/* Allocate, copy, free: the copy runs with interrupts enabled, both
+	 * blocks belong to the caller in between. The heap calls are made here
+	 * and not through malloc and free, the heap monitor counts one realloc */
+	l_new_pv = Tlsf_malloc(&g_tlsfHeap, (uint32_t)size);
+	__set_PRIMASK(l_primask_u32);
+	if (NULL != l_new_pv)
+	{
+		(void)memcpy(l_new_pv, ptr, Tlsf_getUsableSize(ptr));
+		l_primask_u32 = Tlsf_lock();
+		Tlsf_free(&g_tlsfHeap, ptr);
+		__set_PRIMASK(l_primask_u32);
+	}
+
+	return l_new_pv;
+}
+
+/**
+  * @brief  C library free, constant time with interrupts masked
+  * @param  ptr: block, NULL is ignored
+  * @retval None
+  */
+void free(void *ptr)
+{
+	uint32_t l_primask_u32 = Tlsf_lock();
+
+	Tlsf_free(&g_tlsfHeap, ptr);
+	__set_PRIMASK(l_primask_u32);
+}
+
+#if defined(__NEWLIB__)
+/* Reentrant entry points: newlib internals (stdio buffers, strdup) call the reentrant variants,
+ * they would otherwise pull in its own malloc on top of _sbrk() */
+void *_malloc_r(struct _reent *reent, size_t size)
+{
+	(void)reent;
+	return malloc(size);
+}
+
+void *_calloc_r(struct _reent *reent, size_t count, size_t size)
+{
+	(void)reent;
+	return calloc(count, size);
+}
+
+void *_realloc_r(struct _reent *reent, void *ptr, size_t size)
+{
+	(void)reent;
+	return realloc(ptr, size);
+}
+
+void _free_r(struct _reent *reent, void *ptr)
+{
+	(void)reent;
+	free(ptr);
+}
+#endif
+#endif
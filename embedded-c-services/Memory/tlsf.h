@@ -0,0 +1,166 @@
+/*****************************************************************************
+ * @file      tlsf.h
+ * @author    Jet Station
+ * @brief     Two-level segregated fit allocator with constant-time malloc/free
+ * @date      [2026-10-17]
+ *
+ * Contact:
+ *   @website   https://jet-station.github.io/
+ *   @github    https://github.com/jet-station
+ *   @linkedin  https://www.linkedin.com/in/thien-ai-ho/
+ *   @email     thienaiho95@gmail.com
+ *
+ * @copyright  Copyright (c) 2026 Jet Station. All rights reserved.
+ *****************************************************************************/
+
+#ifndef __TLSF_H__
+#define __TLSF_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/* Alignment of every block and granularity of the sizes */
+#define TLSF_ALIGN_LOG2 (3U)
+#define TLSF_ALIGN (1U << TLSF_ALIGN_LOG2)
+
+/* Second level: every power-of-two range is split into 16 lists, a block
+ * found for a request wastes at most 1/16 of it */
+#define TLSF_SL_LOG2 (4U)
+#define TLSF_SL_COUNT (1U << TLSF_SL_LOG2)
+
+/* First level: sizes below 128 bytes share first level 0 with lists 8
+ * bytes apart, above that one first level per power of two */
+#define TLSF_FL_SHIFT (TLSF_SL_LOG2 + TLSF_ALIGN_LOG2)
+#define TLSF_SMALL_BLOCK (1U << TLSF_FL_SHIFT)
+
+/* Largest block is below 2^TLSF_FL_MAX bytes, 64 KB covers the RAM of
+ * the STM32F1 parts */
+#ifndef TLSF_FL_MAX
+#define TLSF_FL_MAX (16U)
+#endif
+#define TLSF_FL_COUNT (TLSF_FL_MAX - TLSF_FL_SHIFT + 1U)
+
+/* 1: malloc/calloc/realloc/free of the C library come from a TLSF heap of
+ * TLSF_HEAP_SIZE bytes, see g_tlsfHeap */
+#ifndef TLSF_MALLOC
+#define TLSF_MALLOC (0U)
+#endif
+
+#ifndef TLSF_HEAP_SIZE
+#define TLSF_HEAP_SIZE (2048U)
+#endif
+
+/* Block header. prevPhys and size are always valid, the list links only
+ * while the block is free: they are the first bytes of the payload */
+typedef struct Tlsf_Block_st {
+	struct Tlsf_Block_st *prevPhys; /* Neighbour below, used to merge on free */
+	uint32_t size; /* Payload bytes, bit 0 free, bit 1 neighbour below free */
+	struct Tlsf_Block_st *nextFree;
+	struct Tlsf_Block_st *prevFree;
+} Tlsf_Block_st;
+
+/* One heap: the bitmaps tell which lists hold a block, so a fitting list is
+ * found with two CLZ instead of a search */
+typedef struct {
+	uint32_t flBitmap;
+	uint32_t slBitmap[TLSF_FL_COUNT];
+	Tlsf_Block_st *lists[TLSF_FL_COUNT][TLSF_SL_COUNT];
+	Tlsf_Block_st *first; /* Lowest block, the walks start here */
+	uint8_t *end; /* Sentinel block at the top of the pool */
+	uint32_t usedBytes; /* Payload of the used blocks */
+	uint32_t peakUsedBytes;
+	uint32_t allocs;
+	uint32_t frees;
+	uint32_t failures; /* Requests without a fitting free block */
+} Tlsf_st;
+
+/* Result of a walk over all blocks, see Tlsf_getStats() */
+typedef struct {
+	uint32_t usedBytes;
+	uint32_t freeBytes;
+	uint32_t usedBlocks;
+	uint32_t freeBlocks;
+	uint32_t largestFree;
+	uint32_t fragmentation; /* Percent of the free bytes outside the largest free block */
+} Tlsf_Stats_st;
+
+#if (0U != TLSF_MALLOC)
+/* Heap behind malloc, created on the first call */
+extern Tlsf_st g_tlsfHeap;
+#endif
+
+/**
+  * @brief  Create a heap over caller-provided memory
+  * @param  tlsf: heap object
+  * @param  memory: pool, trimmed to TLSF_ALIGN
+  * @param  bytes: size of the pool
+  * @retval false if the pool is too small or too large for TLSF_FL_MAX
+  */
+bool Tlsf_create(Tlsf_st *tlsf, void *memory, uint32_t bytes);
+
+/**
+  * @brief  Allocate a block, constant time
+  * @note   Not reentrant, callers from several contexts lock around it
+  * @param  tlsf: heap object
+  * @param  size: requested bytes
+  * @retval Block aligned to TLSF_ALIGN, NULL if no free block fits
+  */
+void *Tlsf_malloc(Tlsf_st *tlsf, uint32_t size);
+
+/**
+  * @brief  Return a block and merge it with free neighbours, constant time
+  * @param  tlsf: heap object
+  * @param  ptr: block, NULL is ignored
+  * @retval None
+  */
+void Tlsf_free(Tlsf_st *tlsf, void *ptr);
+
+/**
+  * @brief  Resize a block in place, when it shrinks or the neighbour above
+  *         is free and large enough, constant time
+  * @param  tlsf: heap object
+  * @param  ptr: block, not NULL
+  * @param  size: new size, not 0
+  * @retval false if the block has to move, it is left unchanged then
+  */
+bool Tlsf_resize(Tlsf_st *tlsf, void *ptr, uint32_t size);
+
+/**
+  * @brief  Payload bytes of a block, at least the requested size
+  * @param  ptr: block, not NULL
+  * @retval Usable bytes
+  */
+uint32_t Tlsf_getUsableSize(const void *ptr);
+
+/**
+  * @brief  Resize a block, in place with Tlsf_resize() if possible, else by
+  *         allocate, copy and free
+  * @note   The copy is linear in the size. Callers that lock around the
+  *         heap lock Tlsf_resize(), Tlsf_malloc() and Tlsf_free() one by one
+  *         and copy in between, see realloc() with TLSF_MALLOC
+  * @param  tlsf: heap object
+  * @param  ptr: block, NULL allocates
+  * @param  size: new size, 0 frees
+  * @retval Block, NULL if no free block fits (ptr stays valid)
+  */
+void *Tlsf_realloc(Tlsf_st *tlsf, void *ptr, uint32_t size);
+
+/**
+  * @brief  Check the heap: block chain, flags, free lists and bitmaps
+  * @note   Walks all blocks, for tests and debug builds
+  * @param  tlsf: heap object
+  * @retval Number of inconsistencies, 0 for a sound heap
+  */
+uint32_t Tlsf_check(const Tlsf_st *tlsf);
+
+/**
+  * @brief  Used and free bytes, block counts and fragmentation
+  * @note   Walks all blocks
+  * @param  tlsf: heap object
+  * @param  stats: result
+  * @retval None
+  */
+void Tlsf_getStats(const Tlsf_st *tlsf, Tlsf_Stats_st *stats);
+
+#endif
@@ -0,0 +1,63 @@
+/*****************************************************************************
+ * @file      registry.h
+ * @author    Jet Station
+ * @brief     Static registries collected by the linker from any module
+ * @date      [2026-10-17]
+ *
+ * Contact:
+ *   @website   https://jet-station.github.io/
+ *   @github    https://github.com/jet-station
+ *   @linkedin  https://www.linkedin.com/in/thien-ai-ho/
+ *   @email     thienaiho95@gmail.com
+ *
+ * @copyright  Copyright (c) 2026 Jet Station. All rights reserved.
+ *****************************************************************************/
+
+#ifndef __REGISTRY_H__
+#define __REGISTRY_H__
+
+#include <stdint.h>
+
+/* Every entry of registry <name> is a const object in the section
+ * reg_<name>. The linker places all of them next to each other in flash
+ * and defines symbols at both ends, the runtime walks the array between
+ * them: no registration call, no RAM, no central list.
+ *   armlink: reg_<name>$$Base and reg_<name>$$Limit for any input section,
+ *            with or without a scatter file. Keep the sections with
+ *            --keep *.o(reg_*) in the linker Misc controls
+ *   GNU ld:  __start_reg_<name> and __stop_reg_<name> for an output section
+ *            whose name is a C identifier, see registry.ld */
+#if defined(__ARMCC_VERSION)
+#define REGISTRY_BASE(name) reg_##name##$$Base
+#define REGISTRY_LIMIT(name) reg_##name##$$Limit
+#else
+#define REGISTRY_BASE(name) __start_reg_##name
+#define REGISTRY_LIMIT(name) __stop_reg_##name
+#endif
+
+#define REGISTRY_SECTION(name) "reg_" #name
+
+/* Bounds of a registry, once in the header of the module that walks it.
+ * Weak: a registry without entries has no section, both ends are NULL */
+#define REGISTRY_DECLARE(name, type) \
+	extern const type REGISTRY_BASE(name)[] __attribute__((weak)); \
+	extern const type REGISTRY_LIMIT(name)[] __attribute__((weak))
+
+/* Entry definition, followed by its initializer:
+ *   REGISTRY_ADD(bench, Bench_Case_st, s_macroCase) = { "macro", Test_callMacroFunc };
+ * The explicit alignment keeps the compiler from padding large entries
+ * apart, the section stays a plain array */
+#define REGISTRY_ADD(name, type, id) \
+	static const type id __attribute__((used, section(REGISTRY_SECTION(name)), aligned(__alignof__(type))))
+
+/* First entry and one past the last one */
+#define REGISTRY_BEGIN(name) (&REGISTRY_BASE(name)[0])
+#define REGISTRY_END(name) (&REGISTRY_LIMIT(name)[0])
+
+#define REGISTRY_COUNT(name) ((uint32_t)(REGISTRY_END(name) - REGISTRY_BEGIN(name)))
+
+/* Loop over all entries in link order */
+#define REGISTRY_FOREACH(name, type, entry) \
+	for (const type *entry = REGISTRY_BEGIN(name); entry < REGISTRY_END(name); entry++)
+
+#endif
@@ -0,0 +1,245 @@
+/*****************************************************************************
+ * @file      event_queue.c
+ * @author    Jet Station
+ * @brief     Lock-free ISR-to-main event queues
+ * @date      [2026-10-17]
+ *
+ * Contact:
+ *   @website   https://jet-station.github.io/
+ *   @github    https://github.com/jet-station
+ *   @linkedin  https://www.linkedin.com/in/thien-ai-ho/
+ *   @email     thienaiho95@gmail.com
+ *
+ * @copyright  Copyright (c) 2026 Jet Station. All rights reserved.
+ *****************************************************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "stm32f1xx.h"
+#include "event_queue.h"
+
+/**
+  * @brief  Check for a non-zero power of two
+  * @param  size: queue size
+  * @retval bool
+  */
+static inline bool EventQueue_isPow2(uint32_t size)
+{
+	return (0U != size) && (0U == (size & (size - 1U)));
+}
+
+/**
+  * @brief  Count a lost event, producers of any priority may race here
+  * @param  dropped: drop counter
+  * @retval None
+  */
+static void EventQueue_countDrop(volatile uint32_t *dropped)
+{
+	uint32_t l_count_u32 = 0U;
+
+	do
+	{
+		l_count_u32 = __LDREXW(dropped) + 1U;
+	} while (0U != __STREXW(l_count_u32, dropped));
+}
+
+/**
+  * @brief  Initialize a single-producer queue
+  * @param  queue: queue object
+  * @param  buffer: event storage
+  * @param  size: number of events, power of two
+  * @retval false if size is not a power of two
+  */
+bool EventQueue_spscInit(EventQueue_Spsc_st *queue, EventQueue_Event_st *buffer, uint32_t size)
+{
+	if ((NULL == queue) || (NULL == buffer) || (false == EventQueue_isPow2(size)))
+	{
+		return false;
+	}
+
+	queue->buffer = buffer;
+	queue->mask = size - 1U;
+	queue->head = 0U;
+	queue->tail = 0U;
+	queue->dropped = 0U;
+
+	return true;
+}
+
+/**
+  * @brief  Append an event, called by the only producer
+  * @param  queue: queue object
+  * @param  id: event type
+  * @param  data: payload
+  * @retval false if the queue is full, the event is counted as dropped
+  */
+bool EventQueue_spscPush(EventQueue_Spsc_st *queue, uint32_t id, uint32_t data)
+{
+	uint32_t l_head_u32 = queue->head;
+	EventQueue_Event_st *l_event_pst = NULL;
+
+	if ((l_head_u32 - queue->tail) > queue->mask)
+	{
+		queue->dropped++;
+		return false;
+	}
+
+	l_event_pst = &queue->buffer[l_head_u32 & queue->mask];
+	l_event_pst->id = id;
+	l_event_pst->data = data;
+
+	/* The event must be complete before the consumer can see the new head */
+	__DMB();
+	queue->head = l_head_u32 + 1U;
+
+	return true;
+}
+
+/**
+  * @brief  Remove up to max events in one pass, called by the consumer
+  * @param  queue: queue object
+  * @param  events: destination array
+  * @param  max: capacity of the destination array
+  * @retval Number of events removed
+  */
+uint32_t EventQueue_spscPopBatch(EventQueue_Spsc_st *queue, EventQueue_Event_st *events, uint32_t max)
+{
+	uint32_t l_tail_u32 = queue->tail;
+	uint32_t l_count_u32 = queue->head - l_tail_u32;
+	uint32_t l_index_u32 = 0U;
+
+	if (l_count_u32 > max)
+	{
+		l_count_u32 = max;
+	}
+
+	/* Read the events only after the head that published them */
+	__DMB();
+	for (l_index_u32 = 0U; l_index_u32 < l_count_u32; l_index_u32++)
+	{
+		events[l_index_u32] = queue->buffer[(l_tail_u32 + l_index_u32) & queue->mask];
+	}
+
+	/* Release all slots at once, after the copies are done */
+	__DMB();
+	queue->tail = l_tail_u32 + l_count_u32;
+
+	return l_count_u32;
+}
+
+/**
+  * @brief  Initialize a multi-producer queue
+  * @param  queue: queue object
+  * @param  slots: slot storage
+  * @param  size: number of slots, power of two
+  * @retval false if size is not a power of two
+  */
+bool EventQueue_mpscInit(EventQueue_Mpsc_st *queue, EventQueue_Slot_st *slots, uint32_t size)
+{
+	uint32_t l_index_u32 = 0U;
+
+	if ((NULL == queue) || (NULL == slots) || (false == EventQueue_isPow2(size)))
+	{
+		return false;
+	}
+
+	/* Slot i is free for the producer that reserves position i */
+	for (l_index_u32 = 0U; l_index_u32 < size; l_index_u32++)
+	{
+		slots[l_index_u32].seq = l_index_u32;
+	}
+
+	queue->slots = slots;
+	queue->mask = size - 1U;
+	queue->head = 0U;
+	queue->tail = 0U;
+	queue->dropped = 0U;
+
+	return true;
+}
+
+/**
+  * @brief  Append an event, safe from any number of nested ISRs
+  * @param  queue: queue object
+  * @param  id: event type
+  * @param  data: payload
+  * @retval false if the queue is full, the event is counted as dropped
+  */
+bool EventQueue_mpscPush(EventQueue_Mpsc_st *queue, uint32_t id, uint32_t data)
+{
+	EventQueue_Slot_st *l_slot_pst = NULL;
+	uint32_t l_pos_u32 = 0U;
+	int32_t l_lap_i32 = 0;
+
+	/* Reserve a position, a nested producer in between makes STREX fail */
+	while (1)
+	{
+		l_pos_u32 = __LDREXW(&queue->head);
+		l_slot_pst = &queue->slots[l_pos_u32 & queue->mask];
+		l_lap_i32 = (int32_t)(l_slot_pst->seq - l_pos_u32);
+
+		if (0 == l_lap_i32)
+		{
+			if (0U == __STREXW(l_pos_u32 + 1U, &queue->head))
+			{
+				break;
+			}
+		}
+		else if (l_lap_i32 < 0)
+		{
+			/* The consumer has not released the slot of the previous lap */
+			__CLREX();
+			EventQueue_countDrop(&queue->dropped);
+			return false;
+		}
+		else
+		{
+			/* A nested producer took this position after the LDREX */
+			__CLREX();
+		}
+	}
+
+	l_slot_pst->event.id = id;
+	l_slot_pst->event.data = data;
+
+	/* Publish the slot only once the event is complete */
+	__DMB();
+	l_slot_pst->seq = l_pos_u32 + 1U;
+
+	return true;
+}
+
+/**
+  * @brief  Remove up to max events in one pass, called by the consumer
+  * @param  queue: queue object
+  * @param  events: destination array
+  * @param  max: capacity of the destination array
+  * @retval Number of events removed
+  */
+uint32_t EventQueue_mpscPopBatch(EventQueue_Mpsc_st *queue, EventQueue_Event_st *events, uint32_t max)
+{
+	EventQueue_Slot_st *l_slot_pst = NULL;
+	uint32_t l_count_u32 = 0U;
+
+	while (l_count_u32 < max)
+	{
+		l_slot_pst = &queue->slots[queue->tail & queue->mask];
+		if (l_slot_pst->seq != (queue->tail + 1U))
+		{
+			/* Empty, or reserved by a producer that has not published yet */
+			break;
+		}
+
+		__DMB();
+		events[l_count_u32] = l_slot_pst->event;
+		__DMB();
+
+		/* Free the slot for the producer one lap ahead */
+		l_slot_pst->seq = queue->tail + queue->mask + 1U;
+		queue->tail++;
+		l_count_u32++;
+	}
+
+	return l_count_u32;
+}
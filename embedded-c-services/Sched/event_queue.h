@@ -0,0 +1,131 @@
+/*****************************************************************************
+ * @file      event_queue.h
+ * @author    Jet Station
+ * @brief     Lock-free ISR-to-main event queues
+ * @date      [2026-10-17]
+ *
+ * Contact:
+ *   @website   https://jet-station.github.io/
+ *   @github    https://github.com/jet-station
+ *   @linkedin  https://www.linkedin.com/in/thien-ai-ho/
+ *   @email     thienaiho95@gmail.com
+ *
+ * @copyright  Copyright (c) 2026 Jet Station. All rights reserved.
+ *****************************************************************************/
+
+#ifndef __EVENT_QUEUE_H__
+#define __EVENT_QUEUE_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Event passed from an ISR to the main loop */
+typedef struct {
+	uint32_t id; /* Event type, defined by the application */
+	uint32_t data; /* Payload, e.g. the tick or a pin state */
+} EventQueue_Event_st;
+
+/* Single producer, single consumer queue. head and tail run freely, the
+ * slot index is taken modulo the power-of-two size */
+typedef struct {
+	EventQueue_Event_st *buffer;
+	uint32_t mask; /* Size - 1 */
+	volatile uint32_t head; /* Written by the producer only */
+	volatile uint32_t tail; /* Written by the consumer only */
+	volatile uint32_t dropped; /* Events lost because the queue was full */
+} EventQueue_Spsc_st;
+
+/* Slot of a multi-producer queue, seq tells whose turn the slot is */
+typedef struct {
+	volatile uint32_t seq;
+	EventQueue_Event_st event;
+} EventQueue_Slot_st;
+
+/* Multiple producers (ISRs of any priority), single consumer queue */
+typedef struct {
+	EventQueue_Slot_st *slots;
+	uint32_t mask; /* Size - 1 */
+	volatile uint32_t head; /* Reserved by producers with LDREX/STREX */
+	uint32_t tail; /* Consumer only */
+	volatile uint32_t dropped; /* Events lost because the queue was full */
+} EventQueue_Mpsc_st;
+
+/**
+  * @brief  Initialize a single-producer queue
+  * @param  queue: queue object
+  * @param  buffer: event storage
+  * @param  size: number of events, power of two
+  * @retval false if size is not a power of two
+  */
+bool EventQueue_spscInit(EventQueue_Spsc_st *queue, EventQueue_Event_st *buffer, uint32_t size);
+
+/**
+  * @brief  Append an event, called by the only producer
+  * @param  queue: queue object
+  * @param  id: event type
+  * @param  data: payload
+  * @retval false if the queue is full, the event is counted as dropped
+  */
+bool EventQueue_spscPush(EventQueue_Spsc_st *queue, uint32_t id, uint32_t data);
+
+/**
+  * @brief  Remove up to max events in one pass, called by the consumer
+  * @param  queue: queue object
+  * @param  events: destination array
+  * @param  max: capacity of the destination array
+  * @retval Number of events removed
+  */
+uint32_t EventQueue_spscPopBatch(EventQueue_Spsc_st *queue, EventQueue_Event_st *events, uint32_t max);
+
+/**
+  * @brief  Initialize a multi-producer queue
+  * @param  queue: queue object
+  * @param  slots: slot storage
+  * @param  size: number of slots, power of two
+  * @retval false if size is not a power of two
+  */
+bool EventQueue_mpscInit(EventQueue_Mpsc_st *queue, EventQueue_Slot_st *slots, uint32_t size);
+
+/**
+  * @brief  Append an event, safe from any number of nested ISRs
+  * @param  queue: queue object
+  * @param  id: event type
+  * @param  data: payload
+  * @retval false if the queue is full, the event is counted as dropped
+  */
+bool EventQueue_mpscPush(EventQueue_Mpsc_st *queue, uint32_t id, uint32_t data);
+
+/**
+  * @brief  Remove up to max events in one pass, called by the consumer
+  * @note   Stops at a slot that is reserved but not yet written by an
+  *         interrupted producer, the event is picked up by the next pass
+  * @param  queue: queue object
+  * @param  events: destination array
+  * @param  max: capacity of the destination array
+  * @retval Number of events removed
+  */
+uint32_t EventQueue_mpscPopBatch(EventQueue_Mpsc_st *queue, EventQueue_Event_st *events, uint32_t max);
+
+/**
+  * @brief  Remove one event
+  * @param  queue: queue object
+  * @param  event: destination
+  * @retval false if the queue is empty
+  */
+static inline bool EventQueue_spscPop(EventQueue_Spsc_st *queue, EventQueue_Event_st *event)
+{
+	return (0U != EventQueue_spscPopBatch(queue, event, 1U));
+}
+
+/**
+  * @brief  Remove one event
+  * @param  queue: queue object
+  * @param  event: destination
+  * @retval false if the queue is empty
+  */
+static inline bool EventQueue_mpscPop(EventQueue_Mpsc_st *queue, EventQueue_Event_st *event)
+{
+	return (0U != EventQueue_mpscPopBatch(queue, event, 1U));
+}
+
+#endif
@@ -0,0 +1,320 @@
+/*****************************************************************************
+ * @file      task_scheduler.c
+ * @author    Jet Station
+ * @brief     Cooperative run-to-completion task scheduler
+ * @date      [2026-10-17]
+ *
+ * Contact:
+ *   @website   https://jet-station.github.io/
+ *   @github    https://github.com/jet-station
+ *   @linkedin  https://www.linkedin.com/in/thien-ai-ho/
+ *   @email     thienaiho95@gmail.com
+ *
+ * @copyright  Copyright (c) 2026 Jet Station. All rights reserved.
+ *****************************************************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "stm32f1xx_hal.h"
+#include "mono_clock.h"
+#include "task_scheduler.h"
+#if defined(TASK_SCHED_JITTER_MON)
+#include "jitter_monitor.h"
+#endif
+
+/* Task table registered by TaskSched_init() */
+static TaskSched_Task_st *s_tasks_pst = NULL;
+static uint32_t s_taskCount_u32 = 0U;
+
+/* Task lookup by priority */
+static TaskSched_Task_st *s_byPriority_pst[TASK_SCHED_MAX_TASKS];
+
+/* Bit n set: the task with priority n is ready, written from ISRs too */
+static volatile uint32_t s_ready_u32 = 0U;
+
+/* Earliest periodic release, the table is only scanned once it is due */
+static uint32_t s_nextDue_u32 = 0U;
+static bool s_hasPeriodic_b = false;
+
+/**
+  * @brief  Atomically set bits of the ready bitmap
+  * @param  mask: bits to set
+  * @retval None
+  */
+static void TaskSched_setBits(uint32_t mask)
+{
+	uint32_t l_ready_u32 = 0U;
+
+	do
+	{
+		l_ready_u32 = __LDREXW(&s_ready_u32) | mask;
+	} while (0U != __STREXW(l_ready_u32, &s_ready_u32));
+}
+
+/**
+  * @brief  Atomically clear bits of the ready bitmap
+  * @param  mask: bits to clear
+  * @retval None
+  */
+static void TaskSched_clearBits(uint32_t mask)
+{
+	uint32_t l_ready_u32 = 0U;
+
+	do
+	{
+		l_ready_u32 = __LDREXW(&s_ready_u32) & ~mask;
+	} while (0U != __STREXW(l_ready_u32, &s_ready_u32));
+}
+
+/**
+  * @brief  Set the ready bit of every periodic task whose release is due
+  * @param  now: current tick
+  * @retval None
+  */
+static void TaskSched_release(uint32_t now)
+{
+	TaskSched_Task_st *l_task_pst = NULL;
+	uint32_t l_index_u32 = 0U;
+	uint32_t l_lag_u32 = 0U;
+	uint32_t l_minDelta_u32 = 0x7FFFFFFFU;
+	uint32_t l_released_u32 = 0U;
+
+	if ((false == s_hasPeriodic_b) || (false == MonoClock_isDue32(now, s_nextDue_u32)))
+	{
+		return;
+	}
+
+	for (l_index_u32 = 0U; l_index_u32 < s_taskCount_u32; l_index_u32++)
+	{
+		l_task_pst = &s_tasks_pst[l_index_u32];
+		if (0U == l_task_pst->period)
+		{
+			continue;
+		}
+
+		if (MonoClock_isDue32(now, l_task_pst->nextRelease))
+		{
+			if (0U != (s_ready_u32 & (1UL << l_task_pst->priority)))
+			{
+				l_task_pst->missedReleases++;
+			}
+
+			/* Skip the periods lost while the loop was busy, keep the phase */
+			l_lag_u32 = now - l_task_pst->nextRelease;
+			if (l_lag_u32 >= l_task_pst->period)
+			{
+				l_task_pst->missedReleases += l_lag_u32 / l_task_pst->period;
+				l_task_pst->nextRelease += (l_lag_u32 / l_task_pst->period) * l_task_pst->period;
+			}
+			l_task_pst->nextRelease += l_task_pst->period;
+			l_released_u32 |= (1UL << l_task_pst->priority);
+		}
+
+		if ((l_task_pst->nextRelease - now) < l_minDelta_u32)
+		{
+			l_minDelta_u32 = l_task_pst->nextRelease - now;
+		}
+	}
+
+	s_nextDue_u32 = now + l_minDelta_u32;
+	TaskSched_setBits(l_released_u32);
+}
+
+/**
+  * @brief  Register the task table and enable the DWT cycle counter
+  * @param  tasks: statically allocated task table
+  * @param  count: number of tasks
+  * @retval false if the table is too long or two tasks share a priority
+  */
+bool TaskSched_init(TaskSched_Task_st *tasks, uint32_t count)
+{
+	TaskSched_Task_st *l_task_pst = NULL;
+	uint32_t l_index_u32 = 0U;
+	uint32_t l_now_u32 = HAL_GetTick();
+
+	if ((NULL == tasks) || (count > TASK_SCHED_MAX_TASKS))
+	{
+		return false;
+	}
+
+	for (l_index_u32 = 0U; l_index_u32 < TASK_SCHED_MAX_TASKS; l_index_u32++)
+	{
+		s_byPriority_pst[l_index_u32] = NULL;
+	}
+
+	s_hasPeriodic_b = false;
+	s_nextDue_u32 = l_now_u32 + 0x7FFFFFFFU;
+
+	for (l_index_u32 = 0U; l_index_u32 < count; l_index_u32++)
+	{
+		l_task_pst = &tasks[l_index_u32];
+		if ((l_task_pst->priority >= TASK_SCHED_MAX_TASKS) ||
+		    (NULL != s_byPriority_pst[l_task_pst->priority]) ||
+		    (NULL == l_task_pst->run))
+		{
+			return false;
+		}
+		s_byPriority_pst[l_task_pst->priority] = l_task_pst;
+
+		l_task_pst->nextRelease = l_now_u32 + l_task_pst->offset;
+		l_task_pst->lastCycles = 0U;
+		l_task_pst->wcetCycles = 0U;
+		l_task_pst->runCount = 0U;
+		l_task_pst->missedReleases = 0U;
+
+		if (0U != l_task_pst->period)
+		{
+			if ((false == s_hasPeriodic_b) || ((int32_t)(l_task_pst->nextRelease - s_nextDue_u32) < 0))
+			{
+				s_nextDue_u32 = l_task_pst->nextRelease;
+			}
+			s_hasPeriodic_b = true;
+		}
+	}
+
+	s_tasks_pst = tasks;
+	s_taskCount_u32 = count;
+	s_ready_u32 = 0U;
+
+#if defined(TASK_SCHED_JITTER_MON)
+	/* Channel n monitors table entry n, event-driven tasks have no period */
+	JitterMon_init();
+	for (l_index_u32 = 0U; (l_index_u32 < count) && (l_index_u32 < JITTER_MON_CHANNELS); l_index_u32++)
+	{
+		if (0U != tasks[l_index_u32].period)
+		{
+			JitterMon_setup(l_index_u32, tasks[l_index_u32].period * 1000U * (uint32_t)HAL_GetTickFreq(),
+			                0U, TASK_SCHED_JITTER_BIN_US);
+		}
+	}
+#endif
+
+	/* Cycle counter for the execution time measurement */
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+	return true;
+}
+
+/**
+  * @brief  Mark a task ready to run, safe to call from any ISR
+  * @param  priority: priority of the task
+  * @retval None
+  */
+void TaskSched_setReady(uint32_t priority)
+{
+	if (priority < TASK_SCHED_MAX_TASKS)
+	{
+		TaskSched_setBits(1UL << priority);
+	}
+}
+
+/**
+  * @brief  Release due periodic tasks and run the highest priority ready one
+  * @param  None
+  * @retval true if a task ran
+  */
+bool TaskSched_dispatch(void)
+{
+	TaskSched_Task_st *l_task_pst = NULL;
+	uint32_t l_priority_u32 = 0U;
+	uint32_t l_start_u32 = 0U;
+	uint32_t l_cycles_u32 = 0U;
+
+	TaskSched_release(HAL_GetTick());
+
+	if (0U == s_ready_u32)
+	{
+		return false;
+	}
+
+	/* Highest set bit is the highest priority ready task */
+	l_priority_u32 = 31U - __CLZ(s_ready_u32);
+	TaskSched_clearBits(1UL << l_priority_u32);
+
+	l_task_pst = s_byPriority_pst[l_priority_u32];
+	if (NULL == l_task_pst)
+	{
+		/* setReady() for a priority without a task */
+		return false;
+	}
+
+#if defined(TASK_SCHED_JITTER_MON)
+	/* Released one period before the next release, event-driven tasks
+	 * have no channel set up */
+	JitterMon_activateTick((uint32_t)(l_task_pst - s_tasks_pst), l_task_pst->nextRelease - l_task_pst->period);
+#endif
+
+	l_start_u32 = DWT->CYCCNT;
+	l_task_pst->run();
+	l_cycles_u32 = DWT->CYCCNT - l_start_u32;
+
+#if defined(TASK_SCHED_JITTER_MON)
+	JitterMon_complete((uint32_t)(l_task_pst - s_tasks_pst));
+#endif
+
+	l_task_pst->lastCycles = l_cycles_u32;
+	if (l_cycles_u32 > l_task_pst->wcetCycles)
+	{
+		l_task_pst->wcetCycles = l_cycles_u32;
+	}
+	l_task_pst->runCount++;
+
+	return true;
+}
+
+/**
+  * @brief  Ticks until the next periodic release
+  * @param  None
+  * @retval 0 if a release is due, TASK_SCHED_NO_RELEASE if none is pending
+  */
+uint32_t TaskSched_ticksToNextRelease(void)
+{
+	uint32_t l_now_u32 = HAL_GetTick();
+
+	if (false == s_hasPeriodic_b)
+	{
+		return TASK_SCHED_NO_RELEASE;
+	}
+	if (MonoClock_isDue32(l_now_u32, s_nextDue_u32))
+	{
+		return 0U;
+	}
+
+	return s_nextDue_u32 - l_now_u32;
+}
+
+/**
+  * @brief  Idle hook, the default implementation executes WFI
+  * @param  ticksToNextRelease: time until the next periodic release
+  * @retval None
+  */
+__weak void TaskSched_idle(uint32_t ticksToNextRelease)
+{
+	(void)ticksToNextRelease;
+	__WFI();
+}
+
+/**
+  * @brief  Scheduler loop, never returns
+  * @param  None
+  * @retval None
+  */
+void TaskSched_run(void)
+{
+	while (1)
+	{
+		if (false == TaskSched_dispatch())
+		{
+			/* Mask interrupts so that a task made ready by an ISR after the
+			 * check still wakes the core instead of waiting for the next tick */
+			__disable_irq();
+			if (0U == s_ready_u32)
+			{
+				TaskSched_idle(TaskSched_ticksToNextRelease());
+			}
+			__enable_irq();
+		}
+	}
+}
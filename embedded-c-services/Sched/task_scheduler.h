@@ -0,0 +1,99 @@
+/*****************************************************************************
+ * @file      task_scheduler.h
+ * @author    Jet Station
+ * @brief     Cooperative run-to-completion task scheduler
+ * @date      [2026-10-17]
+ *
+ * Contact:
+ *   @website   https://jet-station.github.io/
+ *   @github    https://github.com/jet-station
+ *   @linkedin  https://www.linkedin.com/in/thien-ai-ho/
+ *   @email     thienaiho95@gmail.com
+ *
+ * @copyright  Copyright (c) 2026 Jet Station. All rights reserved.
+ *****************************************************************************/
+
+#ifndef __TASK_SCHEDULER_H__
+#define __TASK_SCHEDULER_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* One ready bit per priority level */
+#define TASK_SCHED_MAX_TASKS (32U)
+
+/* Histogram bin width of the jitter monitor, used when the scheduler is
+ * built with TASK_SCHED_JITTER_MON to feed Measure/jitter_monitor.c */
+#ifndef TASK_SCHED_JITTER_BIN_US
+#define TASK_SCHED_JITTER_BIN_US (10U)
+#endif
+
+/* Returned by TaskSched_ticksToNextRelease() when no periodic task exists */
+#define TASK_SCHED_NO_RELEASE (0xFFFFFFFFU)
+
+typedef void (*TaskSched_Run)(void);
+
+/* Task descriptor, the runtime fields are maintained by the scheduler */
+typedef struct {
+	TaskSched_Run run; /* Task body, must run to completion */
+	uint32_t period; /* Release period in ticks, 0 for an event-driven task */
+	uint32_t offset; /* Ticks from TaskSched_init() to the first release */
+	uint8_t priority; /* 0..31, unique per task, 31 is the highest */
+	uint32_t nextRelease; /* Tick of the next periodic release */
+	uint32_t lastCycles; /* DWT cycles of the last run */
+	uint32_t wcetCycles; /* Worst-case execution in DWT cycles */
+	uint32_t runCount; /* Number of completed runs */
+	uint32_t missedReleases; /* Releases dropped because the task was still ready */
+} TaskSched_Task_st;
+
+/* Static initializer for one entry of the task table */
+#define TASK_SCHED_TASK(run, period, offset, priority) \
+	{ (run), (period), (offset), (priority), 0U, 0U, 0U, 0U, 0U }
+
+/**
+  * @brief  Register the task table and enable the DWT cycle counter
+  * @param  tasks: statically allocated task table
+  * @param  count: number of tasks, up to TASK_SCHED_MAX_TASKS
+  * @retval false if the table is too long or two tasks share a priority
+  */
+bool TaskSched_init(TaskSched_Task_st *tasks, uint32_t count);
+
+/**
+  * @brief  Mark a task ready to run, safe to call from any ISR
+  * @param  priority: priority of the task
+  * @retval None
+  */
+void TaskSched_setReady(uint32_t priority);
+
+/**
+  * @brief  Release due periodic tasks and run the highest priority ready one
+  * @param  None
+  * @retval true if a task ran
+  */
+bool TaskSched_dispatch(void);
+
+/**
+  * @brief  Ticks until the next periodic release
+  * @param  None
+  * @retval 0 if a release is due, TASK_SCHED_NO_RELEASE if none is pending
+  */
+uint32_t TaskSched_ticksToNextRelease(void);
+
+/**
+  * @brief  Scheduler loop, never returns
+  * @note   Calls TaskSched_idle() whenever no task is ready
+  * @param  None
+  * @retval None
+  */
+void TaskSched_run(void);
+
+/**
+  * @brief  Idle hook, the default implementation executes WFI
+  * @note   Called with interrupts masked, WFI still wakes on a pending
+  *         interrupt. Override to use TicklessIdle_sleep() for example
+  * @param  ticksToNextRelease: time until the next periodic release
+  * @retval None
+  */
+void TaskSched_idle(uint32_t ticksToNextRelease);
+
+#endif
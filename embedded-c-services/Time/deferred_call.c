@@ -0,0 +1,201 @@
+/*****************************************************************************
+ * @file      deferred_call.c
+ * @author    Jet Station
+ * @brief     Deferred function calls on the timer wheel
+ * @date      [2026-10-17]
+ *
+ * Contact:
+ *   @website   https://jet-station.github.io/
+ *   @github    https://github.com/jet-station
+ *   @linkedin  https://www.linkedin.com/in/thien-ai-ho/
+ *   @email     thienaiho95@gmail.com
+ *
+ * @copyright  Copyright (c) 2026 Jet Station. All rights reserved.
+ *****************************************************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "stm32f1xx.h"
+#include "timer_wheel.h"
+#include "deferred_call.h"
+
+/* One-shot timer nodes, a node is free whenever it is not running: the
+ * wheel unlinks it before the call, so the call may defer itself again */
+static TimerWheel_Timer_st s_calls[DEFERRED_CALL_SLOTS];
+
+/* Calls posted from interrupts. head and tail run freely, the slot index
+ * is taken modulo the power-of-two size */
+typedef struct {
+	TimerWheel_Callback fn;
+	void *ctx;
+} DeferredCall_Post_st;
+
+static DeferredCall_Post_st s_posts[DEFERRED_CALL_POSTS];
+static volatile uint32_t s_postHead_u32 = 0U; /* Written by the posting ISRs */
+static volatile uint32_t s_postTail_u32 = 0U; /* Written by the main loop */
+static volatile uint32_t s_postDropped_u32 = 0U;
+
+/**
+  * @brief  Find the running node of a call
+  * @param  fn: function of the call
+  * @param  ctx: context of the call
+  * @retval Node or NULL
+  */
+static TimerWheel_Timer_st *DeferredCall_find(TimerWheel_Callback fn, void *ctx)
+{
+	uint32_t l_index_u32 = 0U;
+
+	for (l_index_u32 = 0U; l_index_u32 < DEFERRED_CALL_SLOTS; l_index_u32++)
+	{
+		if (TimerWheel_isActive(&s_calls[l_index_u32]) &&
+		    (fn == s_calls[l_index_u32].callback) && (ctx == s_calls[l_index_u32].ctx))
+		{
+			return &s_calls[l_index_u32];
+		}
+	}
+
+	return NULL;
+}
+
+/**
+  * @brief  Call a function once after a delay, without blocking
+  * @param  ms: delay in ms, 1..TIMER_WHEEL_MAX_TICKS
+  * @param  fn: function to call
+  * @param  ctx: argument passed to the function
+  * @retval false if all slots are pending or the delay is out of range
+  */
+bool DeferredCall_after(uint32_t ms, TimerWheel_Callback fn, void *ctx)
+{
+	TimerWheel_Timer_st *l_call_pst = DeferredCall_find(fn, ctx);
+	uint32_t l_index_u32 = 0U;
+
+	for (l_index_u32 = 0U; (NULL == l_call_pst) && (l_index_u32 < DEFERRED_CALL_SLOTS); l_index_u32++)
+	{
+		if (false == TimerWheel_isActive(&s_calls[l_index_u32]))
+		{
+			l_call_pst = &s_calls[l_index_u32];
+		}
+	}
+
+	if (NULL == l_call_pst)
+	{
+		return false;
+	}
+
+	/* The wheel runs on HAL_GetTick(), its ticks are milliseconds */
+	return TimerWheel_start(l_call_pst, ms, 0U, fn, ctx);
+}
+
+/**
+  * @brief  Cancel a pending call
+  * @param  fn: function of the call
+  * @param  ctx: context of the call
+  * @retval true if a pending call was cancelled
+  */
+bool DeferredCall_cancel(TimerWheel_Callback fn, void *ctx)
+{
+	TimerWheel_Timer_st *l_call_pst = DeferredCall_find(fn, ctx);
+
+	if (NULL == l_call_pst)
+	{
+		return false;
+	}
+
+	TimerWheel_cancel(l_call_pst);
+
+	return true;
+}
+
+/**
+  * @brief  Check if a call is pending
+  * @param  fn: function of the call
+  * @param  ctx: context of the call
+  * @retval bool
+  */
+bool DeferredCall_isPending(TimerWheel_Callback fn, void *ctx)
+{
+	return (NULL != DeferredCall_find(fn, ctx));
+}
+
+/**
+  * @brief  Run a function from the next DeferredCall_process()
+  * @param  fn: function to call
+  * @param  ctx: argument passed to the function
+  * @retval false if the queue is full
+  */
+bool DeferredCall_post(TimerWheel_Callback fn, void *ctx)
+{
+	uint32_t l_primask_u32 = 0U;
+	uint32_t l_head_u32 = 0U;
+	bool l_posted_b = false;
+
+	if (NULL == fn)
+	{
+		return false;
+	}
+
+	/* A few instructions with interrupts masked, so that ISRs of any
+	 * priority can post without reserving slots concurrently */
+	l_primask_u32 = __get_PRIMASK();
+	__disable_irq();
+
+	l_head_u32 = s_postHead_u32;
+	if ((l_head_u32 - s_postTail_u32) >= DEFERRED_CALL_POSTS)
+	{
+		s_postDropped_u32++;
+	}
+	else
+	{
+		s_posts[l_head_u32 & (DEFERRED_CALL_POSTS - 1U)].fn = fn;
+		s_posts[l_head_u32 & (DEFERRED_CALL_POSTS - 1U)].ctx = ctx;
+
+		/* The call must be complete before the main loop sees the new head */
+		__DMB();
+		s_postHead_u32 = l_head_u32 + 1U;
+		l_posted_b = true;
+	}
+
+	__set_PRIMASK(l_primask_u32);
+
+	return l_posted_b;
+}
+
+/**
+  * @brief  Run the posted calls, then advance the timer wheel to now
+  * @param  now: current tick
+  * @retval None
+  */
+void DeferredCall_process(uint32_t now)
+{
+	DeferredCall_Post_st l_post_st;
+	uint32_t l_tail_u32 = s_postTail_u32;
+
+	/* Calls posted while the queue is drained, also by the calls
+	 * themselves, run in the same pass */
+	while (l_tail_u32 != s_postHead_u32)
+	{
+		/* Read the call only after the head that published it */
+		__DMB();
+		l_post_st = s_posts[l_tail_u32 & (DEFERRED_CALL_POSTS - 1U)];
+
+		/* Release the slot before the call so that it may post again */
+		__DMB();
+		l_tail_u32++;
+		s_postTail_u32 = l_tail_u32;
+
+		l_post_st.fn(l_post_st.ctx);
+	}
+
+	TimerWheel_process(now);
+}
+
+/**
+  * @brief  Number of posted calls lost because the queue was full
+  * @param  None
+  * @retval uint32_t
+  */
+uint32_t DeferredCall_dropped(void)
+{
+	return s_postDropped_u32;
+}
@@ -0,0 +1,93 @@
+/*****************************************************************************
+ * @file      deferred_call.h
+ * @author    Jet Station
+ * @brief     Deferred function calls on the timer wheel
+ * @date      [2026-10-17]
+ *
+ * Contact:
+ *   @website   https://jet-station.github.io/
+ *   @github    https://github.com/jet-station
+ *   @linkedin  https://www.linkedin.com/in/thien-ai-ho/
+ *   @email     thienaiho95@gmail.com
+ *
+ * @copyright  Copyright (c) 2026 Jet Station. All rights reserved.
+ *****************************************************************************/
+
+#ifndef __DEFERRED_CALL_H__
+#define __DEFERRED_CALL_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "timer_wheel.h"
+
+/* Number of calls that can be pending at the same time */
+#ifndef DEFERRED_CALL_SLOTS
+#define DEFERRED_CALL_SLOTS (8U)
+#endif
+
+/* Calls that interrupts can post before the main loop runs them, power of
+ * two */
+#ifndef DEFERRED_CALL_POSTS
+#define DEFERRED_CALL_POSTS (8U)
+#endif
+#if (0U != (DEFERRED_CALL_POSTS & (DEFERRED_CALL_POSTS - 1U)))
+#error "DEFERRED_CALL_POSTS must be a power of two"
+#endif
+
+/**
+  * @brief  Call a function once after a delay, without blocking
+  * @note   The call runs from TimerWheel_process(), the delay counts from
+  *         the last processed tick. A pending call with the same function
+  *         and context is restarted instead of queued twice
+  * @param  ms: delay in ms, 1..TIMER_WHEEL_MAX_TICKS
+  * @param  fn: function to call
+  * @param  ctx: argument passed to the function
+  * @retval false if all slots are pending or the delay is out of range
+  */
+bool DeferredCall_after(uint32_t ms, TimerWheel_Callback fn, void *ctx);
+
+/**
+  * @brief  Cancel a pending call, e.g. a timeout that is no longer needed
+  * @param  fn: function of the call
+  * @param  ctx: context of the call
+  * @retval true if a pending call was cancelled
+  */
+bool DeferredCall_cancel(TimerWheel_Callback fn, void *ctx);
+
+/**
+  * @brief  Check if a call is pending
+  * @param  fn: function of the call
+  * @param  ctx: context of the call
+  * @retval bool
+  */
+bool DeferredCall_isPending(TimerWheel_Callback fn, void *ctx);
+
+/**
+  * @brief  Move work out of an interrupt: run a function from the next
+  *         DeferredCall_process() of the main loop
+  * @note   Safe from any ISR priority. Posted calls run in the order they
+  *         were posted, before the timer wheel advances
+  * @param  fn: function to call
+  * @param  ctx: argument passed to the function
+  * @retval false if DEFERRED_CALL_POSTS calls are waiting, the call is
+  *         counted as dropped
+  */
+bool DeferredCall_post(TimerWheel_Callback fn, void *ctx);
+
+/**
+  * @brief  Run the posted calls, then advance the timer wheel to now
+  * @note   Called from the main loop instead of TimerWheel_process() when
+  *         interrupts post calls
+  * @param  now: current tick, e.g. HAL_GetTick()
+  * @retval None
+  */
+void DeferredCall_process(uint32_t now);
+
+/**
+  * @brief  Number of posted calls lost because the queue was full
+  * @param  None
+  * @retval uint32_t
+  */
+uint32_t DeferredCall_dropped(void);
+
+#endif
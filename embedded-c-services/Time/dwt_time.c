@@ -0,0 +1,228 @@
+/*****************************************************************************
+ * @file      dwt_time.c
+ * @author    Jet Station
+ * @brief     Cycle-accurate timestamps and delays on the DWT cycle counter
+ * @date      [2026-10-17]
+ *
+ * Contact:
+ *   @website   https://jet-station.github.io/
+ *   @github    https://github.com/jet-station
+ *   @linkedin  https://www.linkedin.com/in/thien-ai-ho/
+ *   @email     thienaiho95@gmail.com
+ *
+ * @copyright  Copyright (c) 2026 Jet Station. All rights reserved.
+ *****************************************************************************/
+
+#include <stdint.h>
+#include "stm32f1xx.h"
+#include "dwt_time.h"
+
+/* Longest delay handed to DwtTime_delayCycles() in one piece */
+#define DWT_TIME_US_CHUNK (1000000U)
+
+/* Counter value at the last update, the extension state is advanced from
+ * it with 32-bit operations only: no 64-bit division on every read */
+static uint32_t s_last_u32 = 0U;
+static uint32_t s_wraps_u32 = 0U;
+static uint32_t s_base_u32 = 0U; /* Counter value at DwtTime_init() */
+static uint64_t s_us_u64 = 0U;
+static uint32_t s_remCycles_u32 = 0U; /* Cycles of a started microsecond */
+
+static uint32_t s_cyclesPerUs_u32 = 1U;
+
+/* Cycles spent by a call of DwtTime_delayCycles() that does not wait */
+static uint32_t s_overhead_u32 = 0U;
+
+/**
+  * @brief  Fold the cycles since the last update into the extended state
+  * @note   Called with interrupts masked
+  * @param  None
+  * @retval Current counter value
+  */
+static uint32_t DwtTime_advance(void)
+{
+	uint32_t l_now_u32 = DWT->CYCCNT;
+	uint32_t l_delta_u32 = l_now_u32 - s_last_u32;
+
+	if (l_now_u32 < s_last_u32)
+	{
+		s_wraps_u32++;
+	}
+	s_last_u32 = l_now_u32;
+
+	s_us_u64 += l_delta_u32 / s_cyclesPerUs_u32;
+	s_remCycles_u32 += l_delta_u32 % s_cyclesPerUs_u32;
+	if (s_remCycles_u32 >= s_cyclesPerUs_u32)
+	{
+		s_remCycles_u32 -= s_cyclesPerUs_u32;
+		s_us_u64++;
+	}
+
+	return l_now_u32;
+}
+
+/**
+  * @brief  Measure the fixed cost of DwtTime_delayCycles()
+  * @param  None
+  * @retval None
+  */
+static void DwtTime_calibrate(void)
+{
+	volatile uint32_t l_start_u32 = 0U;
+	volatile uint32_t l_end_u32 = 0U;
+	uint32_t l_read_u32 = 0U;
+
+	/* Cost of the two counter reads themselves */
+	l_start_u32 = DWT->CYCCNT;
+	l_end_u32 = DWT->CYCCNT;
+	l_read_u32 = l_end_u32 - l_start_u32;
+
+	s_overhead_u32 = 0U;
+	l_start_u32 = DWT->CYCCNT;
+	DwtTime_delayCycles(0U);
+	l_end_u32 = DWT->CYCCNT;
+
+	s_overhead_u32 = (l_end_u32 - l_start_u32) - l_read_u32;
+}
+
+/**
+  * @brief  Enable the cycle counter and calibrate against SystemCoreClock
+  * @param  None
+  * @retval None
+  */
+void DwtTime_init(void)
+{
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+	s_last_u32 = DWT->CYCCNT;
+	s_base_u32 = s_last_u32;
+	s_wraps_u32 = 0U;
+	s_us_u64 = 0U;
+	s_remCycles_u32 = 0U;
+
+	DwtTime_clockChanged();
+}
+
+/**
+  * @brief  Take over a new SystemCoreClock without a jump in DwtTime_us()
+  * @param  None
+  * @retval None
+  */
+void DwtTime_clockChanged(void)
+{
+	uint32_t l_primask_u32 = __get_PRIMASK();
+	uint32_t l_cyclesPerUs_u32 = SystemCoreClock / 1000000U;
+
+	if (0U == l_cyclesPerUs_u32)
+	{
+		l_cyclesPerUs_u32 = 1U;
+	}
+
+	/* Account the elapsed cycles at the old rate, then switch. The partial
+	 * microsecond is dropped, less than 1 us per clock change */
+	__disable_irq();
+	(void)DwtTime_advance();
+	s_remCycles_u32 = 0U;
+	s_cyclesPerUs_u32 = l_cyclesPerUs_u32;
+	__set_PRIMASK(l_primask_u32);
+
+	/* Flash wait states change with the clock, measure the overhead again */
+	DwtTime_calibrate();
+}
+
+/**
+  * @brief  Raw 32-bit cycle counter
+  * @param  None
+  * @retval uint32_t
+  */
+uint32_t DwtTime_cycles(void)
+{
+	return DWT->CYCCNT;
+}
+
+/**
+  * @brief  Cycles since DwtTime_init(), extended to 64 bits
+  * @param  None
+  * @retval uint64_t
+  */
+uint64_t DwtTime_cycles64(void)
+{
+	uint32_t l_primask_u32 = __get_PRIMASK();
+	uint32_t l_now_u32 = 0U;
+	uint32_t l_wraps_u32 = 0U;
+
+	__disable_irq();
+	l_now_u32 = DwtTime_advance();
+	l_wraps_u32 = s_wraps_u32;
+	__set_PRIMASK(l_primask_u32);
+
+	/* The wraps count from the init value on, the extended counter is
+	 * never below it */
+	return (((uint64_t)l_wraps_u32 << 32) | l_now_u32) - s_base_u32;
+}
+
+/**
+  * @brief  Microseconds since DwtTime_init(), continuous across clock changes
+  * @param  None
+  * @retval uint64_t
+  */
+uint64_t DwtTime_us(void)
+{
+	uint32_t l_primask_u32 = __get_PRIMASK();
+	uint64_t l_us_u64 = 0U;
+
+	__disable_irq();
+	(void)DwtTime_advance();
+	l_us_u64 = s_us_u64;
+	__set_PRIMASK(l_primask_u32);
+
+	return l_us_u64;
+}
+
+/**
+  * @brief  Busy-wait for a number of core cycles, call overhead included
+  * @note   Resolution is one polling iteration, a few cycles
+  * @param  cycles: delay in cycles
+  * @retval None
+  */
+void DwtTime_delayCycles(uint32_t cycles)
+{
+	uint32_t l_start_u32 = DWT->CYCCNT;
+
+	if (cycles > s_overhead_u32)
+	{
+		cycles -= s_overhead_u32;
+		while ((DWT->CYCCNT - l_start_u32) < cycles)
+		{
+		}
+	}
+}
+
+/**
+  * @brief  Busy-wait for a number of microseconds
+  * @param  us: delay in microseconds
+  * @retval None
+  */
+void DwtTime_delayUs(uint32_t us)
+{
+	uint32_t l_chunk_u32 = 0U;
+
+	/* Split long delays so that the cycle count cannot overflow */
+	while (0U != us)
+	{
+		l_chunk_u32 = (us > DWT_TIME_US_CHUNK) ? DWT_TIME_US_CHUNK : us;
+		DwtTime_delayCycles(l_chunk_u32 * s_cyclesPerUs_u32);
+		us -= l_chunk_u32;
+	}
+}
+
+/**
+  * @brief  Core cycles per microsecond of the current clock
+  * @param  None
+  * @retval uint32_t
+  */
+uint32_t DwtTime_getCyclesPerUs(void)
+{
+	return s_cyclesPerUs_u32;
+}
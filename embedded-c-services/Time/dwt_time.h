@@ -0,0 +1,81 @@
+/*****************************************************************************
+ * @file      dwt_time.h
+ * @author    Jet Station
+ * @brief     Cycle-accurate timestamps and delays on the DWT cycle counter
+ * @date      [2026-10-17]
+ *
+ * Contact:
+ *   @website   https://jet-station.github.io/
+ *   @github    https://github.com/jet-station
+ *   @linkedin  https://www.linkedin.com/in/thien-ai-ho/
+ *   @email     thienaiho95@gmail.com
+ *
+ * @copyright  Copyright (c) 2026 Jet Station. All rights reserved.
+ *****************************************************************************/
+
+#ifndef __DWT_TIME_H__
+#define __DWT_TIME_H__
+
+#include <stdint.h>
+
+/**
+  * @brief  Enable the cycle counter and calibrate against SystemCoreClock
+  * @param  None
+  * @retval None
+  */
+void DwtTime_init(void);
+
+/**
+  * @brief  Take over a new SystemCoreClock without a jump in DwtTime_us()
+  * @note   Call after SystemCoreClockUpdate() or HAL_RCC_ClockConfig()
+  * @param  None
+  * @retval None
+  */
+void DwtTime_clockChanged(void);
+
+/**
+  * @brief  Raw 32-bit cycle counter, wraps every 2^32 / SystemCoreClock s
+  * @param  None
+  * @retval uint32_t
+  */
+uint32_t DwtTime_cycles(void);
+
+/**
+  * @brief  Cycles since DwtTime_init(), extended to 64 bits
+  * @note   Needs a call of DwtTime_cycles64() or DwtTime_us() at least once
+  *         per wrap of the counter (59 s at 72 MHz)
+  * @param  None
+  * @retval uint64_t
+  */
+uint64_t DwtTime_cycles64(void);
+
+/**
+  * @brief  Microseconds since DwtTime_init(), continuous across clock changes
+  * @note   Same call rate requirement as DwtTime_cycles64()
+  * @param  None
+  * @retval uint64_t
+  */
+uint64_t DwtTime_us(void);
+
+/**
+  * @brief  Busy-wait for a number of core cycles, call overhead included
+  * @param  cycles: delay in cycles
+  * @retval None
+  */
+void DwtTime_delayCycles(uint32_t cycles);
+
+/**
+  * @brief  Busy-wait for a number of microseconds
+  * @param  us: delay in microseconds
+  * @retval None
+  */
+void DwtTime_delayUs(uint32_t us);
+
+/**
+  * @brief  Core cycles per microsecond of the current clock
+  * @param  None
+  * @retval uint32_t
+  */
+uint32_t DwtTime_getCyclesPerUs(void);
+
+#endif
@@ -0,0 +1,100 @@
+/*****************************************************************************
+ * @file      mono_clock.c
+ * @author    Jet Station
+ * @brief     64-bit monotonic clock on top of the HAL tick
+ * @date      [2026-10-17]
+ *
+ * Contact:
+ *   @website   https://jet-station.github.io/
+ *   @github    https://github.com/jet-station
+ *   @linkedin  https://www.linkedin.com/in/thien-ai-ho/
+ *   @email     thienaiho95@gmail.com
+ *
+ * @copyright  Copyright (c) 2026 Jet Station. All rights reserved.
+ *****************************************************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "stm32f1xx_hal.h"
+#include "mono_clock.h"
+
+/* Overflow epoch of uwTick: bits 31..1 count the rollovers, bit 0 holds the
+ * MSB of uwTick seen by the last reader. Packing both into one word lets
+ * LDREX/STREX update them together, an ISR that reads the clock in between
+ * makes the STREX fail and the reader retries with fresh values. */
+static volatile uint32_t s_epoch_u32 = 0U;
+
+/* SysTick reload and cycles per microsecond for the sub-ms interpolation */
+static uint32_t s_reload_u32 = 0U;
+static uint32_t s_cyclesPerUs_u32 = 0U;
+
+/**
+  * @brief  Capture the SysTick period used for sub-millisecond timestamps
+  * @param  None
+  * @retval None
+  */
+void MonoClock_init(void)
+{
+	s_reload_u32 = SysTick->LOAD;
+	s_cyclesPerUs_u32 = (s_reload_u32 + 1U) / (1000U * (uint32_t)HAL_GetTickFreq());
+}
+
+/**
+  * @brief  Milliseconds since reset, never rolls over
+  * @param  None
+  * @retval uint64_t
+  */
+uint64_t MonoClock_nowMs(void)
+{
+	uint32_t l_epoch_u32 = 0U;
+	uint32_t l_tick_u32 = 0U;
+	uint32_t l_msb_u32 = 0U;
+
+	do
+	{
+		l_epoch_u32 = __LDREXW(&s_epoch_u32);
+		l_tick_u32 = uwTick;
+		l_msb_u32 = l_tick_u32 >> 31;
+
+		/* MSB fell from 1 to 0: uwTick rolled over since the last reader,
+		 * adding 1 bumps the epoch and clears the stored MSB in one go */
+		l_epoch_u32 += (l_epoch_u32 & ~l_msb_u32 & 1U);
+		l_epoch_u32 |= l_msb_u32;
+	} while (0U != __STREXW(l_epoch_u32, &s_epoch_u32));
+
+	return ((uint64_t)(l_epoch_u32 >> 1) << 32) | l_tick_u32;
+}
+
+/**
+  * @brief  Microseconds since reset, interpolated from SysTick->VAL
+  * @param  None
+  * @retval uint64_t
+  */
+uint64_t MonoClock_nowUs(void)
+{
+	uint64_t l_ms_u64 = 0U;
+	uint32_t l_val_u32 = 0U;
+	uint32_t l_pending_u32 = 0U;
+	uint32_t l_subUs_u32 = 0U;
+
+	/* Retry if a tick was served between reading the ms and the counter */
+	do
+	{
+		l_ms_u64 = MonoClock_nowMs();
+		l_val_u32 = SysTick->VAL;
+		l_pending_u32 = SCB->ICSR & SCB_ICSR_PENDSTSET_Msk;
+	} while (l_ms_u64 != MonoClock_nowMs());
+
+	/* Interrupts masked: the counter reloaded but uwTick is not updated yet */
+	if ((0U != l_pending_u32) && (l_val_u32 > (s_reload_u32 / 2U)))
+	{
+		l_ms_u64 += (uint32_t)HAL_GetTickFreq();
+	}
+
+	if (0U != s_cyclesPerUs_u32)
+	{
+		l_subUs_u32 = (s_reload_u32 - l_val_u32) / s_cyclesPerUs_u32;
+	}
+
+	return (l_ms_u64 * 1000U) + l_subUs_u32;
+}
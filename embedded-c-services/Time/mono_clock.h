@@ -0,0 +1,91 @@
+/*****************************************************************************
+ * @file      mono_clock.h
+ * @author    Jet Station
+ * @brief     64-bit monotonic clock on top of the HAL tick
+ * @date      [2026-10-17]
+ *
+ * Contact:
+ *   @website   https://jet-station.github.io/
+ *   @github    https://github.com/jet-station
+ *   @linkedin  https://www.linkedin.com/in/thien-ai-ho/
+ *   @email     thienaiho95@gmail.com
+ *
+ * @copyright  Copyright (c) 2026 Jet Station. All rights reserved.
+ *****************************************************************************/
+
+#ifndef __MONO_CLOCK_H__
+#define __MONO_CLOCK_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+  * @brief  Capture the SysTick period used for sub-millisecond timestamps
+  * @note   Call after HAL_Init() and after every clock change
+  * @param  None
+  * @retval None
+  */
+void MonoClock_init(void);
+
+/**
+  * @brief  Milliseconds since reset, never rolls over
+  * @note   Safe from any context. Must be called at least once every
+  *         24 days (half the uwTick range) to catch every overflow
+  * @param  None
+  * @retval uint64_t
+  */
+uint64_t MonoClock_nowMs(void);
+
+/**
+  * @brief  Microseconds since reset, interpolated from SysTick->VAL
+  * @param  None
+  * @retval uint64_t
+  */
+uint64_t MonoClock_nowUs(void);
+
+/**
+  * @brief  Ticks elapsed between two 32-bit tick stamps
+  * @note   Unsigned subtraction is modulo 2^32, a counter rollover between
+  *         start and now needs no special handling
+  * @param  now: current tick stamp
+  * @param  start: earlier tick stamp
+  * @retval uint32_t
+  */
+static inline uint32_t MonoClock_elapsed32(uint32_t now, uint32_t start)
+{
+	return now - start;
+}
+
+/**
+  * @brief  Check if a 32-bit tick deadline is reached
+  * @note   Valid while the deadline is less than 2^31 ticks away from now
+  * @param  now: current tick stamp
+  * @param  deadline: tick stamp to compare against
+  * @retval bool
+  */
+static inline bool MonoClock_isDue32(uint32_t now, uint32_t deadline)
+{
+	return (int32_t)(now - deadline) >= 0;
+}
+
+/**
+  * @brief  Milliseconds elapsed since a 64-bit time stamp
+  * @param  since: earlier value of MonoClock_nowMs()
+  * @retval uint64_t
+  */
+static inline uint64_t MonoClock_elapsedMs(uint64_t since)
+{
+	return MonoClock_nowMs() - since;
+}
+
+/**
+  * @brief  Check if a 64-bit deadline in ms is reached
+  * @param  deadline: absolute time in ms
+  * @retval bool
+  */
+static inline bool MonoClock_deadlineReached(uint64_t deadline)
+{
+	return MonoClock_nowMs() >= deadline;
+}
+
+#endif
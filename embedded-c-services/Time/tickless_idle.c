@@ -0,0 +1,179 @@
+/*****************************************************************************
+ * @file      tickless_idle.c
+ * @author    Jet Station
+ * @brief     Tickless idle time base built on the HAL SysTick
+ * @date      [2026-10-17]
+ *
+ * Contact:
+ *   @website   https://jet-station.github.io/
+ *   @github    https://github.com/jet-station
+ *   @linkedin  https://www.linkedin.com/in/thien-ai-ho/
+ *   @email     thienaiho95@gmail.com
+ *
+ * @copyright  Copyright (c) 2026 Jet Station. All rights reserved.
+ *****************************************************************************/
+
+#include <stdint.h>
+#include "stm32f1xx_hal.h"
+#include "tickless_idle.h"
+
+/* SysTick cycles of one HAL tick, captured from HAL_InitTick() */
+static uint32_t s_cyclesPerTick = 0U;
+
+/* Longest one-shot period in ticks that fits the 24-bit reload register */
+static uint32_t s_maxIdleTicks = 0U;
+
+/* CTRL value with the counter stopped, keeps the clock source selection */
+static uint32_t s_ctrlStopped = 0U;
+
+/**
+  * @brief  Capture the SysTick reload set up by HAL_InitTick()
+  * @param  None
+  * @retval None
+  */
+void TicklessIdle_init(void)
+{
+	s_cyclesPerTick = SysTick->LOAD + 1U;
+	s_maxIdleTicks = SysTick_LOAD_RELOAD_Msk / s_cyclesPerTick;
+	s_ctrlStopped = SysTick->CTRL & (SysTick_CTRL_CLKSOURCE_Msk | SysTick_CTRL_TICKINT_Msk);
+}
+
+/**
+  * @brief  Longest idle period a single sleep can cover
+  * @param  None
+  * @retval Period in ms
+  */
+uint32_t TicklessIdle_getMaxIdleMs(void)
+{
+	return s_maxIdleTicks * (uint32_t)HAL_GetTickFreq();
+}
+
+/**
+  * @brief  Sleep until the next deadline or any interrupt
+  * @param  idleMs: time until the next due deadline in ms
+  * @retval Number of milliseconds actually slept
+  */
+uint32_t TicklessIdle_sleep(uint32_t idleMs)
+{
+	uint32_t l_tickMs_u32 = (uint32_t)HAL_GetTickFreq();
+	uint32_t l_idleTicks_u32 = idleMs / l_tickMs_u32;
+	uint32_t l_reload_u32 = 0U;
+	uint32_t l_elapsed_u32 = 0U;
+	uint32_t l_completedTicks_u32 = 0U;
+	uint32_t l_sleptMs_u32 = 0U;
+	uint32_t l_primask_u32 = 0U;
+
+	/* Something is already due, do not sleep at all */
+	if (0U == idleMs)
+	{
+		return 0U;
+	}
+
+	/* Too short to pay for reprogramming SysTick, sleep with the tick running */
+	if ((idleMs < TICKLESS_MIN_IDLE_MS) || (l_idleTicks_u32 < 2U) || (0U == s_cyclesPerTick))
+	{
+		HAL_PWR_EnterSLEEPMode(PWR_MAINREGULATOR_ON, PWR_SLEEPENTRY_WFI);
+		return 0U;
+	}
+
+	if (l_idleTicks_u32 > s_maxIdleTicks)
+	{
+		l_idleTicks_u32 = s_maxIdleTicks;
+	}
+
+	/* WFI still wakes on a pending interrupt while PRIMASK is set, the
+	 * handlers only run once uwTick has been corrected below. A caller that
+	 * already masked interrupts, e.g. TaskSched_idle(), stays masked */
+	l_primask_u32 = __get_PRIMASK();
+	__disable_irq();
+
+	/* Stop the counter without reading CTRL, VAL keeps the rest of this tick */
+	SysTick->CTRL = s_ctrlStopped;
+
+	if ((SCB->ICSR & SCB_ICSR_PENDSTSET_Msk) != 0U)
+	{
+		/* A tick fired before the counter stopped, serve it first */
+		SysTick->CTRL = s_ctrlStopped | SysTick_CTRL_ENABLE_Msk;
+		__set_PRIMASK(l_primask_u32);
+		return 0U;
+	}
+
+	/* One-shot period: remainder of this tick plus the whole idle ticks */
+	l_reload_u32 = SysTick->VAL + (s_cyclesPerTick * (l_idleTicks_u32 - 1U));
+	if (l_reload_u32 > TICKLESS_STOPPED_CYCLES)
+	{
+		l_reload_u32 -= TICKLESS_STOPPED_CYCLES;
+	}
+
+	SysTick->LOAD = l_reload_u32;
+	SysTick->VAL = 0U;
+	SysTick->CTRL = s_ctrlStopped | SysTick_CTRL_ENABLE_Msk;
+
+	HAL_PWR_EnterSLEEPMode(PWR_MAINREGULATOR_ON, PWR_SLEEPENTRY_WFI);
+
+	/* Stop again, COUNTFLAG survives a write to CTRL */
+	SysTick->CTRL = s_ctrlStopped;
+
+	if ((SysTick->CTRL & SysTick_CTRL_COUNTFLAG_Msk) != 0U)
+	{
+		/* Deadline reached: the pending SysTick interrupt adds the last tick,
+		 * the counter already runs into the following tick */
+		l_elapsed_u32 = l_reload_u32 - SysTick->VAL;
+		if (l_elapsed_u32 >= s_cyclesPerTick)
+		{
+			l_elapsed_u32 = 0U;
+		}
+
+		SysTick->LOAD = (s_cyclesPerTick - 1U) - l_elapsed_u32;
+		l_completedTicks_u32 = l_idleTicks_u32 - 1U;
+		l_sleptMs_u32 = l_idleTicks_u32 * l_tickMs_u32;
+	}
+	else
+	{
+		/* Woken early by another interrupt, count whole ticks and carry the
+		 * partial one into the next period */
+		l_elapsed_u32 = (l_idleTicks_u32 * s_cyclesPerTick) - SysTick->VAL;
+		l_completedTicks_u32 = l_elapsed_u32 / s_cyclesPerTick;
+
+		SysTick->LOAD = ((l_completedTicks_u32 + 1U) * s_cyclesPerTick) - l_elapsed_u32;
+		l_sleptMs_u32 = l_completedTicks_u32 * l_tickMs_u32;
+	}
+
+	/* Restart from the shortened period, the regular reload applies after it */
+	SysTick->VAL = 0U;
+	SysTick->CTRL = s_ctrlStopped | SysTick_CTRL_ENABLE_Msk;
+	SysTick->LOAD = s_cyclesPerTick - 1U;
+
+	uwTick += l_completedTicks_u32 * l_tickMs_u32;
+
+	__set_PRIMASK(l_primask_u32);
+
+	return l_sleptMs_u32;
+}
+
+/**
+  * @brief  Sleeping replacement of the busy-waiting __weak HAL_Delay()
+  * @note   Same minimum wait as the HAL version, the core sleeps between
+  *         ticks or across the whole delay once TicklessIdle_init() ran
+  * @param  Delay: delay in ms
+  * @retval None
+  */
+void HAL_Delay(uint32_t Delay)
+{
+	uint32_t l_start_u32 = HAL_GetTick();
+	uint32_t l_wait_u32 = Delay;
+	uint32_t l_elapsed_u32 = 0U;
+
+	/* Add a freq to guarantee minimum wait */
+	if (l_wait_u32 < HAL_MAX_DELAY)
+	{
+		l_wait_u32 += (uint32_t)HAL_GetTickFreq();
+	}
+
+	l_elapsed_u32 = HAL_GetTick() - l_start_u32;
+	while (l_elapsed_u32 < l_wait_u32)
+	{
+		(void)TicklessIdle_sleep(l_wait_u32 - l_elapsed_u32);
+		l_elapsed_u32 = HAL_GetTick() - l_start_u32;
+	}
+}
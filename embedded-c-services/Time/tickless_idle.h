@@ -0,0 +1,62 @@
+/*****************************************************************************
+ * @file      tickless_idle.h
+ * @author    Jet Station
+ * @brief     Tickless idle time base built on the HAL SysTick
+ * @date      [2026-10-17]
+ *
+ * Contact:
+ *   @website   https://jet-station.github.io/
+ *   @github    https://github.com/jet-station
+ *   @linkedin  https://www.linkedin.com/in/thien-ai-ho/
+ *   @email     thienaiho95@gmail.com
+ *
+ * @copyright  Copyright (c) 2026 Jet Station. All rights reserved.
+ *****************************************************************************/
+
+#ifndef __TICKLESS_IDLE_H__
+#define __TICKLESS_IDLE_H__
+
+#include <stdint.h>
+
+/* Shortest idle period (in ms) worth stopping the periodic tick for */
+#ifndef TICKLESS_MIN_IDLE_MS
+#define TICKLESS_MIN_IDLE_MS (2U)
+#endif
+
+/* SysTick cycles spent between stopping and restarting the counter */
+#ifndef TICKLESS_STOPPED_CYCLES
+#define TICKLESS_STOPPED_CYCLES (45U)
+#endif
+
+/* Value for "no deadline pending", the idle period is then clamped to the
+ * longest one-shot period SysTick can cover */
+#define TICKLESS_WAIT_FOREVER (0xFFFFFFFFU)
+
+/**
+  * @brief  Capture the SysTick reload set up by HAL_InitTick()
+  * @note   Call after HAL_Init() and after every clock change
+  * @param  None
+  * @retval None
+  */
+void TicklessIdle_init(void);
+
+/**
+  * @brief  Sleep until the next deadline or any interrupt
+  * @note   Programs SysTick as a one-shot timer for idleMs, enters sleep
+  *         mode and adds the elapsed ticks back to uwTick on wakeup
+  * @param  idleMs: time until the next due deadline in ms
+  * @retval Number of milliseconds actually slept
+  */
+uint32_t TicklessIdle_sleep(uint32_t idleMs);
+
+/**
+  * @brief  Longest idle period a single sleep can cover
+  * @param  None
+  * @retval Period in ms
+  */
+uint32_t TicklessIdle_getMaxIdleMs(void);
+
+/* HAL_Delay() is overridden by this module: it sleeps instead of polling
+ * HAL_GetTick(), linking tickless_idle.c is enough to enable it */
+
+#endif
@@ -0,0 +1,344 @@
+/*****************************************************************************
+ * @file      timer_wheel.c
+ * @author    Jet Station
+ * @brief     Hierarchical timer wheel for software timers
+ * @date      [2026-10-17]
+ *
+ * Contact:
+ *   @website   https://jet-station.github.io/
+ *   @github    https://github.com/jet-station
+ *   @linkedin  https://www.linkedin.com/in/thien-ai-ho/
+ *   @email     thienaiho95@gmail.com
+ *
+ * @copyright  Copyright (c) 2026 Jet Station. All rights reserved.
+ *****************************************************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "stm32f1xx.h"
+#include "timer_wheel.h"
+
+#define TIMER_WHEEL_SLOT_MASK (TIMER_WHEEL_SLOTS - 1U)
+
+/* Level l holds the timers whose expiry differs from the wheel time in bits
+ * [5*l, 5*l+4] at most, a slot covers 32^l ticks */
+static TimerWheel_Timer_st *s_slots[TIMER_WHEEL_LEVELS][TIMER_WHEEL_SLOTS];
+
+/* One bit per non-empty slot, used to skip idle ticks */
+static uint32_t s_occupied_u32[TIMER_WHEEL_LEVELS];
+
+/* Last processed tick */
+static uint32_t s_now_u32 = 0U;
+
+/**
+  * @brief  Index of the lowest set bit, x must not be 0
+  * @param  x: bitmap
+  * @retval uint32_t
+  */
+static inline uint32_t TimerWheel_lowestBit(uint32_t x)
+{
+	return __CLZ(__RBIT(x));
+}
+
+/**
+  * @brief  Insert a timer into the slot matching its expiry
+  * @param  timer: stopped timer with a valid expiry
+  * @retval None
+  */
+static void TimerWheel_link(TimerWheel_Timer_st *timer)
+{
+	uint32_t l_diff_u32 = timer->expiry ^ s_now_u32;
+	uint32_t l_level_u32 = 0U;
+	uint32_t l_slot_u32 = 0U;
+
+	/* Level of the highest bit in which expiry and wheel time differ */
+	if (0U != l_diff_u32)
+	{
+		l_level_u32 = (31U - __CLZ(l_diff_u32)) / TIMER_WHEEL_SLOT_BITS;
+	}
+	if (l_level_u32 >= TIMER_WHEEL_LEVELS)
+	{
+		l_level_u32 = TIMER_WHEEL_LEVELS - 1U;
+	}
+	l_slot_u32 = (timer->expiry >> (l_level_u32 * TIMER_WHEEL_SLOT_BITS)) & TIMER_WHEEL_SLOT_MASK;
+
+	timer->level = (uint8_t)l_level_u32;
+	timer->slot = (uint8_t)l_slot_u32;
+	timer->next = s_slots[l_level_u32][l_slot_u32];
+	if (NULL != timer->next)
+	{
+		timer->next->pprev = &timer->next;
+	}
+	timer->pprev = &s_slots[l_level_u32][l_slot_u32];
+	s_slots[l_level_u32][l_slot_u32] = timer;
+	s_occupied_u32[l_level_u32] |= (1UL << l_slot_u32);
+}
+
+/**
+  * @brief  Remove a running timer from its slot
+  * @param  timer: running timer
+  * @retval None
+  */
+static void TimerWheel_unlink(TimerWheel_Timer_st *timer)
+{
+	*timer->pprev = timer->next;
+	if (NULL != timer->next)
+	{
+		timer->next->pprev = timer->pprev;
+	}
+	if (NULL == s_slots[timer->level][timer->slot])
+	{
+		s_occupied_u32[timer->level] &= ~(1UL << timer->slot);
+	}
+	timer->next = NULL;
+	timer->pprev = NULL;
+}
+
+/**
+  * @brief  First occupied slot ahead of the wheel time on one level
+  * @param  level: wheel level
+  * @param  slot: found slot
+  * @retval Ticks from the wheel time to the start of the slot, 0 if none
+  */
+static uint32_t TimerWheel_findSlot(uint32_t level, uint32_t *slot)
+{
+	uint32_t l_shift_u32 = level * TIMER_WHEEL_SLOT_BITS;
+	uint32_t l_pos_u32 = (s_now_u32 >> l_shift_u32) & TIMER_WHEEL_SLOT_MASK;
+	uint32_t l_ahead_u32 = s_occupied_u32[level] & ~((2UL << l_pos_u32) - 1UL);
+	uint32_t l_steps_u32 = 0U;
+
+	if (0U != l_ahead_u32)
+	{
+		*slot = TimerWheel_lowestBit(l_ahead_u32);
+		l_steps_u32 = *slot - l_pos_u32;
+	}
+	else if (((TIMER_WHEEL_LEVELS - 1U) == level) && (0U != s_occupied_u32[level]))
+	{
+		/* Only the top level wraps around to the next revolution */
+		*slot = TimerWheel_lowestBit(s_occupied_u32[level]);
+		l_steps_u32 = (*slot + TIMER_WHEEL_SLOTS) - l_pos_u32;
+	}
+	else
+	{
+		return 0U;
+	}
+
+	return (((s_now_u32 >> l_shift_u32) + l_steps_u32) << l_shift_u32) - s_now_u32;
+}
+
+/**
+  * @brief  Ticks from the wheel time to the next cascade or expiry
+  * @param  None
+  * @retval TIMER_WHEEL_NO_EXPIRY if the wheel is empty
+  */
+static uint32_t TimerWheel_nextEvent(void)
+{
+	uint32_t l_min_u32 = TIMER_WHEEL_NO_EXPIRY;
+	uint32_t l_dist_u32 = 0U;
+	uint32_t l_slot_u32 = 0U;
+	uint32_t l_level_u32 = 0U;
+
+	for (l_level_u32 = 0U; l_level_u32 < TIMER_WHEEL_LEVELS; l_level_u32++)
+	{
+		l_dist_u32 = TimerWheel_findSlot(l_level_u32, &l_slot_u32);
+		if ((0U != l_dist_u32) && (l_dist_u32 < l_min_u32))
+		{
+			l_min_u32 = l_dist_u32;
+		}
+	}
+
+	return l_min_u32;
+}
+
+/**
+  * @brief  Advance the wheel by one tick
+  * @param  None
+  * @retval None
+  */
+static void TimerWheel_step(void)
+{
+	TimerWheel_Timer_st *l_timer_pst = NULL;
+	TimerWheel_Timer_st *l_next_pst = NULL;
+	TimerWheel_Timer_st **l_slot_ppst = NULL;
+	uint32_t l_level_u32 = 0U;
+	uint32_t l_shift_u32 = 0U;
+	uint32_t l_slot_u32 = 0U;
+
+	s_now_u32++;
+
+	/* Cascade from the top so that timers moved down one level are picked
+	 * up by the cascade of the level below in the same tick */
+	for (l_level_u32 = TIMER_WHEEL_LEVELS - 1U; l_level_u32 > 0U; l_level_u32--)
+	{
+		l_shift_u32 = l_level_u32 * TIMER_WHEEL_SLOT_BITS;
+		if (0U == (s_now_u32 & ((1UL << l_shift_u32) - 1UL)))
+		{
+			l_slot_u32 = (s_now_u32 >> l_shift_u32) & TIMER_WHEEL_SLOT_MASK;
+			l_timer_pst = s_slots[l_level_u32][l_slot_u32];
+			s_slots[l_level_u32][l_slot_u32] = NULL;
+			s_occupied_u32[l_level_u32] &= ~(1UL << l_slot_u32);
+
+			while (NULL != l_timer_pst)
+			{
+				l_next_pst = l_timer_pst->next;
+				TimerWheel_link(l_timer_pst);
+				l_timer_pst = l_next_pst;
+			}
+		}
+	}
+
+	/* Expire one timer at a time, a callback may cancel any other timer */
+	l_slot_ppst = &s_slots[0][s_now_u32 & TIMER_WHEEL_SLOT_MASK];
+	while (NULL != *l_slot_ppst)
+	{
+		l_timer_pst = *l_slot_ppst;
+		TimerWheel_unlink(l_timer_pst);
+
+		/* Re-arm before the callback so that it may cancel its own timer */
+		if (0U != l_timer_pst->period)
+		{
+			l_timer_pst->expiry += l_timer_pst->period;
+			TimerWheel_link(l_timer_pst);
+		}
+
+		l_timer_pst->callback(l_timer_pst->ctx);
+	}
+}
+
+/**
+  * @brief  Reset the wheel and set its current time
+  * @param  now: current tick
+  * @retval None
+  */
+void TimerWheel_init(uint32_t now)
+{
+	uint32_t l_level_u32 = 0U;
+	uint32_t l_slot_u32 = 0U;
+
+	for (l_level_u32 = 0U; l_level_u32 < TIMER_WHEEL_LEVELS; l_level_u32++)
+	{
+		for (l_slot_u32 = 0U; l_slot_u32 < TIMER_WHEEL_SLOTS; l_slot_u32++)
+		{
+			s_slots[l_level_u32][l_slot_u32] = NULL;
+		}
+		s_occupied_u32[l_level_u32] = 0U;
+	}
+	s_now_u32 = now;
+}
+
+/**
+  * @brief  Start or restart a timer, O(1)
+  * @note   The delay counts from the last processed tick
+  * @param  timer: statically allocated timer node
+  * @param  delay: ticks until the first expiry
+  * @param  period: reload period in ticks, 0 for a one-shot timer
+  * @param  callback: function called on expiry
+  * @param  ctx: argument passed to the callback
+  * @retval true if the timer was started
+  */
+bool TimerWheel_start(TimerWheel_Timer_st *timer, uint32_t delay, uint32_t period,
+                      TimerWheel_Callback callback, void *ctx)
+{
+	if ((NULL == timer) || (NULL == callback) || (0U == delay) ||
+	    (delay > TIMER_WHEEL_MAX_TICKS) || (period > TIMER_WHEEL_MAX_TICKS))
+	{
+		return false;
+	}
+
+	TimerWheel_cancel(timer);
+
+	timer->expiry = s_now_u32 + delay;
+	timer->period = period;
+	timer->callback = callback;
+	timer->ctx = ctx;
+	TimerWheel_link(timer);
+
+	return true;
+}
+
+/**
+  * @brief  Stop a timer, O(1)
+  * @param  timer: timer node
+  * @retval None
+  */
+void TimerWheel_cancel(TimerWheel_Timer_st *timer)
+{
+	if ((NULL != timer) && (NULL != timer->pprev))
+	{
+		TimerWheel_unlink(timer);
+	}
+}
+
+/**
+  * @brief  Check if a timer is running
+  * @param  timer: timer node
+  * @retval bool
+  */
+bool TimerWheel_isActive(const TimerWheel_Timer_st *timer)
+{
+	return (NULL != timer->pprev);
+}
+
+/**
+  * @brief  Advance the wheel to now and run the callbacks of expired timers
+  * @param  now: current tick
+  * @retval None
+  */
+void TimerWheel_process(uint32_t now)
+{
+	uint32_t l_dist_u32 = 0U;
+
+	while (s_now_u32 != now)
+	{
+		/* Jump over the ticks in which no slot needs attention */
+		l_dist_u32 = TimerWheel_nextEvent();
+		if (l_dist_u32 > (now - s_now_u32))
+		{
+			s_now_u32 = now;
+		}
+		else
+		{
+			s_now_u32 += l_dist_u32 - 1U;
+			TimerWheel_step();
+		}
+	}
+}
+
+/**
+  * @brief  Ticks from now until the earliest running timer expires
+  * @param  now: current tick
+  * @retval 0 if a timer is already due, TIMER_WHEEL_NO_EXPIRY if none runs
+  */
+uint32_t TimerWheel_ticksToNextExpiry(uint32_t now)
+{
+	TimerWheel_Timer_st *l_timer_pst = NULL;
+	uint32_t l_level_u32 = 0U;
+	uint32_t l_slot_u32 = 0U;
+	uint32_t l_min_u32 = TIMER_WHEEL_NO_EXPIRY;
+	uint32_t l_lag_u32 = now - s_now_u32;
+
+	/* The lowest occupied level holds the earliest timer: a level only keeps
+	 * timers inside the current slot of the level above */
+	for (l_level_u32 = 0U; l_level_u32 < TIMER_WHEEL_LEVELS; l_level_u32++)
+	{
+		if (0U != TimerWheel_findSlot(l_level_u32, &l_slot_u32))
+		{
+			for (l_timer_pst = s_slots[l_level_u32][l_slot_u32]; NULL != l_timer_pst; l_timer_pst = l_timer_pst->next)
+			{
+				if ((l_timer_pst->expiry - s_now_u32) < l_min_u32)
+				{
+					l_min_u32 = l_timer_pst->expiry - s_now_u32;
+				}
+			}
+			break;
+		}
+	}
+
+	if (TIMER_WHEEL_NO_EXPIRY == l_min_u32)
+	{
+		return TIMER_WHEEL_NO_EXPIRY;
+	}
+
+	return (l_min_u32 > l_lag_u32) ? (l_min_u32 - l_lag_u32) : 0U;
+}
@@ -0,0 +1,101 @@
+/*****************************************************************************
+ * @file      timer_wheel.h
+ * @author    Jet Station
+ * @brief     Hierarchical timer wheel for software timers
+ * @date      [2026-10-17]
+ *
+ * Contact:
+ *   @website   https://jet-station.github.io/
+ *   @github    https://github.com/jet-station
+ *   @linkedin  https://www.linkedin.com/in/thien-ai-ho/
+ *   @email     thienaiho95@gmail.com
+ *
+ * @copyright  Copyright (c) 2026 Jet Station. All rights reserved.
+ *****************************************************************************/
+
+#ifndef __TIMER_WHEEL_H__
+#define __TIMER_WHEEL_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Number of wheel levels, each level has 32 slots and covers 32 times the
+ * range of the level below: 5 levels reach 2^25 ticks (9.3 h at 1 ms) */
+#ifndef TIMER_WHEEL_LEVELS
+#define TIMER_WHEEL_LEVELS (5U)
+#endif
+
+/* Slots per level, fixed so that a level's occupancy fits one 32-bit word */
+#define TIMER_WHEEL_SLOT_BITS (5U)
+#define TIMER_WHEEL_SLOTS (1U << TIMER_WHEEL_SLOT_BITS)
+
+/* Longest delay accepted by TimerWheel_start() */
+#define TIMER_WHEEL_MAX_TICKS ((1UL << (TIMER_WHEEL_SLOT_BITS * TIMER_WHEEL_LEVELS)) - 1UL)
+
+/* Returned by TimerWheel_ticksToNextExpiry() when no timer is running */
+#define TIMER_WHEEL_NO_EXPIRY (0xFFFFFFFFU)
+
+typedef void (*TimerWheel_Callback)(void *ctx);
+
+/* Timer node, allocated statically by the user of the timer */
+typedef struct TimerWheel_Timer_st_tag {
+	struct TimerWheel_Timer_st_tag *next; /* Next timer in the same slot */
+	struct TimerWheel_Timer_st_tag **pprev; /* Link pointing at this timer, NULL when stopped */
+	uint32_t expiry; /* Absolute expiry tick */
+	uint32_t period; /* Reload period in ticks, 0 for a one-shot timer */
+	TimerWheel_Callback callback;
+	void *ctx;
+	uint8_t level;
+	uint8_t slot;
+} TimerWheel_Timer_st;
+
+/**
+  * @brief  Reset the wheel and set its current time
+  * @param  now: current tick, e.g. HAL_GetTick()
+  * @retval None
+  */
+void TimerWheel_init(uint32_t now);
+
+/**
+  * @brief  Start or restart a timer, O(1)
+  * @param  timer: statically allocated timer node
+  * @param  delay: ticks until the first expiry, 1..TIMER_WHEEL_MAX_TICKS
+  * @param  period: reload period in ticks, 0 for a one-shot timer
+  * @param  callback: function called from TimerWheel_process() on expiry
+  * @param  ctx: argument passed to the callback
+  * @retval true if the timer was started
+  */
+bool TimerWheel_start(TimerWheel_Timer_st *timer, uint32_t delay, uint32_t period,
+                      TimerWheel_Callback callback, void *ctx);
+
+/**
+  * @brief  Stop a timer, O(1), does nothing if it is not running
+  * @param  timer: timer node
+  * @retval None
+  */
+void TimerWheel_cancel(TimerWheel_Timer_st *timer);
+
+/**
+  * @brief  Check if a timer is running
+  * @param  timer: timer node
+  * @retval bool
+  */
+bool TimerWheel_isActive(const TimerWheel_Timer_st *timer);
+
+/**
+  * @brief  Advance the wheel to now and run the callbacks of expired timers
+  * @note   Idle ticks are skipped using the slot occupancy bitmaps, the cost
+  *         depends on the number of expired (and cascaded) timers only
+  * @param  now: current tick
+  * @retval None
+  */
+void TimerWheel_process(uint32_t now);
+
+/**
+  * @brief  Ticks from now until the earliest running timer expires
+  * @param  now: current tick
+  * @retval 0 if a timer is already due, TIMER_WHEEL_NO_EXPIRY if none runs
+  */
+uint32_t TimerWheel_ticksToNextExpiry(uint32_t now);
+
+#endif
@@ -0,0 +1,74 @@
+#!/usr/bin/env python3
+"""
+@file      bench_dump.py
+@author    Jet Station
+@brief     Host dumper of the micro-benchmark results g_benchResults
+@date      [2026-10-17]
+
+Reads the RAM table of Measure/micro_bench.c and prints one line per case
+with min/median/max/mean/stddev in cycles and in ns. The table is found
+through the symbol g_benchResults, see ram_table.py for the sources
+(--bin, --hex/--map, --pyocd/--map, --save-cmd/--map).
+
+Copyright (c) 2026 Jet Station. All rights reserved.
+"""
+
+import argparse
+import struct
+import sys
+
+import ram_table
+
+SYMBOL = "g_benchResults"
+MAGIC = 0x48434E42
+HEADER = struct.Struct("<IHHHHIII")
+RESULT_FIXED = struct.Struct("<IIIIII")
+
+
+def table_size(header):
+    """Size of the table described by a header."""
+    _, _, max_cases, _, name_len, _, _, _ = HEADER.unpack_from(header, 0)
+    return HEADER.size + max_cases * (name_len + RESULT_FIXED.size)
+
+
+def decode(blob):
+    """Header fields and (name, n, min, median, max, mean, stddev) per case."""
+    _, version, _, count, name_len, cycles_per_us, baseline, skipped = HEADER.unpack_from(blob, 0)
+    cases = []
+    offset = HEADER.size
+    for _ in range(count):
+        name = blob[offset:offset + name_len].split(b"\0")[0].decode("ascii", "replace")
+        n, vmin, median, vmax, mean, stddev = RESULT_FIXED.unpack_from(blob, offset + name_len)
+        offset += name_len + RESULT_FIXED.size
+        cases.append((name, n, vmin, median, vmax, mean, stddev / 100.0))
+    return version, cycles_per_us, baseline, skipped, cases
+
+
+def print_table(blob):
+    version, cycles_per_us, baseline, skipped, cases = decode(blob)
+    ns_per_cycle = 1000.0 / max(cycles_per_us, 1)
+    print("micro-benchmark v%d, %d cycles/us, baseline %d cycles subtracted" %
+          (version, cycles_per_us, baseline))
+    if skipped:
+        print("warning: %d cases skipped, the table holds %d, raise BENCH_MAX_CASES" %
+              (skipped, len(cases)))
+    print("%-16s %6s %8s %8s %8s %8s %8s %10s" %
+          ("case", "n", "min", "median", "max", "mean", "stddev", "median ns"))
+    for name, n, vmin, median, vmax, mean, stddev in cases:
+        print("%-16s %6d %8d %8d %8d %8d %8.2f %10.1f" %
+              (name, n, vmin, median, vmax, mean, stddev, median * ns_per_cycle))
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Print the micro-benchmark table " + SYMBOL)
+    ram_table.add_arguments(parser)
+    args = parser.parse_args()
+
+    blob = ram_table.load(parser, args, SYMBOL, MAGIC, HEADER.size, table_size)
+    if blob is not None:
+        print_table(blob)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,113 @@
+#!/usr/bin/env python3
+"""
+@file      heap_dump.py
+@author    Jet Station
+@brief     Host dumper of the heap monitor table g_heapMon
+@date      [2026-10-17]
+
+Reads the RAM table of Measure/heap_monitor.c and prints the current and
+peak heap, the largest free block, the newlib heap end, the size
+histogram, the call sites sorted by live bytes and the live blocks. With
+the linker map the call sites are shown as functions.
+
+The table is found through the symbol g_heapMon, see ram_table.py for the
+sources (--bin, --hex/--map, --pyocd/--map, --save-cmd/--map).
+
+Copyright (c) 2026 Jet Station. All rights reserved.
+"""
+
+import argparse
+import struct
+import sys
+
+import ram_table
+
+SYMBOL = "g_heapMon"
+MAGIC = 0x4E4F4D48
+HEADER = struct.Struct("<IHHHH")
+TOTALS = struct.Struct("<11I")
+SITE = struct.Struct("<IIIII")
+BLOCK = struct.Struct("<III")
+
+
+def table_size(header):
+    """Size of the table described by a header."""
+    _, _, sites, blocks, bins = HEADER.unpack_from(header, 0)
+    return HEADER.size + TOTALS.size + 4 * bins + sites * SITE.size + blocks * BLOCK.size
+
+
+def decode(blob):
+    """Header fields, totals, histogram, sites and live blocks."""
+    _, version, sites, blocks, bins = HEADER.unpack_from(blob, 0)
+    offset = HEADER.size
+    totals = TOTALS.unpack_from(blob, offset)
+    offset += TOTALS.size
+    histogram = struct.unpack_from("<%dI" % bins, blob, offset)
+    offset += 4 * bins
+    site_list = []
+    for _ in range(sites):
+        site_list.append(SITE.unpack_from(blob, offset))
+        offset += SITE.size
+    block_list = []
+    for _ in range(blocks):
+        block = BLOCK.unpack_from(blob, offset)
+        offset += BLOCK.size
+        if block[0]:
+            block_list.append(block)
+    return version, totals, histogram, site_list, block_list
+
+
+def print_table(blob, symbols):
+    version, totals, histogram, sites, blocks = decode(blob)
+    current, peak, allocs, frees, failures, untracked, largest, top, top_peak, space, sbrk_failures = totals
+
+    def where(addr):
+        if addr == 0:
+            return "(other sites)"
+        # The return address points after the call, step back into it
+        return ram_table.symbolize(symbols, addr - 2) if symbols else "0x%08X" % addr
+
+    print("heap monitor v%d" % version)
+    print("  live %d bytes, peak %d bytes, %d allocs, %d frees, %d failed" %
+          (current, peak, allocs, frees, failures))
+    print("  largest free block %d bytes (from the last HeapMon_update())" % largest)
+    if top:
+        print("  newlib heap end 0x%08X, peak 0x%08X, %d bytes left to the stack, %d refused" %
+              (top, top_peak, space, sbrk_failures))
+    if untracked:
+        print("  %d live blocks beyond HEAP_MON_BLOCKS, their frees are not attributed" % untracked)
+
+    print("")
+    print("size histogram")
+    for index, count in enumerate(histogram):
+        if count == 0:
+            continue
+        label = ("> %d" % (4 << index)) if index == len(histogram) - 1 else ("<= %d" % (8 << index))
+        print("  %-8s %8d" % (label, count))
+
+    print("")
+    print("%-32s %8s %8s %10s %10s" % ("call site", "allocs", "frees", "live B", "peak B"))
+    used = [site for site in sites if site[1] or site[0]]
+    for addr, site_allocs, site_frees, live, site_peak in sorted(used, key=lambda site: -site[3]):
+        print("%-32s %8d %8d %10d %10d" % (where(addr), site_allocs, site_frees, live, site_peak))
+
+    if blocks:
+        print("")
+        print("live blocks")
+        for ptr, size, site in sorted(blocks):
+            print("  0x%08X %8d  %s" % (ptr, size, where(site)))
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Print the heap monitor table " + SYMBOL)
+    ram_table.add_arguments(parser)
+    args = parser.parse_args()
+
+    blob = ram_table.load(parser, args, SYMBOL, MAGIC, HEADER.size, table_size)
+    if blob is not None:
+        print_table(blob, ram_table.code_symbols(args.map) if args.map else None)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,109 @@
+#!/usr/bin/env python3
+"""
+@file      irqlat_dump.py
+@author    Jet Station
+@brief     Host dumper of the interrupt latency table g_irqLat
+@date      [2026-10-17]
+
+Reads the RAM table of Measure/irq_latency.c and prints, per background
+load, the entry, tail-chaining and preemption latency: min, mean, p99 and
+max in cycles and the max in us. --hist adds the histograms.
+
+The table is found through the symbol g_irqLat, see ram_table.py for the
+sources (--bin, --hex/--map, --pyocd/--map, --save-cmd/--map).
+
+Copyright (c) 2026 Jet Station. All rights reserved.
+"""
+
+import argparse
+import struct
+import sys
+
+import ram_table
+
+SYMBOL = "g_irqLat"
+MAGIC = 0x54414C49
+HEADER = struct.Struct("<IHHHHIII")
+DIST_FIXED = struct.Struct("<IIIII")
+LOADS = ("none", "dma", "flash")
+KINDS = ("entry", "tail-chain", "preempt")
+
+
+def dist_size(bins):
+    """Size of one distribution, padded to the 32-bit alignment of the struct."""
+    return (DIST_FIXED.size + 2 * bins + 3) & ~3
+
+
+def table_size(header):
+    """Size of the table described by a header."""
+    _, _, loads, kinds, bins, _, _, _ = HEADER.unpack_from(header, 0)
+    return HEADER.size + loads * kinds * dist_size(bins)
+
+
+def decode(blob):
+    """Header fields and {(load, kind): (samples, bin, min, max, sum, histogram)}."""
+    _, version, loads, kinds, bins, cycles_per_us, trigger, timeouts = HEADER.unpack_from(blob, 0)
+    dists = {}
+    offset = HEADER.size
+    for load in range(loads):
+        for kind in range(kinds):
+            fields = DIST_FIXED.unpack_from(blob, offset)
+            histogram = struct.unpack_from("<%dH" % bins, blob, offset + DIST_FIXED.size)
+            offset += dist_size(bins)
+            dists[(load, kind)] = fields + (histogram,)
+    return version, max(cycles_per_us, 1), trigger, timeouts, dists
+
+
+def percentile(histogram, width, fraction):
+    """Upper edge in cycles of the bin holding the given fraction of samples,
+    None in the open last bin."""
+    total = sum(histogram)
+    running = 0
+    for index, count in enumerate(histogram[:-1]):
+        running += count
+        if running >= fraction * total:
+            return (index + 1) * width
+    return None
+
+
+def name(names, index):
+    return names[index] if index < len(names) else str(index)
+
+
+def print_table(blob, show_hist):
+    version, cpu, trigger, timeouts, dists = decode(blob)
+    print("interrupt latency v%d, %d cycles/us, trigger overhead %d cycles subtracted, %d timeouts" %
+          (version, cpu, trigger, timeouts))
+    print("%-6s %-10s %6s %6s %8s %7s %6s %9s" % ("load", "response", "n", "min", "mean", "p99 <=", "max", "max us"))
+    for (load, kind), (samples, width, vmin, vmax, total, histogram) in sorted(dists.items()):
+        if samples == 0:
+            continue
+        # Bin edges are coarser than the extremes, the last bin is open
+        p99 = percentile(histogram, width, 0.99)
+        p99 = vmax if p99 is None else max(min(p99, vmax), vmin)
+        print("%-6s %-10s %6d %6d %8.1f %7d %6d %9.2f" %
+              (name(LOADS, load), name(KINDS, kind), samples, vmin, float(total) / samples, p99, vmax,
+               float(vmax) / cpu))
+        if show_hist:
+            peak = max(max(histogram), 1)
+            used = [index for index, count in enumerate(histogram) if count]
+            for index in range(used[0], used[-1] + 1):
+                label = (">= %5d" % (index * width)) if index == len(histogram) - 1 else ("%8d" % (index * width))
+                bar = "#" * int(round(40.0 * histogram[index] / peak))
+                print(("    %s cycles %8d %s" % (label, histogram[index], bar)).rstrip())
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Print the interrupt latency table " + SYMBOL)
+    ram_table.add_arguments(parser)
+    parser.add_argument("--hist", action="store_true", help="print the histograms")
+    args = parser.parse_args()
+
+    blob = ram_table.load(parser, args, SYMBOL, MAGIC, HEADER.size, table_size)
+    if blob is not None:
+        print_table(blob, args.hist)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
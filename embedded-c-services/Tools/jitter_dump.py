@@ -0,0 +1,83 @@
+#!/usr/bin/env python3
+"""
+@file      jitter_dump.py
+@author    Jet Station
+@brief     Host dumper of the jitter monitor table g_jitterMon
+@date      [2026-10-17]
+
+Reads the RAM table of Measure/jitter_monitor.c and prints, per channel,
+the activation count, deadline misses, jitter range and histogram.
+
+The table is found through the symbol g_jitterMon, see ram_table.py for
+the sources (--bin, --hex/--map, --pyocd/--map, --save-cmd/--map).
+
+Copyright (c) 2026 Jet Station. All rights reserved.
+"""
+
+import argparse
+import struct
+import sys
+
+import ram_table
+
+SYMBOL = "g_jitterMon"
+MAGIC = 0x4E4F4D4A
+HEADER = struct.Struct("<IHHHHI")
+CHANNEL_FIXED = struct.Struct("<IIIIIIiiI")
+
+
+def decode(blob):
+    """Header and channel list of a raw table."""
+    _, version, channels, bins, _, cycles_per_us = HEADER.unpack_from(blob, 0)
+    result = []
+    offset = HEADER.size
+    for index in range(channels):
+        fields = CHANNEL_FIXED.unpack_from(blob, offset)
+        histogram = struct.unpack_from("<%dI" % bins, blob, offset + CHANNEL_FIXED.size)
+        offset += CHANNEL_FIXED.size + 4 * bins
+        result.append((index, fields, histogram))
+    return version, bins, max(cycles_per_us, 1), result
+
+
+def table_size(blob_header):
+    """Size of the table described by a header."""
+    _, _, channels, bins, _, _ = HEADER.unpack_from(blob_header, 0)
+    return HEADER.size + channels * (CHANNEL_FIXED.size + 4 * bins)
+
+
+def print_table(blob):
+    version, bins, cpu, channels = decode(blob)
+    print("jitter monitor v%d, %d cycles/us" % (version, cpu))
+    for index, fields, histogram in channels:
+        period, deadline, width, _, activations, misses, jmin, jmax, response = fields
+        if period == 0:
+            continue
+        print("")
+        print("channel %d: period %.1f us, deadline %.1f us, bin %.2f us" %
+              (index, period / cpu, deadline / cpu, width / cpu))
+        print("  activations %d, deadline misses %d, max response %.2f us from release" %
+              (activations, misses, response / cpu))
+        if jmin <= jmax:
+            print("  release jitter min %+.2f us, max %+.2f us" % (jmin / cpu, jmax / cpu))
+        total = max(sum(histogram), 1)
+        for bin_index, count in enumerate(histogram):
+            low = (bin_index - bins // 2) * width / cpu
+            label = ("< %+8.2f" % (low + width / cpu)) if bin_index == 0 else (
+                (">= %+7.2f" % low) if bin_index == bins - 1 else ("%+9.2f" % low))
+            bar = "#" * int(round(50.0 * count / total))
+            print(("  %s us %10d %s" % (label, count, bar)).rstrip())
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Print the jitter monitor table " + SYMBOL)
+    ram_table.add_arguments(parser)
+    args = parser.parse_args()
+
+    blob = ram_table.load(parser, args, SYMBOL, MAGIC, HEADER.size, table_size)
+    if blob is not None:
+        print_table(blob)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,135 @@
+#!/usr/bin/env python3
+"""
+@file      kernel_report.py
+@author    Jet Station
+@brief     Cycles and code bytes of the c-inline kernel suite per variant and level
+@date      [2026-10-17]
+
+Joins the g_benchResults table of a kernel suite run (cases named
+<kernel>.<mac|inl|call>.<level>, see c-inline-function kernel_suite.c) with
+the code size of the case and kernel functions:
+  --map MAP    Keil map of the Blue Pill build, also locates the table
+  --elf FILE   host or GCC binary, sizes from nm -S (--nm selects the tool)
+
+For every kernel and level it prints the median cycles and the bytes of one
+call site per variant, and the out-of-line body that is paid once. The
+verdict compares inline against call:
+  inline     the inline site is not larger than the call site
+  if hot     inline is faster but every call site costs more flash
+  call       inline saves less than --min-gain percent
+
+The table comes from the usual sources, see ram_table.py
+(--bin, --hex/--map, --pyocd/--map).
+
+Copyright (c) 2026 Jet Station. All rights reserved.
+"""
+
+import argparse
+import re
+import subprocess
+import sys
+
+import bench_dump
+import ram_table
+
+VARIANTS = (("mac", "Macro"), ("inl", "Inline"), ("call", "Call"))
+
+
+def nm_sizes(elf, tool):
+    """Size of every defined function of a binary."""
+    try:
+        output = subprocess.check_output([tool, "-S", "--defined-only", elf], universal_newlines=True)
+    except (OSError, subprocess.CalledProcessError) as error:
+        raise SystemExit("%s failed: %s" % (tool, error))
+    sizes = {}
+    for line in output.splitlines():
+        fields = line.split()
+        if len(fields) == 4 and fields[2] in "tTwW":
+            sizes[fields[3]] = int(fields[1], 16)
+    return sizes
+
+
+def map_sizes(map_path):
+    """Size of every function of a Keil map."""
+    return dict((name, size) for _, size, name in ram_table.code_symbols(map_path))
+
+
+def collect(cases, sizes):
+    """{(kernel, level): {variant: (median, site bytes)}, "body": bytes}."""
+    result = {}
+    for name, _, _, median, _, _, _ in cases:
+        match = re.match(r"^(\w+)\.(mac|inl|call)\.(\w+)$", name)
+        if not match:
+            continue
+        kernel, variant, level = match.groups()
+        symbol = "KernelSuite_%s%s_%s" % (kernel, dict(VARIANTS)[variant], level)
+        entry = result.setdefault((kernel, level), {})
+        entry[variant] = (median, sizes.get(symbol))
+        if "body" not in entry:
+            # The out-of-line kernels have short names, memcpy/memset are copy/fill
+            body = {"memcpy": "copy", "memset": "fill"}.get(kernel, kernel)
+            entry["body"] = sizes.get("KernelSuite_%s_%s" % (body, level))
+    return result
+
+
+def verdict(entry, min_gain):
+    if "inl" not in entry or "call" not in entry:
+        return ""
+    (inl_cycles, inl_bytes), (call_cycles, call_bytes) = entry["inl"], entry["call"]
+    if call_cycles == 0 or 100.0 * (call_cycles - inl_cycles) / call_cycles < min_gain:
+        return "call"
+    if inl_bytes is not None and call_bytes is not None and inl_bytes <= call_bytes:
+        return "inline"
+    return "if hot"
+
+
+def print_report(result, min_gain):
+    level_order = {"O0": 0, "O1": 1, "O2": 2, "O3": 3, "Os": 4, "Oz": 5}
+
+    def text(value):
+        return "-" if value is None else str(value)
+
+    print("%-8s %-5s %9s %9s %9s %7s %7s %7s %7s %8s  %s" %
+          ("kernel", "level", "mac cyc", "inl cyc", "call cyc", "mac B", "inl B", "call B", "body B",
+           "inl gain", "verdict"))
+    for kernel, level in sorted(result, key=lambda key: (key[0], level_order.get(key[1], 9), key[1])):
+        entry = result[(kernel, level)]
+        cycles = [entry.get(variant, (None, None))[0] for variant, _ in VARIANTS]
+        sites = [entry.get(variant, (None, None))[1] for variant, _ in VARIANTS]
+        gain = ""
+        if cycles[1] is not None and cycles[2]:
+            gain = "%+.0f%%" % (100.0 * (cycles[2] - cycles[1]) / cycles[2])
+        print("%-8s %-5s %9s %9s %9s %7s %7s %7s %7s %8s  %s" %
+              ((kernel, level) + tuple(text(value) for value in cycles + sites + [entry.get("body")]) +
+               (gain, verdict(entry, min_gain))))
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Cycles and code bytes of the kernel suite")
+    ram_table.add_arguments(parser)
+    parser.add_argument("--elf", help="binary for nm -S code sizes instead of the map")
+    parser.add_argument("--nm", default="nm", help="nm of the toolchain (default nm)")
+    parser.add_argument("--min-gain", type=float, default=5.0,
+                        help="inline gain in %% below which the call is kept (default 5)")
+    args = parser.parse_args()
+
+    blob = ram_table.load(parser, args, bench_dump.SYMBOL, bench_dump.MAGIC, bench_dump.HEADER.size,
+                          bench_dump.table_size)
+    if blob is None:
+        return 0
+    if args.elf:
+        sizes = nm_sizes(args.elf, args.nm)
+    elif args.map:
+        sizes = map_sizes(args.map)
+    else:
+        parser.error("--elf or --map is required for the code sizes")
+
+    _, cycles_per_us, baseline, _, cases = bench_dump.decode(blob)
+    print("kernel suite, %d cycles/us, baseline %d cycles subtracted, median cycles per call" %
+          (cycles_per_us, baseline))
+    print_report(collect(cases, sizes), args.min_gain)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,136 @@
+#!/usr/bin/env python3
+"""
+@file      prof_dump.py
+@author    Jet Station
+@brief     Symbolize the PC-sampling histogram g_pcProf
+@date      [2026-10-17]
+
+Reads the RAM table of Measure/pc_profiler.c and prints the sample share
+per function (PC histogram) and per calling function (stacked LR
+histogram). A bin that covers several functions is split in proportion to
+the bytes of each function in the bin.
+
+With --listing, the hottest bins are printed with their instructions from
+a fromelf disassembly of the image, e.g. in stm32f103c6-keil:
+    fromelf --text -c -o Listings/demo_stm32f103c6.txt Objects/demo_stm32f103c6.axf
+
+The table is found through the symbol g_pcProf, see ram_table.py for the
+sources (--bin, --hex/--map, --pyocd/--map, --save-cmd/--map). The map is
+also needed with --bin to get function names.
+
+Copyright (c) 2026 Jet Station. All rights reserved.
+"""
+
+import argparse
+import re
+import struct
+import sys
+
+import ram_table
+
+SYMBOL = "g_pcProf"
+MAGIC = 0x46525050
+HEADER = struct.Struct("<IHHHHHHIIII")
+STATES = {0: "stopped", 1: "running", 2: "full, stopped at a saturated bin"}
+
+
+def table_size(header):
+    """Size of the table described by a header."""
+    fields = HEADER.unpack_from(header, 0)
+    return HEADER.size + 2 * (fields[2] + fields[4])
+
+
+def decode(blob):
+    """Header dict plus the PC and caller histograms."""
+    (_, version, bins, bin_shift, caller_bins, caller_shift, period_us,
+     code_base, samples, outside, state) = HEADER.unpack_from(blob, 0)
+    pc = struct.unpack_from("<%dH" % bins, blob, HEADER.size)
+    caller = struct.unpack_from("<%dH" % caller_bins, blob, HEADER.size + 2 * bins)
+    header = {"version": version, "period_us": period_us, "code_base": code_base,
+              "samples": samples, "outside": outside, "state": state}
+    return header, (pc, 1 << bin_shift), (caller, 1 << caller_shift)
+
+
+def by_function(histogram, code_base, symbols):
+    """{name: samples} with every bin split over the functions it covers."""
+    counts, bin_size = histogram
+    result = {}
+    for index, count in enumerate(counts):
+        if count == 0:
+            continue
+        low = code_base + index * bin_size
+        high = low + bin_size
+        covered = 0
+        for start, size, name in symbols:
+            overlap = min(high, start + size) - max(low, start)
+            if overlap > 0:
+                result[name] = result.get(name, 0.0) + count * overlap / float(bin_size)
+                covered += overlap
+        if covered < bin_size:
+            name = "[0x%08X-0x%08X]" % (low, high - 1)
+            result[name] = result.get(name, 0.0) + count * (bin_size - covered) / float(bin_size)
+    return result
+
+
+def read_listing(path):
+    """[(address, text)] of a fromelf --text -c disassembly."""
+    line_re = re.compile(r"^\s*0x([0-9a-fA-F]{8}):\s+(.*)$")
+    lines = []
+    with open(path, "r", errors="replace") as handle:
+        for line in handle:
+            match = line_re.match(line)
+            if match:
+                lines.append((int(match.group(1), 16), match.group(2).rstrip()))
+    return lines
+
+
+def print_shares(title, shares, total, top):
+    print("%-40s %10s %7s" % (title, "samples", "share"))
+    for name, count in sorted(shares.items(), key=lambda item: -item[1])[:top]:
+        print("%-40s %10.1f %6.1f%%" % (name, count, 100.0 * count / max(total, 1)))
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Symbolize the PC-sampling histogram " + SYMBOL)
+    ram_table.add_arguments(parser)
+    parser.add_argument("--listing", help="fromelf --text -c disassembly for the hottest bins")
+    parser.add_argument("--top", type=int, default=20, help="lines per table (default 20)")
+    args = parser.parse_args()
+
+    blob = ram_table.load(parser, args, SYMBOL, MAGIC, HEADER.size, table_size)
+    if blob is None:
+        return 0
+
+    header, pc, caller = decode(blob)
+    symbols = ram_table.code_symbols(args.map) if args.map else []
+    in_code = sum(pc[0])
+
+    print("PC profile v%d, %s, %d samples every ~%d us, %d outside the code range" %
+          (header["version"], STATES.get(header["state"], "?"), header["samples"],
+           header["period_us"], header["outside"]))
+    print()
+    print_shares("function", by_function(pc, header["code_base"], symbols), in_code, args.top)
+    print()
+    print_shares("caller (stacked LR)", by_function(caller, header["code_base"], symbols),
+                 sum(caller[0]), args.top)
+
+    if args.listing:
+        listing = read_listing(args.listing)
+        counts, bin_size = pc
+        hottest = sorted(range(len(counts)), key=lambda index: -counts[index])[:min(args.top, 5)]
+        for index in hottest:
+            if counts[index] == 0:
+                break
+            low = header["code_base"] + index * bin_size
+            print()
+            print("0x%08X-0x%08X  %d samples  %s" %
+                  (low, low + bin_size - 1, counts[index],
+                   ram_table.symbolize(symbols, low) if symbols else ""))
+            for address, text in listing:
+                if low <= address < low + bin_size:
+                    print("    0x%08X: %s" % (address, text))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
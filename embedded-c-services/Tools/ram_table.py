@@ -0,0 +1,144 @@
+"""
+@file      ram_table.py
+@author    Jet Station
+@brief     Read a RAM table of the target through a known symbol
+@date      [2026-10-17]
+
+Shared by the dumpers of the measurement tables (jitter_dump.py, irqlat_dump.py,
+heap_dump.py, bench_dump.py, trace_dump.py). A table starts with a 32-bit magic and its
+size is known from its header, the bytes come from one of:
+  --bin FILE              raw bytes of the table (e.g. written by the host simulation)
+  --hex FILE --map MAP    Intel HEX saved by the Keil debugger (SAVE file.hex start,end),
+                          the address of the symbol comes from the linker map
+  --pyocd --map MAP       live read over SWD with pyOCD
+  --save-cmd --map MAP    print the Keil SAVE command for the table
+
+Copyright (c) 2026 Jet Station. All rights reserved.
+"""
+
+import bisect
+import re
+import struct
+
+
+def find_symbol(map_path, symbol):
+    """Address and size of a data symbol in a Keil (armlink) or GNU ld map."""
+    keil = re.compile(r"^\s+" + re.escape(symbol) + r"\s+(0x[0-9a-fA-F]+)\s+Data\s+(\d+)")
+    gnu = re.compile(r"^\s+(0x[0-9a-fA-F]+)\s+" + re.escape(symbol) + r"\s*$")
+    with open(map_path, "r", errors="replace") as handle:
+        for line in handle:
+            match = keil.match(line)
+            if match:
+                return int(match.group(1), 16), int(match.group(2))
+            match = gnu.match(line)
+            if match:
+                return int(match.group(1), 16), None
+    raise SystemExit("symbol %s not found in %s" % (symbol, map_path))
+
+
+def code_symbols(map_path):
+    """Sorted (start, size, name) of the functions in a Keil (armlink) map.
+
+    Thumb addresses are listed with bit 0 set, start has it cleared.
+    """
+    keil = re.compile(r"^\s+(\S+)\s+(0x[0-9a-fA-F]+)\s+(?:Thumb|ARM) Code\s+(\d+)")
+    symbols = {}
+    with open(map_path, "r", errors="replace") as handle:
+        for line in handle:
+            match = keil.match(line)
+            if match:
+                start = int(match.group(2), 16) & ~1
+                size = int(match.group(3))
+                # Aliases share an address, keep the one with a size
+                if start not in symbols or symbols[start][1] < size:
+                    symbols[start] = (start, size, match.group(1))
+    return sorted(symbols.values())
+
+
+def symbolize(symbols, address):
+    """Name of the function containing address, or the address in hex."""
+    address &= ~1
+    index = bisect.bisect_right(symbols, (address, float("inf"), "")) - 1
+    if index >= 0:
+        start, size, name = symbols[index]
+        if address < start + max(size, 1):
+            return name
+    return "0x%08X" % address
+
+
+def read_intel_hex(hex_path):
+    """Memory image {address: byte} of an Intel HEX file."""
+    memory = {}
+    base = 0
+    with open(hex_path, "r") as handle:
+        for line in handle:
+            line = line.strip()
+            if not line.startswith(":"):
+                continue
+            data = bytes.fromhex(line[1:])
+            count, address, kind = data[0], (data[1] << 8) | data[2], data[3]
+            payload = data[4:4 + count]
+            if kind == 0x00:
+                for offset, value in enumerate(payload):
+                    memory[base + address + offset] = value
+            elif kind == 0x02:
+                base = ((payload[0] << 8) | payload[1]) << 4
+            elif kind == 0x04:
+                base = ((payload[0] << 8) | payload[1]) << 16
+            elif kind == 0x01:
+                break
+    return memory
+
+
+def read_pyocd(address, size):
+    """Read target memory over the debug probe."""
+    try:
+        from pyocd.core.helpers import ConnectHelper
+    except ImportError:
+        raise SystemExit("pyocd is not installed: pip install pyocd")
+    with ConnectHelper.session_with_chosen_probe() as session:
+        return bytes(session.target.read_memory_block8(address, size))
+
+
+def add_arguments(parser):
+    """Source options common to all dumpers."""
+    parser.add_argument("--bin", help="raw table bytes")
+    parser.add_argument("--hex", help="Intel HEX memory dump")
+    parser.add_argument("--map", help="linker map with the address of the table")
+    parser.add_argument("--pyocd", action="store_true", help="read live over SWD")
+    parser.add_argument("--save-cmd", action="store_true", help="print the Keil SAVE command")
+
+
+def load(parser, args, symbol, magic, header_size, table_size):
+    """Bytes of the table, or None when only the SAVE command was asked for.
+
+    table_size(header_bytes) returns the full size described by a header.
+    """
+    if args.bin:
+        with open(args.bin, "rb") as handle:
+            blob = handle.read()
+    else:
+        if not args.map:
+            parser.error("--map is required for --hex, --pyocd and --save-cmd")
+        address, size = find_symbol(args.map, symbol)
+
+        if args.save_cmd:
+            print("SAVE %s.hex 0x%08X,0x%08X" % (symbol, address, address + (size or header_size) - 1))
+            return None
+
+        if args.pyocd:
+            blob = read_pyocd(address, table_size(read_pyocd(address, header_size)))
+        elif args.hex:
+            memory = read_intel_hex(args.hex)
+            try:
+                header = bytes(memory[address + i] for i in range(header_size))
+                blob = bytes(memory[address + i] for i in range(table_size(header)))
+            except KeyError as error:
+                raise SystemExit("address 0x%08X missing in %s" % (error.args[0], args.hex))
+        else:
+            parser.error("one of --bin, --hex, --pyocd or --save-cmd is required")
+
+    found = struct.unpack_from("<I", blob, 0)[0]
+    if found != magic:
+        raise SystemExit("bad magic 0x%08X, not a %s table" % (found, symbol))
+    return blob
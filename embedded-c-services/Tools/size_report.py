@@ -0,0 +1,230 @@
+#!/usr/bin/env python3
+"""
+@file      size_report.py
+@author    Jet Station
+@brief     Code size, stack and cycle report of all Keil projects with a baseline diff
+@date      [2026-10-17]
+
+Finds every *.uvprojx below the repository root and reads the build
+artifacts of each project:
+  Listings/<OutputName>.map   image totals and per-function code size
+  Objects/<OutputName>.htm    per-function stack size and maximum stack depth
+Only the functions of the project sources are reported, C library code
+only shows up in the image totals.
+
+Benchmark cycles come from g_benchResults dumps of Measure/micro_bench.c,
+given per project: --bench c-inline-function/Demo_Project=results.bin
+(raw bytes, e.g. Host/build/bench_results.bin) or =results.hex (Keil SAVE,
+the address comes from the project map).
+
+The report is a CSV table with one metric per line:
+  project,item,metric,value
+and is compared against a stored baseline (size_baseline.csv next to this
+script). Any growth of code, data or stack, or a median cycle count above
+the tolerance, is listed as a regression and the exit code is 1.
+  size_report.py                    report and compare
+  size_report.py --update-baseline  accept the current figures
+
+Copyright (c) 2026 Jet Station. All rights reserved.
+"""
+
+import argparse
+import csv
+import os
+import re
+import sys
+
+import bench_dump
+import ram_table
+
+DEFAULT_ROOT = os.path.normpath(os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", ".."))
+DEFAULT_BASELINE = os.path.join(os.path.dirname(os.path.abspath(__file__)), "size_baseline.csv")
+
+# Metrics compared in bytes, "cycles" uses a relative tolerance
+SIZE_METRICS = ("code", "ro", "rw", "zi", "stack", "depth")
+
+
+def xml_value(text, tag):
+    match = re.search(r"<%s>([^<]*)</%s>" % (tag, tag), text)
+    return match.group(1) if match else ""
+
+
+def keil_path(base, path):
+    """Host path of a Keil project relative path with backslashes."""
+    return os.path.normpath(os.path.join(base, path.replace("\\", "/")))
+
+
+def find_projects(root):
+    """(name, map, htm, source objects) of every Keil project below root."""
+    projects = []
+    for folder, dirs, files in os.walk(root):
+        dirs[:] = [name for name in dirs if not name.startswith(".") and name != "build"]
+        for file_name in sorted(files):
+            if not file_name.endswith(".uvprojx"):
+                continue
+            path = os.path.join(folder, file_name)
+            with open(path, "r", errors="replace") as handle:
+                text = handle.read()
+            output = xml_value(text, "OutputName")
+            map_path = os.path.join(keil_path(folder, xml_value(text, "ListingPath")), output + ".map")
+            htm_path = os.path.join(keil_path(folder, xml_value(text, "OutputDirectory")), output + ".htm")
+            objects = set()
+            for source in re.findall(r"<FilePath>([^<]*)</FilePath>", text):
+                stem, ext = os.path.splitext(source.replace("\\", "/").split("/")[-1])
+                if ext.lower() in (".c", ".s"):
+                    objects.add(stem + ".o")
+            # Project name: the folder that holds the Keil folder
+            name = os.path.relpath(os.path.dirname(folder), root).replace(os.sep, "/")
+            projects.append((name, map_path, htm_path, objects))
+    return sorted(projects)
+
+
+def map_rows(map_path, objects):
+    """Image totals and code size of the project functions from an armlink map."""
+    rows = []
+    symbol = re.compile(r"^\s+(\S+)\s+0x[0-9a-fA-F]+\s+(?:Thumb|ARM) Code\s+(\d+)\s+(\S+?)\(")
+    totals = re.compile(r"^\s+(\d+)\s+(\d+)\s+(\d+)\s+(\d+)\s+(\d+)\s+\d+\s+Grand Totals")
+    seen = set()
+    with open(map_path, "r", errors="replace") as handle:
+        for line in handle:
+            match = totals.match(line)
+            if match:
+                code, _, ro, rw, zi = (int(value) for value in match.groups())
+                rows += [("image", "code", code), ("image", "ro", ro), ("image", "rw", rw), ("image", "zi", zi)]
+                continue
+            match = symbol.match(line)
+            # Size 0: aliases such as the weak default IRQ handlers
+            if match and match.group(3) in objects and match.group(1) not in seen and match.group(2) != "0":
+                seen.add(match.group(1))
+                rows.append((match.group(1), "code", int(match.group(2))))
+    return rows
+
+
+def htm_rows(htm_path, names):
+    """Stack size and maximum depth of the listed functions from the call graph."""
+    rows = []
+    header = re.compile(r"<STRONG><a name=\"\[\w+\]\"></a>([^<]+)</STRONG> \(\w+, \d+ bytes, Stack size (\d+) bytes")
+    depth = re.compile(r"Max Depth = (\d+)")
+    current = None
+    with open(htm_path, "r", errors="replace") as handle:
+        for line in handle:
+            match = header.search(line)
+            if match:
+                current = match.group(1) if match.group(1) in names else None
+                if current:
+                    rows.append((current, "stack", int(match.group(2))))
+                continue
+            match = depth.search(line)
+            if match and current:
+                rows.append((current, "depth", int(match.group(1))))
+                current = None
+    return rows
+
+
+def bench_rows(spec, map_path):
+    """Median cycles per case of a g_benchResults dump."""
+    if spec.lower().endswith(".hex"):
+        address, _ = ram_table.find_symbol(map_path, bench_dump.SYMBOL)
+        memory = ram_table.read_intel_hex(spec)
+        header = bytes(memory[address + index] for index in range(bench_dump.HEADER.size))
+        blob = bytes(memory[address + index] for index in range(bench_dump.table_size(header)))
+    else:
+        with open(spec, "rb") as handle:
+            blob = handle.read()
+    _, _, _, _, cases = bench_dump.decode(blob)
+    return [("bench:" + case[0], "cycles", case[3]) for case in cases]
+
+
+def collect(root, bench):
+    """Report rows (project, item, metric, value)."""
+    report = []
+    for name, map_path, htm_path, objects in find_projects(root):
+        if not os.path.exists(map_path):
+            print("%s: no map file, build the project first" % name, file=sys.stderr)
+            continue
+        rows = map_rows(map_path, objects)
+        if os.path.exists(htm_path):
+            rows += htm_rows(htm_path, set(row[0] for row in rows if row[0] != "image"))
+        if name in bench:
+            rows += bench_rows(bench.pop(name), map_path)
+        report += [(name,) + row for row in rows]
+    for name in bench:
+        print("--bench %s: no such project" % name, file=sys.stderr)
+    return report
+
+
+def read_csv(path):
+    with open(path, "r", newline="") as handle:
+        return {(row["project"], row["item"], row["metric"]): int(row["value"]) for row in csv.DictReader(handle)}
+
+
+def write_csv(path, report):
+    with open(path, "w", newline="") as handle:
+        writer = csv.writer(handle, lineterminator="\n")
+        writer.writerow(("project", "item", "metric", "value"))
+        writer.writerows(report)
+
+
+def compare(report, baseline, size_tolerance, cycle_tolerance):
+    """Regressions and informational changes against the baseline."""
+    regressions = []
+    changes = []
+    current = {(project, item, metric): value for project, item, metric, value in report}
+    for key, value in sorted(current.items()):
+        if key not in baseline:
+            changes.append("new      %-40s %-32s %-6s %8d" % (key + (value,)))
+            continue
+        old = baseline[key]
+        if value == old:
+            continue
+        limit = old + size_tolerance if key[2] in SIZE_METRICS else old * (1.0 + cycle_tolerance / 100.0)
+        line = "%-40s %-32s %-6s %8d -> %8d (%+d)" % (key + (old, value, value - old))
+        if value > limit:
+            regressions.append("REGRESSED " + line)
+        else:
+            changes.append("changed  " + line)
+    for key in sorted(set(baseline) - set(current)):
+        changes.append("gone     %-40s %-32s %-6s %8d" % (key + (baseline[key],)))
+    return regressions, changes
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Code size, stack and cycle report of all Keil projects")
+    parser.add_argument("--root", default=DEFAULT_ROOT, help="repository root")
+    parser.add_argument("--out", help="write the report CSV")
+    parser.add_argument("--baseline", default=DEFAULT_BASELINE, help="baseline CSV")
+    parser.add_argument("--update-baseline", action="store_true", help="store the report as baseline")
+    parser.add_argument("--bench", action="append", default=[], metavar="PROJECT=FILE",
+                        help="g_benchResults dump (.bin or Keil SAVE .hex) of a project")
+    parser.add_argument("--size-tolerance", type=int, default=0, help="allowed growth in bytes (default 0)")
+    parser.add_argument("--cycle-tolerance", type=float, default=5.0, help="allowed cycle growth in %% (default 5)")
+    args = parser.parse_args()
+
+    bench = {}
+    for spec in args.bench:
+        project, _, path = spec.partition("=")
+        if not path:
+            parser.error("--bench expects PROJECT=FILE")
+        bench[project.strip("/")] = path
+
+    report = collect(args.root, bench)
+    if args.out:
+        write_csv(args.out, report)
+    if args.update_baseline:
+        write_csv(args.baseline, report)
+        print("baseline %s: %d metrics of %d projects" %
+              (args.baseline, len(report), len(set(row[0] for row in report))))
+        return 0
+    if not os.path.exists(args.baseline):
+        print("no baseline %s, run with --update-baseline" % args.baseline, file=sys.stderr)
+        return 1
+
+    regressions, changes = compare(report, read_csv(args.baseline), args.size_tolerance, args.cycle_tolerance)
+    for line in changes + regressions:
+        print(line)
+    print("%d metrics, %d changed, %d regressed" % (len(report), len(changes), len(regressions)))
+    return 1 if regressions else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,210 @@
+#!/usr/bin/env python3
+"""
+@file      stack_analyzer.py
+@author    Jet Station
+@brief     Static worst-case stack depth per entry point, including ISRs
+@date      [2026-10-17]
+
+Builds the call graph with the stack frame of every function from either
+  --htm FILE   Keil static call graph (Objects/<OutputName>.htm, armlink --callgraph)
+  --ci FILE..  GCC call graph info, compiled with -fstack-usage -fcallgraph-info=su
+and computes the deepest path from every entry point: the thread entry
+(__rt_entry_main or main, --entry adds more, e.g. kernel threads) and every
+handler of the vector table.
+
+The MSP worst case is the thread depth plus the deepest handlers that can
+nest on top of it (--nesting, one per preemption level), each with its
+exception frame. With --startup, the result is checked against Stack_Size.
+
+Calls through function pointers are not in the graph. They are listed,
+and --edge CALLER=CALLEE adds them, e.g. the task table of the scheduler:
+    --edge TaskSched_dispatch=Task_countUp
+
+Copyright (c) 2026 Jet Station. All rights reserved.
+"""
+
+import argparse
+import html
+import re
+import sys
+
+# Exception entry stacks r0-r3, r12, lr, pc, xPSR plus up to 4 bytes of
+# alignment padding (CCR.STKALIGN)
+EXCEPTION_FRAME = 36
+
+
+class Graph(object):
+    def __init__(self):
+        self.frame = {}  # name -> bytes, None when unknown
+        self.calls = {}  # name -> set of callees
+        self.handlers = set()  # functions referenced from the vector table
+        self.pointers = set()  # functions whose address is taken elsewhere
+
+    def add(self, name, frame):
+        self.frame.setdefault(name, frame)
+        self.calls.setdefault(name, set())
+
+
+def load_htm(path):
+    """Call graph of a Keil static call graph page."""
+    graph = Graph()
+    header = re.compile(r"<STRONG><a name=\"\[(\w+)\]\"></a>([^<]+)</STRONG> \(\w+, \d+ bytes, Stack size (\w+) bytes")
+    link = re.compile(r"<a href=\"#\[(\w+)\]\">")
+    pointer = re.compile(r"<LI><a href=\"#\[\w+\]\">([^<]+)</a> from .* referenced from (\S+)")
+    names = {}
+    edges = []
+    current = None
+    section = None
+    with open(path, "r", errors="replace") as handle:
+        for line in handle:
+            match = pointer.search(line)
+            if match:
+                target = graph.handlers if "(RESET)" in match.group(2) else graph.pointers
+                target.add(html.unescape(match.group(1)))
+                continue
+            match = header.search(line)
+            if match:
+                current = html.unescape(match.group(2))
+                names[match.group(1)] = current
+                graph.add(current, int(match.group(3)) if match.group(3).isdigit() else None)
+                section = None
+                continue
+            if "[Calls]" in line:
+                section = "calls"
+            elif "[Called By]" in line or "[Address Reference" in line or "[Stack]" in line:
+                section = None
+            if section == "calls" and current:
+                for anchor in link.findall(line):
+                    edges.append((current, anchor))
+            if "</UL>" in line:
+                section = None
+    for caller, anchor in edges:
+        if anchor in names:
+            graph.calls[caller].add(names[anchor])
+    return graph
+
+
+def load_ci(paths):
+    """Call graph of GCC -fcallgraph-info=su files (VCG format)."""
+    graph = Graph()
+    node = re.compile(r"node:\s*\{\s*title:\s*\"([^\"]+)\"\s*label:\s*\"([^\"]*)\"")
+    edge = re.compile(r"edge:\s*\{\s*sourcename:\s*\"([^\"]+)\"\s*targetname:\s*\"([^\"]+)\"")
+    frame = re.compile(r"(\d+) bytes \((static|dynamic|bounded)")
+    edges = []
+    for path in paths:
+        with open(path, "r", errors="replace") as handle:
+            text = handle.read()
+        for title, label in node.findall(text):
+            match = frame.search(label)
+            graph.add(title, int(match.group(1)) if match and match.group(2) != "dynamic" else None)
+        edges += edge.findall(text)
+    for caller, callee in edges:
+        graph.add(caller, None)
+        graph.add(callee, None)
+        graph.calls[caller].add(callee)
+    # No vector table in the object files, handlers are found by name
+    graph.handlers = set(name for name in graph.frame if name.endswith("_Handler") or name.endswith("_IRQHandler"))
+    return graph
+
+
+def worst_path(graph, root):
+    """(bytes, path, notes) of the deepest call chain from root."""
+    memo = {}
+    notes = set()
+
+    def visit(name, active):
+        if name in memo:
+            return memo[name]
+        frame = graph.frame.get(name)
+        if frame is None:
+            notes.add("unknown frame: " + name)
+            frame = 0
+        best = (0, [])
+        for callee in sorted(graph.calls.get(name, ())):
+            if callee in active:
+                # A handler looping on itself (B .) is no recursion
+                if callee != name or frame != 0:
+                    notes.add("recursion: %s -> %s, depth per level not counted" % (name, callee))
+                continue
+            depth, path = visit(callee, active | {callee})
+            if depth > best[0]:
+                best = (depth, path)
+        memo[name] = (frame + best[0], [name] + best[1])
+        return memo[name]
+
+    depth, path = visit(root, frozenset([root]))
+    return depth, path, sorted(notes)
+
+
+def stack_size(startup):
+    """Stack_Size of a Keil startup file."""
+    with open(startup, "r", errors="replace") as handle:
+        for line in handle:
+            match = re.match(r"^Stack_Size\s+EQU\s+(0x[0-9a-fA-F]+|\d+)", line)
+            if match:
+                return int(match.group(1), 0)
+    raise SystemExit("no Stack_Size in %s" % startup)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Static worst-case stack depth per entry point")
+    parser.add_argument("--htm", help="Keil static call graph")
+    parser.add_argument("--ci", nargs="+", help="GCC -fcallgraph-info=su files")
+    parser.add_argument("--startup", help="Keil startup file with Stack_Size")
+    parser.add_argument("--entry", action="append", default=[], help="extra thread entry, e.g. a kernel thread")
+    parser.add_argument("--edge", action="append", default=[], metavar="CALLER=CALLEE",
+                        help="call through a function pointer")
+    parser.add_argument("--nesting", type=int, default=1, help="nested handler levels on the MSP (default 1)")
+    args = parser.parse_args()
+
+    if args.htm:
+        graph = load_htm(args.htm)
+    elif args.ci:
+        graph = load_ci(args.ci)
+    else:
+        parser.error("one of --htm or --ci is required")
+
+    for spec in args.edge:
+        caller, _, callee = spec.partition("=")
+        if caller not in graph.frame or callee not in graph.frame:
+            parser.error("--edge %s: unknown function" % spec)
+        graph.calls[caller].add(callee)
+
+    # The C library startup falls through its sections up to __rt_entry_main
+    thread = "__rt_entry_main" if "__rt_entry_main" in graph.frame else "main"
+    roots = [thread] + args.entry
+    handlers = sorted(name for name in graph.handlers if name != "Reset_Handler")
+
+    print("%-28s %8s  %s" % ("entry point", "bytes", "deepest call chain"))
+    results = {}
+    for root in roots + handlers:
+        if root not in graph.frame:
+            print("%-28s %8s" % (root, "missing"))
+            continue
+        depth, path, notes = worst_path(graph, root)
+        results[root] = depth
+        print("%-28s %8d  %s" % (root, depth, " > ".join(path)))
+        for note in notes:
+            print("%-28s %8s    ! %s" % ("", "", note))
+
+    nested = sorted((results[name] + EXCEPTION_FRAME for name in handlers if name in results), reverse=True)
+    msp = results.get(thread, 0) + sum(nested[:args.nesting])
+    print()
+    print("MSP worst case: %s %d + %d nested handler(s) %s = %d bytes" %
+          (thread, results.get(thread, 0), args.nesting, nested[:args.nesting], msp))
+
+    unresolved = sorted(graph.pointers - set(callee for calls in graph.calls.values() for callee in calls))
+    if unresolved:
+        print("called through pointers, add with --edge if on a stack path: " + ", ".join(unresolved))
+
+    if args.startup:
+        size = stack_size(args.startup)
+        print("Stack_Size %d bytes, headroom %d bytes" % (size, size - msp))
+        if msp > size:
+            print("STACK OVERFLOW possible")
+            return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
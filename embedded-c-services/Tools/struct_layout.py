@@ -0,0 +1,384 @@
+#!/usr/bin/env python3
+"""
+@file      struct_layout.py
+@author    Jet Station
+@brief     Struct layouts from DWARF: padding, alignment, hot fields, reordering
+@date      [2026-10-17]
+
+Reads the debug information of the compiled objects with readelf
+(--readelf selects the tool, e.g. arm-none-eabi-readelf) from any of
+  Keil:  Objects/<OutputName>.axf or Objects/*.o, with Debug Information on
+  GCC:   the ELF or the objects built with -g
+and prints the layout of every struct: offset, size and alignment of the
+members, the holes between them and the tail padding.
+
+Packed structs are recognized by members below their natural alignment.
+Such a member is loaded unaligned: on the Cortex-M3 an LDR/STR of a word
+at an odd halfword costs a second bus access, LDRD/LDM/STM fault, and with
+-mno-unaligned-access the compiler falls back to byte loads.
+
+Every struct with holes, tail padding or unaligned members gets a suggested
+order: the --hot fields first, then the rest by decreasing alignment. The
+first bytes of a struct are the cheapest on Thumb, LDR/STR with a 16-bit
+encoding reach words up to offset 124, halfwords up to 62 and bytes up to
+31. Hot fields beyond that are marked.
+
+    --hot Rectangle_st=area_u32,width_u16
+    --struct Rectangle_st   only the named structs, --all also sound ones
+
+Copyright (c) 2026 Jet Station. All rights reserved.
+"""
+
+import argparse
+import re
+import subprocess
+import sys
+
+# Reach of the 16-bit Thumb LDR/STR (immediate) per access size
+THUMB_REACH = {1: 31, 2: 62, 4: 124}
+
+ENTRY = re.compile(r"^\s*<(\d+)><([0-9a-f]+)>: Abbrev Number: (\d+)(?: \((DW_TAG_\w+)\))?")
+ATTRIBUTE = re.compile(r"^\s*<[0-9a-f]+>\s+(DW_AT_\w+)\s*:\s*(.*)$")
+REFERENCE = re.compile(r"<0x([0-9a-f]+)>")
+PLUS_UCONST = re.compile(r"DW_OP_plus_uconst: (\d+)")
+# binutils 2.39 and later print the form first: "(data1) 12"
+FORM = re.compile(r"^\(\w+\)\s*")
+
+
+class Die(object):
+    def __init__(self, offset, tag):
+        self.offset = offset
+        self.tag = tag
+        self.attrs = {}
+        self.children = []
+
+
+def read_dies(path, tool):
+    """All debug information entries of a file, by section offset."""
+    try:
+        text = subprocess.run([tool, "--debug-dump=info", "--wide", path], check=True,
+                              stdout=subprocess.PIPE, universal_newlines=True).stdout
+    except (OSError, subprocess.CalledProcessError) as error:
+        sys.exit("%s: %s" % (tool, error))
+    dies = {}
+    stack = []
+    current = None
+    for line in text.splitlines():
+        match = ENTRY.match(line)
+        if match:
+            depth = int(match.group(1))
+            del stack[depth:]
+            current = None
+            if match.group(4) is None:
+                continue  # null entry, end of the children
+            current = Die(int(match.group(2), 16), match.group(4))
+            dies[current.offset] = current
+            if stack:
+                stack[-1].children.append(current)
+            stack.append(current)
+            continue
+        match = ATTRIBUTE.match(line)
+        if match and current is not None:
+            current.attrs[match.group(1)] = FORM.sub("", match.group(2).strip())
+    return dies
+
+
+def attr_name(die):
+    value = die.attrs.get("DW_AT_name")
+    if value is None:
+        return None
+    # (indirect string, offset: 0x1a3): name
+    if value.startswith("(") and "): " in value:
+        value = value.split("): ", 1)[1]
+    return value.strip()
+
+
+def attr_int(die, name):
+    value = die.attrs.get(name)
+    if value is None:
+        return None
+    match = PLUS_UCONST.search(value)
+    if match:
+        return int(match.group(1))
+    match = re.match(r"(0x[0-9a-f]+|-?\d+)", value)
+    return int(match.group(1), 0) if match else None
+
+
+class Types(object):
+    """Size, alignment and C spelling of the types of one file."""
+
+    def __init__(self, dies):
+        self.dies = dies
+
+    def ref(self, die):
+        match = REFERENCE.search(die.attrs.get("DW_AT_type", ""))
+        return self.dies.get(int(match.group(1), 16)) if match else None
+
+    def size(self, die):
+        if die is None:
+            return 0
+        size = attr_int(die, "DW_AT_byte_size")
+        if size is not None:
+            return size
+        if die.tag == "DW_TAG_array_type":
+            count = 1
+            for sub in die.children:
+                if sub.tag != "DW_TAG_subrange_type":
+                    continue
+                bound = attr_int(sub, "DW_AT_count")
+                if bound is None:
+                    upper = attr_int(sub, "DW_AT_upper_bound")
+                    bound = 0 if upper is None else upper + 1
+                count *= bound
+            return count * self.size(self.ref(die))
+        if die.tag in ("DW_TAG_pointer_type", "DW_TAG_reference_type"):
+            return 4
+        return self.size(self.ref(die))
+
+    def align(self, die):
+        """Natural alignment, the AAPCS one: the size of a scalar."""
+        if die is None:
+            return 1
+        explicit = attr_int(die, "DW_AT_alignment")
+        if explicit is not None:
+            return explicit
+        if die.tag in ("DW_TAG_structure_type", "DW_TAG_union_type", "DW_TAG_class_type"):
+            layout = self.layout(die)
+            return 1 if layout.packed else layout.natural_align
+        if die.tag in ("DW_TAG_base_type", "DW_TAG_pointer_type", "DW_TAG_enumeration_type",
+                       "DW_TAG_reference_type"):
+            return max(1, min(self.size(die), 8))
+        return self.align(self.ref(die))
+
+    def spell(self, die):
+        """Type name for a declaration, array bounds go after the member."""
+        if die is None:
+            return "void", ""
+        name = attr_name(die)
+        if die.tag == "DW_TAG_typedef" or (die.tag == "DW_TAG_base_type" and name):
+            return name, ""
+        if die.tag in ("DW_TAG_structure_type", "DW_TAG_union_type", "DW_TAG_enumeration_type"):
+            keyword = {"DW_TAG_structure_type": "struct", "DW_TAG_union_type": "union",
+                       "DW_TAG_enumeration_type": "enum"}[die.tag]
+            return "%s %s" % (keyword, name or "<anonymous>"), ""
+        if die.tag == "DW_TAG_pointer_type":
+            base, suffix = self.spell(self.ref(die))
+            return base + " *", suffix
+        if die.tag in ("DW_TAG_const_type", "DW_TAG_volatile_type"):
+            base, suffix = self.spell(self.ref(die))
+            return "%s %s" % (die.tag[7:-5], base), suffix
+        if die.tag == "DW_TAG_array_type":
+            base, suffix = self.spell(self.ref(die))
+            for sub in die.children:
+                bound = attr_int(sub, "DW_AT_count")
+                if bound is None:
+                    upper = attr_int(sub, "DW_AT_upper_bound")
+                    bound = 0 if upper is None else upper + 1
+                suffix += "[%d]" % bound
+            return base, suffix
+        return name or die.tag[7:], ""
+
+    def layout(self, die):
+        if not hasattr(die, "layout"):
+            die.layout = Layout(self, die)
+        return die.layout
+
+
+class Member(object):
+    def __init__(self, name, offset, size, align, decl, bits=None):
+        self.name = name
+        self.offset = offset
+        self.size = size
+        self.align = align
+        self.decl = decl  # (type, array suffix)
+        self.bits = bits  # bit-field widths sharing this storage unit
+
+
+class Layout(object):
+    """Members of a struct as storage units: a run of bit-fields in the same
+    unit is one member that moves as a whole."""
+
+    def __init__(self, types, die):
+        self.size = attr_int(die, "DW_AT_byte_size") or 0
+        self.union = die.tag == "DW_TAG_union_type"
+        self.members = []
+        for child in die.children:
+            if child.tag != "DW_TAG_member":
+                continue
+            kind = types.ref(child)
+            size = types.size(kind)
+            offset = attr_int(child, "DW_AT_data_member_location") or 0
+            bits = attr_int(child, "DW_AT_bit_size")
+            if bits is not None:
+                bit_offset = attr_int(child, "DW_AT_data_bit_offset")
+                if bit_offset is not None:
+                    offset = bit_offset // 8 // size * size
+                last = self.members[-1] if self.members else None
+                if last is not None and last.bits is not None and last.offset == offset:
+                    last.name += "," + attr_name(child)
+                    last.bits.append(bits)
+                    continue
+                self.members.append(Member(attr_name(child) or "<anonymous>", offset, size,
+                                           types.align(kind), types.spell(kind), [bits]))
+                continue
+            self.members.append(Member(attr_name(child) or "<anonymous>", offset, size,
+                                       types.align(kind), types.spell(kind)))
+        self.natural_align = max([m.align for m in self.members] or [1])
+        self.packed = any(m.offset % m.align for m in self.members) or \
+            (self.size % self.natural_align != 0)
+
+    def holes(self):
+        """(offset, bytes) of the padding between members and at the tail."""
+        gaps = []
+        end = 0
+        if not self.union:
+            for member in self.members:
+                if member.offset > end:
+                    gaps.append((end, member.offset - end))
+                end = max(end, member.offset + member.size)
+        else:
+            end = max([m.size for m in self.members] or [0])
+        if self.size > end:
+            gaps.append((end, self.size - end))
+        return gaps
+
+    def unaligned(self):
+        return [m for m in self.members if m.offset % m.align]
+
+
+def arrange(members):
+    """Offsets and size of members placed in the given order, with natural
+    alignment."""
+    offset = 0
+    placed = []
+    for member in members:
+        offset = (offset + member.align - 1) // member.align * member.align
+        placed.append((offset, member))
+        offset += member.size
+    align = max([m.align for m in members] or [1])
+    return placed, (offset + align - 1) // align * align
+
+
+def suggest(layout, hot):
+    """Hot fields first, then by decreasing alignment, both stable."""
+    def unit_hot(member):
+        return any(name in hot for name in member.name.split(","))
+    first = sorted([m for m in layout.members if unit_hot(m)], key=lambda m: -m.align)
+    rest = sorted([m for m in layout.members if not unit_hot(m)], key=lambda m: -m.align)
+    return arrange(first + rest)
+
+
+def hot_reach(offset, member):
+    reach = THUMB_REACH.get(member.size)
+    return reach is None or offset <= reach
+
+
+def declaration(member):
+    kind, suffix = member.decl
+    if member.bits is not None:
+        return "\n".join("\t%s %s : %d;" % (kind, name, bits)
+                         for name, bits in zip(member.name.split(","), member.bits))
+    return "\t%s%s%s%s;" % (kind, "" if kind.endswith("*") else " ", member.name, suffix)
+
+
+def struct_names(dies):
+    """Name of every struct definition, anonymous ones by their typedef."""
+    names = {}
+    for die in dies.values():
+        if die.tag == "DW_TAG_structure_type" and "DW_AT_declaration" not in die.attrs:
+            name = attr_name(die)
+            if name:
+                names.setdefault(die.offset, name)
+    for die in dies.values():
+        if die.tag != "DW_TAG_typedef":
+            continue
+        match = REFERENCE.search(die.attrs.get("DW_AT_type", ""))
+        target = dies.get(int(match.group(1), 16)) if match else None
+        if target is not None and target.tag == "DW_TAG_structure_type" and target.offset not in names:
+            names[target.offset] = attr_name(die)
+    return names
+
+
+def report(name, layout, hot, show_all):
+    holes = layout.holes()
+    padding = sum(size for _, size in holes)
+    unaligned = layout.unaligned()
+    placed, size = suggest(layout, hot)
+    far = [(offset, m) for offset, m in placed
+           if any(n in hot for n in m.name.split(",")) and not hot_reach(offset, m)]
+    if not show_all and not padding and not unaligned and size >= layout.size and not hot:
+        return False
+
+    print("%s: %u bytes, align %u%s" % (name, layout.size, 1 if layout.packed else layout.natural_align,
+                                        ", packed" if layout.packed else ""))
+    print("  %6s %5s %5s  %s" % ("offset", "size", "align", "member"))
+    gaps = dict(holes)
+    for member in layout.members:
+        note = []
+        if member.offset % member.align:
+            note.append("unaligned")
+        if any(n in hot for n in member.name.split(",")):
+            note.append("hot" if hot_reach(member.offset, member) else "hot, 32-bit access")
+        print("  %6u %5u %5u  %s%s" % (member.offset, member.size, member.align, member.name,
+                                       "  <- " + ", ".join(note) if note else ""))
+        end = member.offset + member.size
+        if end in gaps and not layout.union:
+            print("  %6u %5u %5s  (padding)" % (end, gaps.pop(end), ""))
+    for offset, gap in sorted(gaps.items()):
+        print("  %6u %5u %5s  (padding)" % (offset, gap, ""))
+    print("  padding %u bytes, %u unaligned member%s" % (padding, len(unaligned),
+                                                        "" if len(unaligned) == 1 else "s"))
+    if layout.union:
+        print()
+        return True
+
+    moved = [m.name for _, m in placed] != [m.name for m in layout.members]
+    if size < layout.size or unaligned or (hot and moved):
+        saved = layout.size - size
+        print("  suggested order, %u bytes (%s), all members aligned:" %
+              (size, "%d saved" % saved if saved >= 0 else "%d more than packed" % -saved))
+        print("  typedef struct {")
+        for offset, member in placed:
+            print("  " + declaration(member).replace("\n", "\n  ") + "  /* %u */" % offset)
+        print("  } %s;" % name)
+    for offset, member in far:
+        print("  hot %s at %u is beyond the 16-bit Thumb LDR/STR reach" % (member.name, offset))
+    print()
+    return True
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Struct layouts, padding and reordering from DWARF")
+    parser.add_argument("files", nargs="+", help=".axf, .elf or .o with debug information")
+    parser.add_argument("--readelf", default="readelf", help="readelf of the toolchain (default readelf)")
+    parser.add_argument("--struct", action="append", default=[], help="only this struct, repeatable")
+    parser.add_argument("--hot", action="append", default=[], metavar="STRUCT=FIELD,..",
+                        help="fields accessed most, placed first")
+    parser.add_argument("--all", action="store_true", help="also structs without padding")
+    args = parser.parse_args()
+
+    hot = {}
+    for item in args.hot:
+        struct, _, fields = item.partition("=")
+        hot.setdefault(struct, set()).update(f for f in fields.split(",") if f)
+
+    seen = set()
+    shown = 0
+    for path in args.files:
+        dies = read_dies(path, args.readelf)
+        types = Types(dies)
+        for offset, name in sorted(struct_names(dies).items(), key=lambda item: item[1]):
+            if args.struct and name not in args.struct:
+                continue
+            layout = types.layout(dies[offset])
+            key = (name, layout.size, tuple((m.name, m.offset) for m in layout.members))
+            if key in seen or not layout.members:
+                continue
+            seen.add(key)
+            shown += report(name, layout, hot.get(name, set()), args.all or bool(args.struct))
+    if not shown:
+        print("no struct with padding or unaligned members")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,114 @@
+#!/usr/bin/env python3
+"""
+@file      trace_dump.py
+@author    Jet Station
+@brief     Convert the function trace ring g_funcTrace to a Chrome trace
+@date      [2026-10-17]
+
+Reads the RAM ring of Measure/func_trace.c, resolves the function
+addresses with the Keil map file and writes Chrome trace JSON, viewable in
+chrome://tracing or https://ui.perfetto.dev. A per-function summary of
+calls and inclusive times is printed as well.
+
+The ring is found through the symbol g_funcTrace, see ram_table.py for the
+sources (--bin, --hex/--map, --pyocd/--map, --save-cmd/--map). The map is
+also needed with --bin to get function names.
+
+Copyright (c) 2026 Jet Station. All rights reserved.
+"""
+
+import argparse
+import json
+import struct
+import sys
+
+import ram_table
+
+SYMBOL = "g_funcTrace"
+MAGIC = 0x43525446
+HEADER = struct.Struct("<IHHIIIII")
+RECORD = struct.Struct("<II")
+ENTRY_FLAG = 1
+
+
+def table_size(header):
+    """Size of the ring described by a header."""
+    entries = HEADER.unpack_from(header, 0)[2]
+    return HEADER.size + entries * RECORD.size
+
+
+def decode(blob):
+    """Header fields and the records in time order, oldest first."""
+    _, version, entries, head, _, start, cycles_per_us, hook = HEADER.unpack_from(blob, 0)
+    count = min(head, entries)
+    records = []
+    for index in range(head - count, head):
+        offset = HEADER.size + (index % entries) * RECORD.size
+        records.append(RECORD.unpack_from(blob, offset))
+    return version, head, start, max(cycles_per_us, 1), hook, records
+
+
+def to_events(records, start, cycles_per_us, symbols):
+    """Chrome trace events and per-function (calls, total us, max us).
+
+    Exits whose entry was overwritten are dropped, functions still running
+    at the end of the ring are closed at the last timestamp.
+    """
+    events = []
+    stats = {}
+    stack = []
+    elapsed = 0
+    last = start
+    for addr, cycles in records:
+        # 32-bit CYCCNT: records are in time order, so unwrap the deltas
+        elapsed += (cycles - last) & 0xFFFFFFFF
+        last = cycles
+        ts = elapsed / float(cycles_per_us)
+        name = symbols(addr)
+        if addr & ENTRY_FLAG:
+            stack.append((name, ts))
+            events.append({"name": name, "ph": "B", "ts": ts, "pid": 0, "tid": 0})
+        elif stack and stack[-1][0] == name:
+            _, begin = stack.pop()
+            events.append({"name": name, "ph": "E", "ts": ts, "pid": 0, "tid": 0})
+            calls, total, longest = stats.get(name, (0, 0.0, 0.0))
+            stats[name] = (calls + 1, total + ts - begin, max(longest, ts - begin))
+    end = events[-1]["ts"] if events else 0.0
+    while stack:
+        name, _ = stack.pop()
+        events.append({"name": name, "ph": "E", "ts": end, "pid": 0, "tid": 0})
+    return events, stats
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Convert the function trace " + SYMBOL + " to Chrome trace JSON")
+    ram_table.add_arguments(parser)
+    parser.add_argument("--json", default="trace.json", help="output file (default trace.json)")
+    args = parser.parse_args()
+
+    blob = ram_table.load(parser, args, SYMBOL, MAGIC, HEADER.size, table_size)
+    if blob is None:
+        return 0
+
+    version, head, start, cycles_per_us, hook, records = decode(blob)
+    if args.map:
+        table = ram_table.code_symbols(args.map)
+        symbols = lambda addr: ram_table.symbolize(table, addr)
+    else:
+        symbols = lambda addr: "0x%08X" % (addr & ~ENTRY_FLAG)
+
+    events, stats = to_events(records, start, cycles_per_us, symbols)
+    with open(args.json, "w") as handle:
+        json.dump({"traceEvents": events, "displayTimeUnit": "ns"}, handle)
+
+    print("function trace v%d, %d of %d records kept, %d cycles/us, hook %d cycles" %
+          (version, len(records), head, cycles_per_us, hook))
+    print("%-32s %8s %12s %12s" % ("function", "calls", "total us", "max us"))
+    for name, (calls, total, longest) in sorted(stats.items(), key=lambda item: -item[1][1]):
+        print("%-32s %8d %12.2f %12.2f" % (name, calls, total, longest))
+    print("wrote %d events to %s" % (len(events), args.json))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
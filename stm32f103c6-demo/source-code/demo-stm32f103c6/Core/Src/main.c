@@ -21,6 +21,9 @@
 
 /* Private includes ----------------------------------------------------------*/
 /* USER CODE BEGIN Includes */
+#include "tickless_idle.h"
+#include "mono_clock.h"
+#include "timer_wheel.h"
 
 /* USER CODE END Includes */
 
@@ -32,6 +35,9 @@
 /* Private define ------------------------------------------------------------*/
 /* USER CODE BEGIN PD */
 
+/* LED blinking period in ms */
+#define BLINK_PERIOD_MS (200U)
+
 /* USER CODE END PD */
 
 /* Private macro -------------------------------------------------------------*/
@@ -42,6 +48,7 @@
 /* Private variables ---------------------------------------------------------*/
 
 /* USER CODE BEGIN PV */
+static TimerWheel_Timer_st s_blinkTimer;
 
 /* USER CODE END PV */
 
@@ -49,12 +56,24 @@
 void SystemClock_Config(void);
 static void MX_GPIO_Init(void);
 /* USER CODE BEGIN PFP */
+static void Blink_toggleLed(void *ctx);
 
 /* USER CODE END PFP */
 
 /* Private user code ---------------------------------------------------------*/
 /* USER CODE BEGIN 0 */
 
+/**
+  * @brief  Blink timer callback, toggles the on-board LED
+  * @param  ctx: unused
+  * @retval None
+  */
+static void Blink_toggleLed(void *ctx)
+{
+	(void)ctx;
+	HAL_GPIO_TogglePin(GPIOC, GPIO_PIN_13);
+}
+
 /* USER CODE END 0 */
 
 /**
@@ -65,6 +84,7 @@ int main(void)
 {
 
   /* USER CODE BEGIN 1 */
+  uint32_t l_now_u32 = 0U;
 
   /* USER CODE END 1 */
 
@@ -88,6 +108,12 @@ int main(void)
   MX_GPIO_Init();
   /* USER CODE BEGIN 2 */
 
+  /* SysTick reload is final once the system clock is configured */
+  TicklessIdle_init();
+  MonoClock_init();
+  TimerWheel_init(HAL_GetTick());
+  (void)TimerWheel_start(&s_blinkTimer, BLINK_PERIOD_MS, BLINK_PERIOD_MS, Blink_toggleLed, NULL);
+
   /* USER CODE END 2 */
 
   /* Infinite loop */
@@ -97,8 +123,11 @@ int main(void)
 
     /* USER CODE BEGIN 3 */
 	  
-	HAL_Delay(200);
-    HAL_GPIO_TogglePin(GPIOC, GPIO_PIN_13);
+	l_now_u32 = HAL_GetTick();
+	TimerWheel_process(l_now_u32);
+
+	/* Nothing due before the next timer expiry, stop the tick and sleep */
+	(void)TicklessIdle_sleep(TimerWheel_ticksToNextExpiry(l_now_u32));
 	  
 	/* USER CODE END 3 */
   }
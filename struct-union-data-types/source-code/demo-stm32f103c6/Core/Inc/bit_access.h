@@ -0,0 +1,69 @@
+/*****************************************************************************
+ * @file      bit_access.h
+ * @author    Jet Station
+ * @brief     Bit-field, mask and bit-band single-bit access and their benchmark
+ * @date      [2026-10-17]
+ *
+ * Contact:
+ *   @website   https://jet-station.github.io/
+ *   @github    https://github.com/jet-station
+ *   @linkedin  https://www.linkedin.com/in/thien-ai-ho/
+ *   @email     thienaiho95@gmail.com
+ *
+ * @copyright  Copyright (c) 2026 Jet Station. All rights reserved.
+ *****************************************************************************/
+
+#ifndef __BIT_ACCESS_H__
+#define __BIT_ACCESS_H__
+
+#include <stdint.h>
+
+/* Flag word with the same bits as RegisterBits_st of main.c */
+typedef union {
+	uint32_t word_u32;
+	struct {
+		uint32_t bit0 : 1;
+		uint32_t bit1 : 1;
+		uint32_t bit2 : 1;
+		uint32_t bit3 : 1;
+		uint32_t reserved : 28;
+	} bits_st;
+} BitAccess_Flags_un;
+
+/* Flag word in SRAM, shared by all SRAM cases */
+extern volatile BitAccess_Flags_un g_bitAccessFlags;
+
+/**
+  * @brief  Enable the GPIOC clock for the ODR cases, with a bit-band store
+  * @param  None
+  * @retval None
+  */
+void BitAccess_init(void);
+
+/**
+  * @brief  Set, then clear bit 0 to 3 of g_bitAccessFlags, unrolled
+  * @note   Benchmark cases, registered with BENCH_CASE in bit_access.c
+  *           Field:   bit-field assignment, read-modify-write
+  *           Mask:    |= and &= ~, read-modify-write
+  *           MaskIrq: the same with interrupts masked, as needed when an
+  *                    ISR writes the same word
+  *           Band:    one store per bit to the bit-band alias
+  * @param  None
+  * @retval None
+  */
+void BitAccess_flagField(void);
+void BitAccess_flagMask(void);
+void BitAccess_flagMaskIrq(void);
+void BitAccess_flagBand(void);
+
+/**
+  * @brief  Set, then clear PC13 (LED of the Blue Pill) in GPIOC->ODR
+  * @note   Benchmark cases: read-modify-write of ODR against the bit-band
+  *         alias of the same bit
+  * @param  None
+  * @retval None
+  */
+void BitAccess_odrMask(void);
+void BitAccess_odrBand(void);
+
+#endif
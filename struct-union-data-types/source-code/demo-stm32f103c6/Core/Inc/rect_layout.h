@@ -0,0 +1,77 @@
+/*****************************************************************************
+ * @file      rect_layout.h
+ * @author    Jet Station
+ * @brief     Packed, natural and reordered Rectangle layouts and their benchmark
+ * @date      [2026-10-17]
+ *
+ * Contact:
+ *   @website   https://jet-station.github.io/
+ *   @github    https://github.com/jet-station
+ *   @linkedin  https://www.linkedin.com/in/thien-ai-ho/
+ *   @email     thienaiho95@gmail.com
+ *
+ * @copyright  Copyright (c) 2026 Jet Station. All rights reserved.
+ *****************************************************************************/
+
+#ifndef __RECT_LAYOUT_H__
+#define __RECT_LAYOUT_H__
+
+#include <stdint.h>
+
+/* No device header here: the same file is built for the Blue Pill and by
+ * the host benchmark runner in embedded-c-services/Host */
+
+/* Rectangles per table, every case walks a whole table */
+#ifndef RECT_LAYOUT_COUNT
+#define RECT_LAYOUT_COUNT (16U)
+#endif
+
+/* Declaration order of main.c, packed: 8 bytes, area_u32 at offset 2 is
+ * loaded and stored unaligned */
+typedef struct __attribute__((packed)) {
+	uint16_t width_u16;
+	uint32_t area_u32;
+	uint16_t height_u16;
+} RectPacked_st;
+
+/* Declaration order of main.c, natural alignment: 12 bytes, 4 of them
+ * padding */
+typedef struct {
+	uint16_t width_u16;
+	uint32_t area_u32;
+	uint16_t height_u16;
+} RectNatural_st;
+
+/* Order suggested by Tools/struct_layout.py: 8 bytes, all aligned */
+typedef struct {
+	uint32_t area_u32;
+	uint16_t width_u16;
+	uint16_t height_u16;
+} RectReordered_st;
+
+extern RectPacked_st g_rectPacked[RECT_LAYOUT_COUNT];
+extern RectNatural_st g_rectNatural[RECT_LAYOUT_COUNT];
+extern RectReordered_st g_rectReordered[RECT_LAYOUT_COUNT];
+
+/* Sum of the areas of the last case, keeps the loads */
+extern volatile uint32_t g_rectAreaSum;
+
+/**
+  * @brief  Fill the three tables with the same rectangles
+  * @param  None
+  * @retval None
+  */
+void RectLayout_init(void);
+
+/**
+  * @brief  Area of every rectangle of one table: load width and height,
+  *         store the area, load it back into the sum
+  * @note   Benchmark cases, registered with BENCH_CASE in rect_layout.c
+  * @param  None
+  * @retval None
+  */
+void RectLayout_areaPacked(void);
+void RectLayout_areaNatural(void);
+void RectLayout_areaReordered(void);
+
+#endif
@@ -0,0 +1,150 @@
+/*****************************************************************************
+ * @file      bit_access.c
+ * @author    Jet Station
+ * @brief     Bit-field, mask and bit-band single-bit access and their benchmark
+ * @date      [2026-10-17]
+ *
+ * Contact:
+ *   @website   https://jet-station.github.io/
+ *   @github    https://github.com/jet-station
+ *   @linkedin  https://www.linkedin.com/in/thien-ai-ho/
+ *   @email     thienaiho95@gmail.com
+ *
+ * @copyright  Copyright (c) 2026 Jet Station. All rights reserved.
+ *****************************************************************************/
+
+#include <stdint.h> /* Standard integer data types */
+#include "stm32f1xx.h"
+#include "bit_band.h"
+#include "micro_bench.h"
+#include "bit_access.h"
+
+/* LED of the Blue Pill */
+#define BIT_ACCESS_LED_PIN (13U)
+
+volatile BitAccess_Flags_un g_bitAccessFlags = { 0U };
+
+/**
+  * @brief  Enable the GPIOC clock for the ODR cases, with a bit-band store
+  * @param  None
+  * @retval None
+  */
+void BitAccess_init(void)
+{
+	/* Constant alias, a single STR to a constant address */
+	BITBAND_PERIPH(RCC->APB2ENR, RCC_APB2ENR_IOPCEN_Pos) = 1U;
+	(void)RCC->APB2ENR; /* Clock is running after the read back */
+}
+
+/**
+  * @brief  Bit-field assignment: load, insert, store per bit
+  * @param  None
+  * @retval None
+  */
+void BitAccess_flagField(void)
+{
+	g_bitAccessFlags.bits_st.bit0 = 1U;
+	g_bitAccessFlags.bits_st.bit1 = 1U;
+	g_bitAccessFlags.bits_st.bit2 = 1U;
+	g_bitAccessFlags.bits_st.bit3 = 1U;
+	g_bitAccessFlags.bits_st.bit0 = 0U;
+	g_bitAccessFlags.bits_st.bit1 = 0U;
+	g_bitAccessFlags.bits_st.bit2 = 0U;
+	g_bitAccessFlags.bits_st.bit3 = 0U;
+}
+
+/**
+  * @brief  Mask operations: load, ORR/BIC, store per bit
+  * @param  None
+  * @retval None
+  */
+void BitAccess_flagMask(void)
+{
+	g_bitAccessFlags.word_u32 |= (1UL << 0U);
+	g_bitAccessFlags.word_u32 |= (1UL << 1U);
+	g_bitAccessFlags.word_u32 |= (1UL << 2U);
+	g_bitAccessFlags.word_u32 |= (1UL << 3U);
+	g_bitAccessFlags.word_u32 &= ~(1UL << 0U);
+	g_bitAccessFlags.word_u32 &= ~(1UL << 1U);
+	g_bitAccessFlags.word_u32 &= ~(1UL << 2U);
+	g_bitAccessFlags.word_u32 &= ~(1UL << 3U);
+}
+
+/* One mask operation inside a critical section, the price of sharing the
+ * word with an ISR without bit-band. primask is a local of the caller */
+#define BIT_ACCESS_LOCKED(primask, statement) \
+	do { \
+		(primask) = __get_PRIMASK(); \
+		__disable_irq(); \
+		statement; \
+		__set_PRIMASK(primask); \
+	} while (0)
+
+/**
+  * @brief  Mask operations, each one inside a critical section
+  * @param  None
+  * @retval None
+  */
+void BitAccess_flagMaskIrq(void)
+{
+	uint32_t l_primask_u32 = 0U;
+
+	BIT_ACCESS_LOCKED(l_primask_u32, g_bitAccessFlags.word_u32 |= (1UL << 0U));
+	BIT_ACCESS_LOCKED(l_primask_u32, g_bitAccessFlags.word_u32 |= (1UL << 1U));
+	BIT_ACCESS_LOCKED(l_primask_u32, g_bitAccessFlags.word_u32 |= (1UL << 2U));
+	BIT_ACCESS_LOCKED(l_primask_u32, g_bitAccessFlags.word_u32 |= (1UL << 3U));
+	BIT_ACCESS_LOCKED(l_primask_u32, g_bitAccessFlags.word_u32 &= ~(1UL << 0U));
+	BIT_ACCESS_LOCKED(l_primask_u32, g_bitAccessFlags.word_u32 &= ~(1UL << 1U));
+	BIT_ACCESS_LOCKED(l_primask_u32, g_bitAccessFlags.word_u32 &= ~(1UL << 2U));
+	BIT_ACCESS_LOCKED(l_primask_u32, g_bitAccessFlags.word_u32 &= ~(1UL << 3U));
+}
+
+/**
+  * @brief  Bit-band: the alias of bit 0 is computed once, the following bits
+  *         are the next alias words. One store per bit, atomic without masking
+  * @param  None
+  * @retval None
+  */
+void BitAccess_flagBand(void)
+{
+	volatile uint32_t *l_alias_pu32 = BitBand_sram(&g_bitAccessFlags.word_u32, 0U);
+
+	l_alias_pu32[0] = 1U;
+	l_alias_pu32[1] = 1U;
+	l_alias_pu32[2] = 1U;
+	l_alias_pu32[3] = 1U;
+	l_alias_pu32[0] = 0U;
+	l_alias_pu32[1] = 0U;
+	l_alias_pu32[2] = 0U;
+	l_alias_pu32[3] = 0U;
+}
+
+/**
+  * @brief  Read-modify-write of the output data register
+  * @param  None
+  * @retval None
+  */
+void BitAccess_odrMask(void)
+{
+	GPIOC->ODR |= (1UL << BIT_ACCESS_LED_PIN);
+	GPIOC->ODR &= ~(1UL << BIT_ACCESS_LED_PIN);
+}
+
+/**
+  * @brief  Constant alias of ODR bit 13, two stores
+  * @param  None
+  * @retval None
+  */
+void BitAccess_odrBand(void)
+{
+	BITBAND_PERIPH(GPIOC->ODR, BIT_ACCESS_LED_PIN) = 1U;
+	BITBAND_PERIPH(GPIOC->ODR, BIT_ACCESS_LED_PIN) = 0U;
+}
+
+/* Benchmark cases, target only: the host has no bit-band region */
+BENCH_CASE(s_bitFieldCase, "bit.field", BitAccess_flagField);
+BENCH_CASE(s_bitMaskCase, "bit.mask", BitAccess_flagMask);
+BENCH_CASE(s_bitMaskIrqCase, "bit.mask.irq", BitAccess_flagMaskIrq);
+BENCH_CASE(s_bitBandCase, "bit.band", BitAccess_flagBand);
+BENCH_CASE(s_odrMaskCase, "odr.mask", BitAccess_odrMask);
+BENCH_CASE(s_odrBandCase, "odr.band", BitAccess_odrBand);
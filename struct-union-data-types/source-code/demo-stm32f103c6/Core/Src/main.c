@@ -1,6 +1,9 @@
 
 #include <stdbool.h> /* Standard bool data types */
 #include <stdint.h> /* Standard integer data types */
+#include "micro_bench.h"
+#include "rect_layout.h"
+#include "bit_access.h"
 
 /* Example of union data type for register access */
 typedef struct {
@@ -61,6 +64,14 @@ int main(void)
 	uint16_t halfWord0 = data_un.registerHalfWords_u16[0];
 	data_un.registerHalfWords_u16[1] = 0xABCD;
 
+	/* Access cost of the packed, natural and reordered Rectangle layouts
+	 * and of single-bit access with bit-fields, masks and bit-band,
+	 * results in g_benchResults, see rect_layout.h and bit_access.h */
+	Bench_init();
+	RectLayout_init();
+	BitAccess_init();
+	(void)Bench_runAll(8U, 64U);
+
 	while (1)
 	{
 		/* do nothing here */
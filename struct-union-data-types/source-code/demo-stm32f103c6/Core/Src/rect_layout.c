@@ -0,0 +1,107 @@
+/*****************************************************************************
+ * @file      rect_layout.c
+ * @author    Jet Station
+ * @brief     Packed, natural and reordered Rectangle layouts and their benchmark
+ * @date      [2026-10-17]
+ *
+ * Contact:
+ *   @website   https://jet-station.github.io/
+ *   @github    https://github.com/jet-station
+ *   @linkedin  https://www.linkedin.com/in/thien-ai-ho/
+ *   @email     thienaiho95@gmail.com
+ *
+ * @copyright  Copyright (c) 2026 Jet Station. All rights reserved.
+ *****************************************************************************/
+
+#include <stdint.h> /* Standard integer data types */
+#include "micro_bench.h"
+#include "rect_layout.h"
+
+RectPacked_st g_rectPacked[RECT_LAYOUT_COUNT];
+RectNatural_st g_rectNatural[RECT_LAYOUT_COUNT];
+RectReordered_st g_rectReordered[RECT_LAYOUT_COUNT];
+
+volatile uint32_t g_rectAreaSum = 0U;
+
+/**
+  * @brief  Fill the three tables with the same rectangles
+  * @param  None
+  * @retval None
+  */
+void RectLayout_init(void)
+{
+	uint32_t l_idx_u32 = 0U;
+	uint16_t l_width_u16 = 0U;
+	uint16_t l_height_u16 = 0U;
+
+	for (l_idx_u32 = 0U; l_idx_u32 < RECT_LAYOUT_COUNT; l_idx_u32++)
+	{
+		l_width_u16 = (uint16_t)(10U + l_idx_u32);
+		l_height_u16 = (uint16_t)(5U + (2U * l_idx_u32));
+
+		g_rectPacked[l_idx_u32].width_u16 = l_width_u16;
+		g_rectPacked[l_idx_u32].height_u16 = l_height_u16;
+		g_rectNatural[l_idx_u32].width_u16 = l_width_u16;
+		g_rectNatural[l_idx_u32].height_u16 = l_height_u16;
+		g_rectReordered[l_idx_u32].width_u16 = l_width_u16;
+		g_rectReordered[l_idx_u32].height_u16 = l_height_u16;
+	}
+}
+
+/* Same loop body for every layout, only the element type differs. On the
+ * Cortex-M3 the packed area_u32 is an unaligned LDR/STR, one more bus
+ * access each, or four byte accesses with -mno-unaligned-access.
+ * idx and sum are locals of the caller, sum starts at 0 */
+#define RECT_LAYOUT_AREA(table, idx, sum) \
+	do { \
+		for ((idx) = 0U; (idx) < RECT_LAYOUT_COUNT; (idx)++) \
+		{ \
+			(table)[idx].area_u32 = (uint32_t)(table)[idx].width_u16 * (table)[idx].height_u16; \
+			(sum) += (table)[idx].area_u32; \
+		} \
+		g_rectAreaSum = (sum); \
+	} while (0)
+
+/**
+  * @brief  Areas of the packed table, unaligned area_u32
+  * @param  None
+  * @retval None
+  */
+void RectLayout_areaPacked(void)
+{
+	uint32_t l_idx_u32 = 0U;
+	uint32_t l_sum_u32 = 0U;
+
+	RECT_LAYOUT_AREA(g_rectPacked, l_idx_u32, l_sum_u32);
+}
+
+/**
+  * @brief  Areas of the naturally aligned table, 12-byte elements
+  * @param  None
+  * @retval None
+  */
+void RectLayout_areaNatural(void)
+{
+	uint32_t l_idx_u32 = 0U;
+	uint32_t l_sum_u32 = 0U;
+
+	RECT_LAYOUT_AREA(g_rectNatural, l_idx_u32, l_sum_u32);
+}
+
+/**
+  * @brief  Areas of the reordered table, 8-byte aligned elements
+  * @param  None
+  * @retval None
+  */
+void RectLayout_areaReordered(void)
+{
+	uint32_t l_idx_u32 = 0U;
+	uint32_t l_sum_u32 = 0U;
+
+	RECT_LAYOUT_AREA(g_rectReordered, l_idx_u32, l_sum_u32);
+}
+
+/* Benchmark cases, shared by the target and the host runner */
+BENCH_CASE(s_rectPackedCase, "rect.packed", RectLayout_areaPacked);
+BENCH_CASE(s_rectNaturalCase, "rect.natural", RectLayout_areaNatural);
+BENCH_CASE(s_rectReorderedCase, "rect.reordered", RectLayout_areaReordered);